@@ -86,7 +86,10 @@ public:
         is_leaf{trans_idx < leaves_n},  //
         out{out}
     {
-        // if leaf, the first hash has no middle and no remainer, and the second has no remainder
+        size_t first = 1; // internal layer of the first node computed with a middle node
+
+        // if leaf, the first hash has no middle and no remainer, then its parent is computed as
+        // any other node
         if (is_leaf)
         {
             // first hash without xor
@@ -97,120 +100,80 @@ public:
                 foo_hash.emplace_back(pb, trans, other, boot[0], FMT(""));
 
             trans_idx >>= 1;
-
-            // xor middle node with left/right (xor is commutative)
-            interxm.emplace_back(pb, DIGEST_VARS, FMT(""));
-            foo_xor.emplace_back(pb, boot[0], middle[0], interxm[0], FMT(""));
-            otherxm.emplace_back(pb, DIGEST_VARS, FMT(""));
-            foo_xor.emplace_back(pb, middle[0], otherx[0], otherxm[0], FMT(""));
-
-            // hash result and add remainder
-            inter.emplace_back(pb, DIGEST_VARS, FMT(""));
-            interx.emplace_back(pb, DIGEST_VARS, FMT(""));
-            if (trans_idx & 1)
-            {
-                foo_hash.emplace_back(pb, otherxm[0], interxm[0], inter[0], FMT(""));
-                // the node was a right leaf, the remainder is boot[0]
-                foo_xor.emplace_back(pb, inter[0], boot[0], interx[0], FMT(""));
-            }
-            else
-            {
-                foo_hash.emplace_back(pb, interxm[0], otherxm[0], inter[0], FMT(""));
-                // the node was a left leaf or a middle, the remainder is otherx[0]
-                foo_xor.emplace_back(pb, inter[0], otherx[0], interx[0], FMT(""));
-            }
+            hash_step(boot[0], middle[0], otherx[0], trans_idx & 1, next_node(first));
+            trans_idx >>= 1;
         }
-        // if middle, the first hash has no remainder
+        // if middle, other is the left child and otherx[0] the right child of the node owning it
         else
         {
-            // translate trans_idx to be used as a path along the tree
-            trans_idx >>= 1;
-            do
+            // layer and position of the node owning trans, as FixedAbr::middle_position
+            size_t count = leaves_n / 4;
+
+            trans_idx -= leaves_n;
+            while (trans_idx >= count)
             {
-                trans_idx -= leaves_n;
-                leaves_n /= 2;
-                --sub_height; // it's like the tree starts at the provided middle node
-            } while (trans_idx >= leaves_n);
-
-            // by convention, other is the left node, and otherx[0] is the right node
-            // xor middle node with left/right (xor is commutative)
-            interxm.emplace_back(pb, DIGEST_VARS, FMT(""));
-            foo_xor.emplace_back(pb, other, trans, interxm[0], FMT(""));
-            otherxm.emplace_back(pb, DIGEST_VARS, FMT(""));
-            foo_xor.emplace_back(pb, trans, otherx[0], otherxm[0], FMT(""));
-
-            // hash result
-            inter.emplace_back(pb, DIGEST_VARS, FMT(""));
-            interx.emplace_back(pb, DIGEST_VARS, FMT(""));
-            if (trans_idx & 1)
-                foo_hash.emplace_back(pb, otherxm[0], interxm[0], inter[0], FMT(""));
-            else
-                foo_hash.emplace_back(pb, interxm[0], otherxm[0], inter[0], FMT(""));
+                trans_idx -= count;
+                count /= 2;
+                ++first;
+            }
+            sub_height = height - first + 1; // it's like the tree starts at the owner of trans
 
-            // add remainder
-            foo_xor.emplace_back(pb, inter[0], otherx[0], interx[0], FMT(""));
+            hash_step(other, trans, otherx[0], false, next_node(first));
         }
-        trans_idx >>= 1;
 
         /* Given height=h, we have:
-        1. h levels in the tree
-        2. h - 1 hash outputs (i.e. non-leaves)
-        3. h - 2 intermediate hash output (i.e. non-root)
-        4. If our node is a leaf, we already computed the first two hashes (boot and interx[0])
-        5. If our node is internal, we already computed the first hash (interx[0])
-        Hence, we need to insert rem = (h - 2 - is_leaf) blocks.
-        E.g., if our node is a leaf and height = 4, this loop won't run at all
+        1. h - 1 internal layers, the root being layer h - 2
+        2. interx[0] (or out) is the node of layer `first` on the path
+        3. layer first + i hashes interx[i - 1] with middle[i] and otherx[i], up to the root
+        E.g., if our node is a leaf and height = 4, this loop runs once, into out
         */
-        for (size_t i = 1, rem = sub_height - 2 - is_leaf; i < rem; ++i, trans_idx >>= 1)
+        for (size_t i = 1; first + i < height - 1; ++i, trans_idx >>= 1)
         {
-            interxm.emplace_back(pb, DIGEST_VARS, FMT(""));
-            otherxm.emplace_back(pb, DIGEST_VARS, FMT(""));
-            inter.emplace_back(pb, DIGEST_VARS, FMT(""));
-            interx.emplace_back(pb, DIGEST_VARS, FMT(""));
-
-            // xor middle node with left/right (xor is commutative)
-            foo_xor.emplace_back(pb, interx[i - 1], middle[i], interxm[i], FMT(""));
-            foo_xor.emplace_back(pb, otherx[i], middle[i], otherxm[i], FMT(""));
+            const DigVar &res = next_node(first + i);
 
-            // hash and add remainder
-            if (trans_idx & 1)
-            {
-                foo_hash.emplace_back(pb, otherxm[i], interxm[i], inter[i], FMT(""));
-                // the node was a right leaf, the remainder is interx[i-1]
-                foo_xor.emplace_back(pb, inter[i], interx[i - 1], interx[i], FMT(""));
-            }
-            else
-            {
-                foo_hash.emplace_back(pb, interxm[i], otherxm[i], inter[i], FMT(""));
-                // the node was a left leaf or a middle, the remainder is otherx[i]
-                foo_xor.emplace_back(pb, inter[i], otherx[i], interx[i], FMT(""));
-            }
+            hash_step(interx[i - 1], middle[i], otherx[i], trans_idx & 1, res);
         }
+    }
 
-        // last layer must put result into "out"
-        interxm.emplace_back(pb, DIGEST_VARS, FMT(""));
-        otherxm.emplace_back(pb, DIGEST_VARS, FMT(""));
-        inter.emplace_back(pb, DIGEST_VARS, FMT(""));
+private:
+    // out for the root, else a new interx node
+    const DigVar &next_node(size_t layer)
+    {
+        if (layer == height - 2)
+            return out;
+
+        return interx.emplace_back(this->pb, DIGEST_VARS, FMT(""));
+    }
+
+    // res = hash(cur, sibling in their order, both xored with mid) xor the right one of the two
+    void hash_step(const DigVar &cur, const DigVar &mid, const DigVar &sibling, bool is_right,
+                   const DigVar &res)
+    {
+        auto &pb = this->pb;
 
         // xor middle node with left/right (xor is commutative)
-        foo_xor.emplace_back(pb, interx.back(), middle.back(), interxm.back(), FMT(""));
-        foo_xor.emplace_back(pb, otherx.back(), middle.back(), otherxm.back(), FMT(""));
+        interxm.emplace_back(pb, DIGEST_VARS, FMT(""));
+        foo_xor.emplace_back(pb, cur, mid, interxm.back(), FMT(""));
+        otherxm.emplace_back(pb, DIGEST_VARS, FMT(""));
+        foo_xor.emplace_back(pb, sibling, mid, otherxm.back(), FMT(""));
 
         // hash and add remainder
-        if (trans_idx & 1)
+        inter.emplace_back(pb, DIGEST_VARS, FMT(""));
+        if (is_right)
         {
             foo_hash.emplace_back(pb, otherxm.back(), interxm.back(), inter.back(), FMT(""));
-            // the node was a right leaf, the remainder is interx[i-1]
-            foo_xor.emplace_back(pb, inter.back(), interx.back(), out, FMT(""));
+            // the node was a right one, the remainder is the node itself
+            foo_xor.emplace_back(pb, inter.back(), cur, res, FMT(""));
         }
         else
         {
             foo_hash.emplace_back(pb, interxm.back(), otherxm.back(), inter.back(), FMT(""));
-            // the node was a left leaf or a middle, the remainder is otherx[i]
-            foo_xor.emplace_back(pb, inter.back(), otherx.back(), out, FMT(""));
+            // the node was a left one or a middle, the remainder is its sibling
+            foo_xor.emplace_back(pb, inter.back(), sibling, res, FMT(""));
         }
     }
 
+public:
     void generate_r1cs_constraints()
     {
         for (auto &&x : foo_xor)
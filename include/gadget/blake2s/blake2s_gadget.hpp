@@ -0,0 +1,265 @@
+#pragma once
+
+#include <libsnark/gadgetlib1/gadgets/basic_gadgets.hpp>
+#include <libsnark/gadgetlib1/gadgets/hashes/hash_io.hpp>
+
+#include "utils/blake2s.hpp"
+
+#include <array>
+#include <climits>
+#include <initializer_list>
+
+/*
+Blake2s::hash_oneblock of x || y on digest_variable bits (MSB first in each byte, as for SHA256).
+A 32-bit word is kept as the linear combinations of its bits: rotations are free, a XOR costs one
+constraint per bit and a sum is unpacked into 33 or 34 boolean bits (the carries are dropped).
+*/
+#if defined(__INTELLISENSE__) && 0
+    #include <libff/common/default_types/ec_pp.hpp>
+using FieldT = libff::Fr<libsnark::default_r1cs_ppzksnark_pp>;
+#else
+template<typename FieldT>
+#endif
+class blake2s_two_to_one_hash_gadget : public libsnark::gadget<FieldT>
+{
+public:
+    using Base = Blake2s;
+    using Constraint = libsnark::r1cs_constraint<FieldT>;
+    using Parent = libsnark::gadget<FieldT>;
+    using LC = libsnark::linear_combination<FieldT>;
+    using PbVar = libsnark::pb_variable<FieldT>;
+    using DigVar = libsnark::digest_variable<FieldT>;
+
+    // Bits of a word, least significant first
+    using Word = std::array<LC, 32>;
+
+    static constexpr size_t ROUNDS_N = Base::ROUNDS_N;
+    static constexpr size_t DIGEST_SIZE = Base::DIGEST_SIZE;
+    static constexpr size_t DIGEST_VARS = DIGEST_SIZE * CHAR_BIT;
+    static constexpr size_t BLOCK_SIZE = Base::BLOCK_SIZE;
+
+    const DigVar x;
+    const DigVar y;
+    const DigVar out;
+
+private:
+    // A G function: two sums of 3 words (34 bits), two sums of 2 words (33 bits) and 4 XOR
+    static constexpr size_t G_VARS = 2 * 34 + 2 * 33 + 4 * 32;
+    static constexpr size_t INTER_N = 8 * ROUNDS_N * G_VARS;
+
+    libsnark::pb_variable_array<FieldT> inter;
+    size_t next = 0;
+
+public:
+    blake2s_two_to_one_hash_gadget(libsnark::protoboard<FieldT> &pb, const DigVar &x,
+                                   const DigVar &y, const DigVar &out,
+                                   const std::string &annotation_prefix) :
+        Parent(pb, annotation_prefix),
+        x{x}, y{y}, out{out}, inter{}
+    {
+        inter.allocate(pb, INTER_N, FMT(annotation_prefix, "_blake2s_inter"));
+    }
+
+    inline size_t constrain(const LC &x, const LC &y, const LC &z)
+    {
+        this->pb.add_r1cs_constraint(Constraint(x, y, z), FMT(""));
+
+        return 1;
+    }
+
+    // Index in the bits of x || y (or of out) of bit k of the little-endian word i
+    static constexpr size_t bit_index(size_t i, size_t k)
+    {
+        return 8 * (4 * i + k / 8) + 7 - k % 8;
+    }
+
+    PbVar block_bit(size_t i, size_t k) const
+    {
+        size_t n = bit_index(i, k);
+
+        return n < DIGEST_VARS ? x.bits[n] : y.bits[n - DIGEST_VARS];
+    }
+
+    static Word constant(uint32_t c)
+    {
+        Word w;
+
+        for (size_t k = 0; k < 32; ++k)
+            w[k] = LC(c >> k & 1 ? FieldT::one() : FieldT::zero());
+
+        return w;
+    }
+
+    static Word rotr(const Word &w, size_t n)
+    {
+        Word r;
+
+        for (size_t k = 0; k < 32; ++k)
+            r[k] = w[(k + n) % 32];
+
+        return r;
+    }
+
+    // r = a + b - 2ab
+    Word xor_words(const Word &a, const Word &b)
+    {
+        Word r;
+
+        for (size_t k = 0; k < 32; ++k, ++next)
+        {
+            constrain(a[k] * FieldT(2), b[k], a[k] + b[k] - LC(inter[next]));
+            r[k] = inter[next];
+        }
+
+        return r;
+    }
+
+    // Sum of 2 or 3 words mod 2^32, through its unpacked bits
+    Word add_words(std::initializer_list<const Word *> w)
+    {
+        const size_t bits = 32 + (w.size() == 3 ? 2 : 1);
+        FieldT pow = FieldT::one();
+        LC sum, packed;
+        Word r;
+
+        for (size_t k = 0; k < bits; ++k, ++next)
+        {
+            constrain(inter[next], LC(FieldT::one()) - LC(inter[next]), LC(FieldT::zero()));
+            packed = packed + LC(inter[next]) * pow;
+
+            if (k < 32)
+            {
+                for (const Word *p : w)
+                    sum = sum + (*p)[k] * pow;
+                r[k] = inter[next];
+            }
+            pow += pow;
+        }
+        constrain(LC(FieldT::one()), sum, packed);
+
+        return r;
+    }
+
+    void g(Word v[16], size_t a, size_t b, size_t c, size_t d, const Word &m0, const Word &m1)
+    {
+        v[a] = add_words({&v[a], &v[b], &m0});
+        v[d] = rotr(xor_words(v[d], v[a]), 16);
+        v[c] = add_words({&v[c], &v[d]});
+        v[b] = rotr(xor_words(v[b], v[c]), 12);
+        v[a] = add_words({&v[a], &v[b], &m1});
+        v[d] = rotr(xor_words(v[d], v[a]), 8);
+        v[c] = add_words({&v[c], &v[d]});
+        v[b] = rotr(xor_words(v[b], v[c]), 7);
+    }
+
+    void generate_r1cs_constraints()
+    {
+        Word m[16];
+        Word v[16];
+
+        next = 0;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            for (size_t k = 0; k < 32; ++k)
+                m[i][k] = block_bit(i, k);
+            v[i] = constant(Base::V[i]);
+        }
+
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            const uint8_t *s = Base::SIGMA[r];
+
+            g(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+            g(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+            g(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+            g(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+            g(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+            g(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+            g(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+            g(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+        }
+
+        // out = H ^ v[i] ^ v[i + 8], the constant H flipping the output bits
+        for (size_t i = 0; i < 8; ++i)
+            for (size_t k = 0; k < 32; ++k)
+            {
+                LC o = out.bits[bit_index(i, k)];
+                LC t = Base::H[i] >> k & 1 ? LC(FieldT::one()) - o : o;
+
+                constrain(v[i][k] * FieldT(2), v[i + 8][k], v[i][k] + v[i + 8][k] - t);
+            }
+    }
+
+    uint32_t xor_values(uint32_t a, uint32_t b)
+    {
+        uint32_t r = a ^ b;
+
+        for (size_t k = 0; k < 32; ++k)
+            this->pb.val(inter[next++]) = r >> k & 1 ? FieldT::one() : FieldT::zero();
+
+        return r;
+    }
+
+    uint32_t add_values(std::initializer_list<uint32_t> w)
+    {
+        const size_t bits = 32 + (w.size() == 3 ? 2 : 1);
+        uint64_t sum = 0;
+
+        for (uint32_t a : w)
+            sum += a;
+        for (size_t k = 0; k < bits; ++k)
+            this->pb.val(inter[next++]) = sum >> k & 1 ? FieldT::one() : FieldT::zero();
+
+        return (uint32_t)sum;
+    }
+
+    void g_values(uint32_t v[16], size_t a, size_t b, size_t c, size_t d, uint32_t m0,
+                  uint32_t m1)
+    {
+        v[a] = add_values({v[a], v[b], m0});
+        v[d] = _rotr(xor_values(v[d], v[a]), 16);
+        v[c] = add_values({v[c], v[d]});
+        v[b] = _rotr(xor_values(v[b], v[c]), 12);
+        v[a] = add_values({v[a], v[b], m1});
+        v[d] = _rotr(xor_values(v[d], v[a]), 8);
+        v[c] = add_values({v[c], v[d]});
+        v[b] = _rotr(xor_values(v[b], v[c]), 7);
+    }
+
+    void generate_r1cs_witness()
+    {
+        auto &pb = this->pb;
+        uint32_t m[16]{};
+        uint32_t v[16];
+
+        next = 0;
+        for (size_t i = 0; i < 16; ++i)
+        {
+            for (size_t k = 0; k < 32; ++k)
+                m[i] |= (uint32_t)(pb.val(block_bit(i, k)) == FieldT::one()) << k;
+            v[i] = Base::V[i];
+        }
+
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            const uint8_t *s = Base::SIGMA[r];
+
+            g_values(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+            g_values(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+            g_values(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+            g_values(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+            g_values(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+            g_values(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+            g_values(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+            g_values(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+        }
+
+        for (size_t i = 0; i < 8; ++i)
+        {
+            uint32_t h = Base::H[i] ^ v[i] ^ v[i + 8];
+
+            for (size_t k = 0; k < 32; ++k)
+                pb.val(out.bits[bit_index(i, k)]) = h >> k & 1 ? FieldT::one() : FieldT::zero();
+        }
+    }
+};
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "utils/field_bytes.hpp"
 #include "utils/string_utils.hpp"
+#include <array>
+#include <cassert>
 #include <gmpxx.h>
 #include <libsnark/gadgetlib1/gadgets/basic_gadgets.hpp>
 
@@ -31,18 +34,21 @@ public:
             this->pb.val(vars[i]) = contents[i];
     }
 
-    void generate_r1cs_witness(const void *data)
+    // Field elements kept in Montgomery form, e.g. the digests of FieldMTree, one per variable
+    template<size_t n>
+    void generate_r1cs_witness(const std::array<FieldT, n> &contents)
     {
-        mpz_class tmp;
+        assert(n == vars.size());
 
+        for (size_t i = 0; i < n; ++i)
+            this->pb.val(vars[i]) = contents[i];
+    }
 
+    void generate_r1cs_witness(const void *data)
+    {
         for (size_t i = 0; i < vars.size(); ++i)
-        {
-            mpz_import(tmp.get_mpz_t(), FIELDT_SIZE, 1, 1, 0, 0,
-                       (const char *)data + FIELDT_SIZE * i);
-
-            this->pb.val(vars[i]) = FieldT{tmp.get_mpz_t()};
-        }
+            this->pb.val(vars[i]) =
+                FieldBytes<FieldT>::to_field((const uint8_t *)data + FIELDT_SIZE * i);
     }
 
     const auto &operator[](size_t i) const { return vars[i]; }
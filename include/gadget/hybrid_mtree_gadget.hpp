@@ -0,0 +1,99 @@
+#pragma once
+
+#include "gadget/mtree_gadget.hpp"
+#include "utils/bit_pack.hpp"
+#include "utils/hybrid_mtree.hpp"
+
+#include <algorithm>
+#include <utility>
+
+/*
+Path gadget of a HybridMTree which only constrains the levels hashed with GadHash, from
+FIRST_LEVEL = max(SPLIT, 1) up to the root (as with MTree_Gadget, the leaves themselves are never
+hashed in-circuit). trans is the node of level FIRST_LEVEL - 1 on the path of leaf trans_idx, as
+computed natively by the lower hashes, and other holds the PATH_N siblings of the levels
+FIRST_LEVEL - 1 .. height - 2: the proof binds trans to the root, not the leaf below it.
+*/
+#if defined(__INTELLISENSE__) && 0
+    #include "gadget/mimc256/mimc256_gadget.hpp"
+    #include "utils/sha256.hpp"
+using FieldT = libff::Fr<libsnark::default_r1cs_ppzksnark_pp>;
+using GadHash = mimc256_two_to_one_hash_gadget<FieldT>;
+using Tree = HybridMTree<16, SplitLevels<8, Sha256, Mimc256>>;
+#else
+template<typename FieldT, typename GadHash, typename Tree>
+#endif
+class HybridMTree_Gadget : public libsnark::gadget<FieldT>
+{
+public:
+    using super = libsnark::gadget<FieldT>;
+    using Inner = MTree_Gadget<FieldT, GadHash>;
+    using DigVar = typename Inner::DigVar;
+    using Protoboard = libsnark::protoboard<FieldT>;
+
+    static constexpr size_t DIGEST_VARS = Inner::DIGEST_VARS;
+    static constexpr size_t FIRST_LEVEL = std::max<size_t>(Tree::SPLIT, 1);
+    static constexpr size_t PATH_N = Tree::HEIGHT - FIRST_LEVEL;
+
+    static_assert(GadHash::DIGEST_SIZE == Tree::DIGEST_SIZE, "Digest size of the tree");
+    static_assert(PATH_N >= 2, "MTree_Gadget needs 2 levels in-circuit");
+
+private:
+    template<size_t... l>
+    static constexpr bool same_hash(std::index_sequence<l...>)
+    {
+        using Upper = typename Tree::template HashAt<FIRST_LEVEL>;
+
+        return (std::is_same_v<typename Tree::template HashAt<FIRST_LEVEL + l>, Upper> && ...);
+    }
+
+    static_assert(same_hash(std::make_index_sequence<PATH_N>{}), "One hash for the proven levels");
+
+    DigVar trans;
+    std::vector<DigVar> other;
+    size_t idx;
+    Inner path;
+
+public:
+    const DigVar out;
+
+    HybridMTree_Gadget(Protoboard &pb, const DigVar &out, const DigVar &trans,
+                       const std::vector<DigVar> &other, size_t trans_idx,
+                       const std::string &ap) :
+        super(pb, ap),
+        trans{trans}, other{other}, idx{trans_idx},
+        path{pb, out, trans, other, trans_idx >> (FIRST_LEVEL - 1), ap}, out{out}
+    {}
+
+    void generate_r1cs_constraints() { path.generate_r1cs_constraints(); }
+
+    void generate_r1cs_witness() { path.generate_r1cs_witness(); }
+
+    // trans and other from the native tree, then the proven levels up to out
+    void generate_r1cs_witness(const Tree &tree)
+    {
+        uint8_t siblings[PATH_N * Tree::DIGEST_SIZE];
+
+        tree.get_path(idx, siblings, FIRST_LEVEL - 1);
+
+        assign(trans, tree.get_node(FIRST_LEVEL - 1, idx));
+        for (size_t i = 0; i < PATH_N; ++i)
+            assign(other[i], siblings + i * Tree::DIGEST_SIZE);
+
+        path.generate_r1cs_witness();
+    }
+
+private:
+    static void assign(DigVar &var, const uint8_t *digest)
+    {
+        if constexpr (Inner::HASH_ISBOOLEAN)
+        {
+            libff::bit_vector bv(DIGEST_VARS);
+
+            unpack_bits(bv, digest);
+            var.generate_r1cs_witness(bv);
+        }
+        else
+            var.generate_r1cs_witness(digest);
+    }
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <libsnark/gadgetlib1/gadgets/hashes/hash_io.hpp>
+#include <libsnark/gadgetlib1/gadgets/hashes/knapsack/knapsack_gadget.hpp>
+
+#include "utils/knapsack.hpp"
+
+#include <climits>
+
+/*
+Knapsack::hash_oneblock of x || y with knapsack_CRH_with_bit_out_gadget of libsnark: one
+constraint for the sum and one per bit of it. The gadget gives the FieldT::size_in_bits() bits
+of the sum least significant first, which are the last bits of out in reverse order (big-endian
+digest), and the top bits of out left over are constrained to 0.
+*/
+#if defined(__INTELLISENSE__) && 0
+    #include <libff/common/default_types/ec_pp.hpp>
+using FieldT = libff::Fr<libsnark::default_r1cs_ppzksnark_pp>;
+#else
+template<typename FieldT>
+#endif
+class knapsack_two_to_one_hash_gadget : public libsnark::gadget<FieldT>
+{
+public:
+    using Base = Knapsack;
+    using Constraint = libsnark::r1cs_constraint<FieldT>;
+    using Parent = libsnark::gadget<FieldT>;
+    using PbVar = libsnark::pb_variable<FieldT>;
+    using DigVar = libsnark::digest_variable<FieldT>;
+    using CRH = libsnark::knapsack_CRH_with_bit_out_gadget<FieldT>;
+
+    static constexpr size_t DIGEST_SIZE = Base::DIGEST_SIZE;
+    static constexpr size_t DIGEST_VARS = DIGEST_SIZE * CHAR_BIT;
+    static constexpr size_t BLOCK_SIZE = Base::BLOCK_SIZE;
+
+    const DigVar x;
+    const DigVar y;
+    const DigVar out;
+
+private:
+    libsnark::block_variable<FieldT> block;
+    DigVar sum;
+    CRH crh;
+
+public:
+    knapsack_two_to_one_hash_gadget(libsnark::protoboard<FieldT> &pb, const DigVar &x,
+                                    const DigVar &y, const DigVar &out,
+                                    const std::string &annotation_prefix) :
+        Parent(pb, annotation_prefix),
+        x{x}, y{y}, out{out}, block{pb, x, y, FMT(annotation_prefix, "_knapsack_block")},
+        sum{pb, CRH::get_digest_len(), sum_bits(out), out.bits[0],
+            FMT(annotation_prefix, "_knapsack_sum")},
+        crh{pb, 2 * DIGEST_VARS, block, sum, FMT(annotation_prefix, "_knapsack_crh")}
+    {}
+
+    // Bits of out holding the sum, least significant first
+    static libsnark::pb_variable_array<FieldT> sum_bits(const DigVar &out)
+    {
+        libsnark::pb_variable_array<FieldT> bits;
+
+        for (size_t j = 0; j < CRH::get_digest_len(); ++j)
+            bits.emplace_back(out.bits[DIGEST_VARS - 1 - j]);
+
+        return bits;
+    }
+
+    inline size_t constrain(const PbVar &x, const FieldT &y, const FieldT &z)
+    {
+        this->pb.add_r1cs_constraint(Constraint(x, y, z), FMT(""));
+
+        return 1;
+    }
+
+    void generate_r1cs_constraints()
+    {
+        crh.generate_r1cs_constraints();
+
+        for (size_t i = 0; i < DIGEST_VARS - CRH::get_digest_len(); ++i)
+            constrain(out.bits[i], FieldT::one(), FieldT::zero());
+    }
+
+    void generate_r1cs_witness()
+    {
+        crh.generate_r1cs_witness();
+
+        for (size_t i = 0; i < DIGEST_VARS - CRH::get_digest_len(); ++i)
+            this->pb.val(out.bits[i]) = FieldT::zero();
+    }
+};
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <libsnark/gadgetlib1/gadgets/basic_gadgets.hpp>
+#include <libsnark/gadgetlib1/gadgets/hashes/hash_io.hpp>
+
+#include "gadget/field_variable.hpp"
+#include "utils/mimc_feistel.hpp"
+
+/*
+Gadget of a MimcFeistel variant, x = x_0..x_{B-1} and y = y_0..y_{B-1} being the block. With
+u = s_0 + k + c, a round costs 2 constraints: u^2 into a new variable, then
+u^2 * u = s_0' - s_{B-1}, so that the new s_0 is a variable and the shift of the other branches
+is free. The state starts at 0 (the first round is x_k^3) and the last BRANCHES rounds write out
+directly.
+*/
+#if defined(__INTELLISENSE__) && 0
+    #include "utils/mimc512f.hpp"
+    #include <libff/common/default_types/ec_pp.hpp>
+using FieldT = libff::Fr<libsnark::default_r1cs_ppzksnark_pp>;
+using Hash = Mimc512F;
+#else
+template<typename FieldT, typename Hash>
+#endif
+class mimc_feistel_two_to_one_hash_gadget : public libsnark::gadget<FieldT>
+{
+public:
+    using Base = Hash;
+    using Constraint = libsnark::r1cs_constraint<FieldT>;
+    using Parent = libsnark::gadget<FieldT>;
+    using LC = libsnark::linear_combination<FieldT>;
+    using PbVar = libsnark::pb_variable<FieldT>;
+    using DigVar = field_variable<FieldT>;
+
+    static constexpr size_t BRANCHES_N = Base::BRANCHES_N;
+    static constexpr size_t PASSES_N = Base::PASSES_N;
+    static constexpr size_t ROUNDS_N = Base::ROUNDS_N;
+    static constexpr size_t TOTAL_ROUNDS_N = Base::TOTAL_ROUNDS_N;
+    static constexpr size_t DIGEST_SIZE = Base::DIGEST_SIZE;
+    static constexpr size_t DIGEST_VARS = BRANCHES_N;
+    static constexpr size_t BLOCK_SIZE = Base::BLOCK_SIZE;
+
+    const DigVar x;
+    const DigVar y;
+    const DigVar out;
+
+private:
+    // u^2 of every round, then s_0 after all but the last BRANCHES_N rounds
+    static constexpr size_t INTER_N = 2 * TOTAL_ROUNDS_N - BRANCHES_N;
+
+    std::vector<PbVar> inter;
+
+public:
+    mimc_feistel_two_to_one_hash_gadget(libsnark::protoboard<FieldT> &pb, const DigVar &x,
+                                        const DigVar &y, const DigVar &out,
+                                        const std::string &annotation_prefix) :
+        Parent(pb, annotation_prefix),
+        x{x}, y{y}, out{out}, inter{}
+    {
+        for (size_t i = 0; i < INTER_N; ++i)
+        {
+            inter.emplace_back();
+            inter.back().allocate(pb, FMT(annotation_prefix, "_mimc_feistel_inter_%llu", i));
+        }
+    }
+
+    inline size_t constrain(const LC &x, const LC &y, const LC &z)
+    {
+        this->pb.add_r1cs_constraint(Constraint(x, y, z), FMT(""));
+
+        return 1;
+    }
+
+    // Element i of the block x || y
+    const PbVar &block(size_t i) const { return i < BRANCHES_N ? x[i] : y[i - BRANCHES_N]; }
+
+    // Variable of s_0 after round t, out[0] for the last round up to out[BRANCHES_N - 1]
+    const PbVar &output(size_t t) const
+    {
+        return t + BRANCHES_N < TOTAL_ROUNDS_N ? inter[TOTAL_ROUNDS_N + t]
+                                               : out[TOTAL_ROUNDS_N - 1 - t];
+    }
+
+    // Round r of pass p, round t overall, with u^2 in inter[t]
+    void round_constraints(size_t p, size_t r, size_t t)
+    {
+        LC s0 = t > 0 ? LC(output(t - 1)) : LC(FieldT::zero());
+        LC last = t >= BRANCHES_N ? LC(output(t - BRANCHES_N)) : LC(FieldT::zero());
+        LC k = block(Base::key_index(p, r));
+        LC u = r > 0 ? s0 + k + Base::round_cf[r - 1] : s0 + k;
+
+        constrain(u, u, inter[t]);
+        constrain(inter[t], u, LC(output(t)) - last);
+    }
+
+    void generate_r1cs_constraints()
+    {
+        for (size_t p = 0, t = 0; p < PASSES_N; ++p)
+            for (size_t r = 0; r < ROUNDS_N; ++r, ++t)
+                round_constraints(p, r, t);
+    }
+
+    void round_witness(size_t p, size_t r, size_t t)
+    {
+        auto &pb = this->pb;
+        FieldT s0 = t > 0 ? pb.val(output(t - 1)) : FieldT::zero();
+        FieldT last = t >= BRANCHES_N ? pb.val(output(t - BRANCHES_N)) : FieldT::zero();
+        FieldT u = s0 + pb.val(block(Base::key_index(p, r)));
+
+        if (r > 0)
+            u += Base::round_cf[r - 1];
+
+        pb.val(inter[t]) = u * u;
+        pb.val(output(t)) = pb.val(inter[t]) * u + last;
+    }
+
+    void generate_r1cs_witness()
+    {
+        for (size_t p = 0, t = 0; p < PASSES_N; ++p)
+            for (size_t r = 0; r < ROUNDS_N; ++r, ++t)
+                round_witness(p, r, t);
+    }
+};
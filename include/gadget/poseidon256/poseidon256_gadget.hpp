@@ -0,0 +1,133 @@
+#pragma once
+
+#include <libsnark/gadgetlib1/gadgets/basic_gadgets.hpp>
+#include <libsnark/gadgetlib1/gadgets/hashes/hash_io.hpp>
+
+#include "gadget/field_variable.hpp"
+#include "utils/poseidon256.hpp"
+
+#if defined(__INTELLISENSE__) && 0
+    #include <libff/common/default_types/ec_pp.hpp>
+using FieldT = libff::Fr<libsnark::default_r1cs_ppzksnark_pp>;
+#else
+template<typename FieldT>
+#endif
+class poseidon256_two_to_one_hash_gadget : public libsnark::gadget<FieldT>
+{
+public:
+    using Base = Poseidon256;
+    using Constraint = libsnark::r1cs_constraint<FieldT>;
+    using Parent = libsnark::gadget<FieldT>;
+    using LC = libsnark::linear_combination<FieldT>;
+    using PbVar = libsnark::pb_variable<FieldT>;
+    using DigVar = field_variable<FieldT>;
+
+    static constexpr size_t WIDTH = Base::WIDTH;
+    static constexpr size_t ROUNDS_N = Base::ROUNDS_N;
+    static constexpr size_t DIGEST_SIZE = Base::DIGEST_SIZE;
+    static constexpr size_t DIGEST_VARS = 1;
+    static constexpr size_t BLOCK_SIZE = Base::BLOCK_SIZE;
+
+    const DigVar x;
+    const DigVar y;
+    const DigVar out;
+
+private:
+    // x^2, x^4 and x^5 for each S-box: WIDTH per full round, 1 per partial round
+    static constexpr size_t SBOX_N = WIDTH * Base::FULL_ROUNDS_N + Base::PARTIAL_ROUNDS_N;
+    static constexpr size_t INTER_N = 3 * SBOX_N;
+
+    std::vector<PbVar> inter;
+
+public:
+    poseidon256_two_to_one_hash_gadget(libsnark::protoboard<FieldT> &pb, const DigVar &x,
+                                       const DigVar &y, const DigVar &out,
+                                       const std::string &annotation_prefix) :
+        Parent(pb, annotation_prefix),
+        x{x}, y{y}, out{out}, inter{}
+    {
+        for (size_t i = 0; i < INTER_N; ++i)
+        {
+            inter.emplace_back();
+            inter.back().allocate(pb, FMT(annotation_prefix, "_poseidon256_inter_%llu", i));
+        }
+    }
+
+    inline size_t constrain(const LC &x, const LC &y, const LC &z)
+    {
+        this->pb.add_r1cs_constraint(Constraint(x, y, z), FMT(""));
+
+        return 1;
+    }
+
+    // The MDS matrix is linear: the state stays a linear combination, without constraints
+    static void mix(LC s[WIDTH])
+    {
+        LC t[WIDTH];
+
+        for (size_t i = 0; i < WIDTH; ++i)
+        {
+            t[i] = s[0] * Base::mds[i * WIDTH];
+            for (size_t j = 1; j < WIDTH; ++j)
+                t[i] = t[i] + s[j] * Base::mds[i * WIDTH + j];
+        }
+        for (size_t i = 0; i < WIDTH; ++i)
+            s[i] = t[i];
+    }
+
+    void generate_r1cs_constraints()
+    {
+        size_t i = 0;
+        LC s[WIDTH] = {LC(FieldT::zero()), x[0], y[0]};
+
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            for (size_t k = 0; k < WIDTH; ++k)
+                s[k] = s[k] + Base::round_cf[r * WIDTH + k];
+
+            // (s + c)^5 as ^2, ^4 and ^5
+            for (size_t k = 0; k < (Base::is_full_round(r) ? WIDTH : 1); ++k)
+            {
+                i += constrain(s[k], s[k], inter[i]);
+                i += constrain(inter[i - 1], inter[i - 1], inter[i]);
+                i += constrain(inter[i - 1], s[k], inter[i]);
+                s[k] = inter[i - 1];
+            }
+
+            mix(s);
+        }
+
+        constrain(s[0], FieldT::one(), out[0]);
+    }
+
+    void generate_r1cs_witness()
+    {
+        auto &pb = this->pb;
+        size_t i = 0;
+        Base::State s{FieldT::zero(), pb.val(x[0]), pb.val(y[0])};
+
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            for (size_t k = 0; k < WIDTH; ++k)
+                s[k] += Base::round_cf[r * WIDTH + k];
+
+            for (size_t k = 0; k < (Base::is_full_round(r) ? WIDTH : 1); ++k)
+            {
+                // (s + c)^2
+                pb.val(inter[i]) = s[k].squared();
+                ++i;
+                // ^4
+                pb.val(inter[i]) = pb.val(inter[i - 1]).squared();
+                ++i;
+                // ^5
+                pb.val(inter[i]) = pb.val(inter[i - 1]) * s[k];
+                s[k] = pb.val(inter[i]);
+                ++i;
+            }
+
+            Base::mix(s);
+        }
+
+        pb.val(out[0]) = s[0];
+    }
+};
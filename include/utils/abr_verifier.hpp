@@ -0,0 +1,164 @@
+#pragma once
+
+#include "utils/fixed_abr.hpp"
+#include "utils/hash_batch.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <omp.h>
+#include <vector>
+
+/*
+Native check of ABR membership proofs, to reject bad inputs before running the prover on an
+ABR_Gadget. A single proof is rebuilt with FixedAbrPath and compared against its root. A batch of
+proofs is checked in parallel by slices of HASH_SLICE_N proofs, whose paths are rebuilt layer by
+layer so that each layer of a slice goes through one hash_many call.
+*/
+template<size_t height, typename Hash>
+class AbrVerifier
+{
+public:
+    using Path = FixedAbrPath<height, Hash>;
+
+    static constexpr size_t LEAVES_N = Path::LEAVES_N;
+    static constexpr size_t INPUT_N = Path::INPUT_N;
+    static constexpr size_t PATH_SIZE = Path::PATH_SIZE;
+
+    // Same inputs as FixedAbrPath (see FixedAbr::get_path), plus the expected root
+    struct Proof
+    {
+        const uint8_t *trans = nullptr;
+        const uint8_t *other = nullptr;
+        const uint8_t *middle = nullptr; // height - 2 digests
+        const uint8_t *otherx = nullptr; // height - 2 digests
+        size_t idx = 0;
+        const uint8_t *root = nullptr;
+    };
+
+    AbrVerifier() = delete;
+
+    static bool verify(const Proof &proof)
+    {
+        if (proof.idx >= INPUT_N)
+            return false;
+
+        Path path{proof.trans, proof.other, proof.middle, proof.otherx, proof.idx};
+
+        return memcmp(path.digest(), proof.root, Hash::DIGEST_SIZE) == 0;
+    }
+
+private:
+    // Check n <= HASH_SLICE_N proofs, hashing their nodes of a given layer at once
+    static void verify_slice(const Proof *proofs, size_t n, bool *results)
+    {
+        uint8_t cur[HASH_SLICE_N][Hash::DIGEST_SIZE];
+        uint8_t block[HASH_SLICE_N][Hash::BLOCK_SIZE]{};
+        uint8_t out[HASH_SLICE_N][Hash::DIGEST_SIZE];
+        const uint8_t *rest[HASH_SLICE_N]; // right child added after hashing, if any
+        size_t slot[HASH_SLICE_N];
+        size_t first[HASH_SLICE_N]; // first layer of the path
+        size_t pos[HASH_SLICE_N];   // position of cur in its layer
+
+        for (size_t j = 0; j < n; ++j)
+        {
+            const Proof &p = proofs[j];
+
+            if (p.idx >= INPUT_N)
+                first[j] = height; // never hashed
+            else if (p.idx < LEAVES_N)
+            {
+                first[j] = 0;
+                pos[j] = p.idx;
+                memcpy(cur[j], p.trans, Hash::DIGEST_SIZE);
+            }
+            else
+                Path::Tree::middle_position(p.idx, first[j], pos[j]);
+        }
+
+        for (size_t t = 0; t < height - 1; ++t)
+        {
+            size_t m = 0;
+
+            for (size_t j = 0; j < n; ++j)
+            {
+                if (first[j] > t)
+                    continue;
+
+                const Proof &p = proofs[j];
+                bool leaf = p.idx < LEAVES_N;
+                const uint8_t *left, *right, *middle = nullptr;
+
+                if (t == first[j] && !leaf)
+                {
+                    // the transaction is the middle node, other and otherx[0] are the children
+                    left = p.other;
+                    right = p.otherx;
+                    middle = p.trans;
+                }
+                else
+                {
+                    size_t i = t - first[j] - leaf;
+                    const uint8_t *sibling = t == 0 ? p.other : p.otherx + i * Hash::DIGEST_SIZE;
+
+                    left = pos[j] & 1 ? sibling : cur[j];
+                    right = pos[j] & 1 ? cur[j] : sibling;
+                    if (t > 0)
+                        middle = p.middle + i * Hash::DIGEST_SIZE;
+                    pos[j] >>= 1;
+                }
+
+                memcpy(block[m], left, Hash::DIGEST_SIZE);
+                memcpy(block[m] + Hash::DIGEST_SIZE, right, Hash::DIGEST_SIZE);
+                if (middle)
+                {
+                    Hash::hash_add(block[m], middle);
+                    Hash::hash_add(block[m] + Hash::DIGEST_SIZE, middle);
+                }
+                rest[m] = middle ? right : nullptr;
+                slot[m++] = j;
+            }
+            hash_many<Hash>(out[0], block[0], m);
+
+            for (size_t k = 0; k < m; ++k)
+            {
+                if (rest[k])
+                    Hash::hash_add(out[k], rest[k]);
+                memcpy(cur[slot[k]], out[k], Hash::DIGEST_SIZE);
+            }
+        }
+
+        for (size_t j = 0; j < n; ++j)
+            results[j] = proofs[j].idx < INPUT_N &&
+                         memcmp(cur[j], proofs[j].root, Hash::DIGEST_SIZE) == 0;
+    }
+
+public:
+    // Check n proofs in parallel, results[i] tells whether proofs[i] holds. Returns the number
+    // of valid proofs.
+    static size_t verify_many(const Proof *proofs, size_t n, bool *results)
+    {
+        size_t valid = 0;
+
+#pragma omp parallel for schedule(static) reduction(+ : valid)
+        for (size_t c = 0; c < n; c += HASH_SLICE_N)
+        {
+            size_t m = std::min(HASH_SLICE_N, n - c);
+
+            verify_slice(proofs + c, m, results + c);
+            for (size_t j = 0; j < m; ++j)
+                valid += results[c + j];
+        }
+
+        return valid;
+    }
+
+    static std::vector<bool> verify_many(const std::vector<Proof> &proofs)
+    {
+        std::unique_ptr<bool[]> tmp{new bool[proofs.size()]};
+
+        verify_many(proofs.data(), proofs.size(), tmp.get());
+
+        return std::vector<bool>(tmp.get(), tmp.get() + proofs.size());
+    }
+};
@@ -0,0 +1,287 @@
+#pragma once
+
+#include "utils/hash_batch.hpp"
+#include "utils/string_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <omp.h>
+#include <vector>
+
+#if __cplusplus >= 202002L
+    #include <ranges>
+#endif
+
+/*
+Append-only Merkle tree with the shape of RFC 6962 (2.1): a tree of n leaves is split at the
+largest power of two k < n, the left subtree is complete and the right one holds the remaining
+n - k leaves. A leaf digest is the hash of one input block, an internal node is the hash of the
+concatenation of its children, exactly as in FixedMTree, so that a tree of 2^(h - 1) leaves has
+the same root as a FixedMTree<h, Hash>.
+*/
+template<typename Hash>
+class AppendMTree
+{
+private:
+    /*
+    levels[k] contains the digests of the complete subtrees of 2^k leaves, from left to right.
+    Any node of the tree (of the current size or of any previous one) is either one of these or
+    can be rebuilt from O(log n) of them.
+    */
+    std::vector<std::vector<uint8_t>> levels{};
+    size_t leaves_n = 0;
+    uint8_t root[Hash::DIGEST_SIZE]{};
+
+    static void hash_pair(uint8_t *digest, const uint8_t *left, const uint8_t *right)
+    {
+        uint8_t block[Hash::BLOCK_SIZE]{};
+
+        memcpy(block, left, Hash::DIGEST_SIZE);
+        memcpy(block + Hash::DIGEST_SIZE, right, Hash::DIGEST_SIZE);
+
+        Hash::hash_oneblock(digest, block);
+    }
+
+    // Largest power of two strictly smaller than n (n > 1)
+    static size_t split_point(size_t n)
+    {
+        size_t k = 1;
+
+        while (k << 1 < n)
+            k <<= 1;
+
+        return k;
+    }
+
+    // Root of the subtree spanning leaves [begin, end)
+    void subtree_root(uint8_t *digest, size_t begin, size_t end) const
+    {
+        size_t n = end - begin;
+
+        if ((n & (n - 1)) == 0 && begin % n == 0)
+        {
+            size_t level = __builtin_ctzll(n);
+
+            memcpy(digest, levels[level].data() + (begin >> level) * Hash::DIGEST_SIZE,
+                   Hash::DIGEST_SIZE);
+            return;
+        }
+
+        size_t k = split_point(n);
+        uint8_t left[Hash::DIGEST_SIZE];
+        uint8_t right[Hash::DIGEST_SIZE];
+
+        subtree_root(left, begin, begin + k);
+        subtree_root(right, begin + k, end);
+        hash_pair(digest, left, right);
+    }
+
+    // SUBPROOF(m, D[begin:end], complete) of RFC 6962 (2.1.2)
+    void subproof(std::vector<uint8_t> &proof, size_t m, size_t begin, size_t end,
+                  bool complete) const
+    {
+        size_t n = end - begin;
+        uint8_t digest[Hash::DIGEST_SIZE];
+
+        if (m == n)
+        {
+            if (!complete)
+            {
+                subtree_root(digest, begin, end);
+                proof.insert(proof.end(), digest, digest + Hash::DIGEST_SIZE);
+            }
+            return;
+        }
+
+        size_t k = split_point(n);
+
+        if (m <= k)
+        {
+            subproof(proof, m, begin, begin + k, complete);
+            subtree_root(digest, begin + k, end);
+        }
+        else
+        {
+            subproof(proof, m - k, begin + k, end, false);
+            subtree_root(digest, begin, begin + k);
+        }
+        proof.insert(proof.end(), digest, digest + Hash::DIGEST_SIZE);
+    }
+
+public:
+    AppendMTree() = default;
+
+#if __cplusplus >= 202002L
+    template<std::ranges::range Range>
+    AppendMTree(const Range &range) :
+        AppendMTree(std::ranges::cdata(range),
+                    std::ranges::size(range) * sizeof(*std::ranges::cdata(range)))
+    {}
+#endif
+
+    template<typename Iter>
+    AppendMTree(const Iter begin, const Iter end) :
+        AppendMTree(&*begin, std::distance(begin, end) * sizeof(*begin))
+    {}
+
+    AppendMTree(const void *vdata, size_t sz) { append(vdata, sz); }
+
+    // Append sz / BLOCK_SIZE leaves, hashing only the new nodes
+    void append(const void *vdata, size_t sz)
+    {
+        if (sz % Hash::BLOCK_SIZE != 0)
+        {
+            std::cerr << "AppendMTree: Bad size of input data\n";
+            return;
+        }
+
+        const uint8_t *data = (const uint8_t *)vdata;
+        size_t first = leaves_n;
+        size_t n = sz / Hash::BLOCK_SIZE;
+
+        if (n == 0)
+            return;
+
+        leaves_n += n;
+        if (levels.empty())
+            levels.emplace_back();
+        levels[0].resize(leaves_n * Hash::DIGEST_SIZE);
+
+        // add leaves
+#pragma omp parallel for
+        for (size_t c = 0; c < n; c += HASH_SLICE_N)
+            hash_many<Hash>(levels[0].data() + (first + c) * Hash::DIGEST_SIZE,
+                            data + Hash::BLOCK_SIZE * c, std::min(HASH_SLICE_N, n - c));
+
+        // complete the subtrees that the new leaves closed, bottom-up
+        for (size_t k = 1; leaves_n >> k; ++k)
+        {
+            if (levels.size() == k)
+                levels.emplace_back();
+
+            const uint8_t *lower = levels[k - 1].data();
+            size_t old_n = levels[k].size() / Hash::DIGEST_SIZE;
+            size_t new_n = leaves_n >> k;
+
+            levels[k].resize(new_n * Hash::DIGEST_SIZE);
+            uint8_t *upper = levels[k].data();
+
+#pragma omp parallel for
+            for (size_t c = old_n; c < new_n; c += HASH_SLICE_N)
+                hash_level<Hash>(upper + c * Hash::DIGEST_SIZE, lower + 2 * c * Hash::DIGEST_SIZE,
+                                 std::min(HASH_SLICE_N, new_n - c));
+        }
+
+        subtree_root(root, 0, leaves_n);
+    }
+
+    size_t size() const { return leaves_n; }
+
+    const uint8_t *digest() const { return root; }
+
+    // Root of the tree made of the first n leaves (i.e. the root the tree had at size n)
+    void digest_at(uint8_t *digest, size_t n) const
+    {
+        if (n == 0 || n > leaves_n)
+        {
+            std::cerr << "AppendMTree: Bad tree size\n";
+            return;
+        }
+
+        subtree_root(digest, 0, n);
+    }
+
+    // Digest of the i-th leaf
+    const uint8_t *get_leaf(size_t i) const { return levels[0].data() + i * Hash::DIGEST_SIZE; }
+
+    /*
+    Consistency proof between the tree made of the first old_n leaves and the current one,
+    as a sequence of digests (RFC 6962, 2.1.2). It contains at most ~2 log2(size()) digests.
+    */
+    std::vector<uint8_t> consistency_proof(size_t old_n) const
+    {
+        std::vector<uint8_t> proof{};
+
+        if (old_n == 0 || old_n > leaves_n)
+        {
+            std::cerr << "AppendMTree: Bad tree size\n";
+            return proof;
+        }
+
+        subproof(proof, old_n, 0, leaves_n, true);
+
+        return proof;
+    }
+
+    /*
+    Check that new_root (tree of new_n leaves) extends old_root (tree of old_n leaves).
+    This needs only the proof and O(log new_n) hashes (RFC 9162, 2.1.4.2).
+    */
+    static bool verify_consistency(size_t old_n, size_t new_n, const uint8_t *old_root,
+                                   const uint8_t *new_root, const void *vproof, size_t sz)
+    {
+        const uint8_t *proof = (const uint8_t *)vproof;
+        size_t len = sz / Hash::DIGEST_SIZE;
+        size_t i = 0;
+
+        if (sz % Hash::DIGEST_SIZE != 0 || old_n == 0 || old_n > new_n)
+            return false;
+
+        if (old_n == new_n)
+            return len == 0 && memcmp(old_root, new_root, Hash::DIGEST_SIZE) == 0;
+
+        // if old_n is a power of two, the old root is the implicit first node of the proof
+        const uint8_t *first = old_root;
+        if (old_n & (old_n - 1))
+        {
+            if (len == 0)
+                return false;
+            first = proof;
+            i = 1;
+        }
+
+        size_t fn = old_n - 1;
+        size_t sn = new_n - 1;
+
+        while (fn & 1)
+        {
+            fn >>= 1;
+            sn >>= 1;
+        }
+
+        uint8_t fr[Hash::DIGEST_SIZE];
+        uint8_t sr[Hash::DIGEST_SIZE];
+
+        memcpy(fr, first, Hash::DIGEST_SIZE);
+        memcpy(sr, first, Hash::DIGEST_SIZE);
+
+        for (; i < len; ++i)
+        {
+            const uint8_t *c = proof + i * Hash::DIGEST_SIZE;
+
+            if (sn == 0)
+                return false;
+
+            if ((fn & 1) || fn == sn)
+            {
+                hash_pair(fr, c, fr);
+                hash_pair(sr, c, sr);
+
+                while (!(fn & 1) && fn != 0)
+                {
+                    fn >>= 1;
+                    sn >>= 1;
+                }
+            }
+            else
+                hash_pair(sr, sr, c);
+
+            fn >>= 1;
+            sn >>= 1;
+        }
+
+        return sn == 0 && memcmp(fr, old_root, Hash::DIGEST_SIZE) == 0 &&
+               memcmp(sr, new_root, Hash::DIGEST_SIZE) == 0;
+    }
+};
@@ -0,0 +1,335 @@
+#pragma once
+
+#include "utils/cpu_features.hpp"
+#include "utils/hash_batch.hpp"
+
+#ifdef _WIN32
+    #include <intrin.h>
+#else
+    #include <x86intrin.h>
+#endif
+#include <cinttypes>
+
+/*
+BLAKE2s-256 (RFC 7693) of one block: the 64-byte block is compressed once, as the last block of
+an unkeyed 64-byte message, so hash_oneblock gives the standard BLAKE2s digest of the block. As
+for Sha256 used as a two-to-one hash, nothing else is padded or appended.
+*/
+class Blake2s
+{
+private:
+    // The four G of a column (or diagonal) step, on the rows of the work vector
+    CPU_TARGET("sse4.1")
+    static inline void g_sse41(__m128i row[4], __m128i x, __m128i y)
+    {
+        const __m128i rot16 = _mm_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+        const __m128i rot8 = _mm_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1);
+
+        row[0] = _mm_add_epi32(_mm_add_epi32(row[0], row[1]), x);
+        row[3] = _mm_shuffle_epi8(_mm_xor_si128(row[3], row[0]), rot16);
+        row[2] = _mm_add_epi32(row[2], row[3]);
+        row[1] = _mm_xor_si128(row[1], row[2]);
+        row[1] = _mm_or_si128(_mm_srli_epi32(row[1], 12), _mm_slli_epi32(row[1], 20));
+        row[0] = _mm_add_epi32(_mm_add_epi32(row[0], row[1]), y);
+        row[3] = _mm_shuffle_epi8(_mm_xor_si128(row[3], row[0]), rot8);
+        row[2] = _mm_add_epi32(row[2], row[3]);
+        row[1] = _mm_xor_si128(row[1], row[2]);
+        row[1] = _mm_or_si128(_mm_srli_epi32(row[1], 7), _mm_slli_epi32(row[1], 25));
+    }
+
+    CPU_TARGET("avx2")
+    static inline void g_x8(__m256i v[16], size_t a, size_t b, size_t c, size_t d, __m256i x,
+                            __m256i y)
+    {
+        const __m256i rot16 = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3,
+                                              2, 13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0,
+                                              3, 2);
+        const __m256i rot8 = _mm256_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1,
+                                             12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1);
+
+        v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a], v[b]), x);
+        v[d] = _mm256_shuffle_epi8(_mm256_xor_si256(v[d], v[a]), rot16);
+        v[c] = _mm256_add_epi32(v[c], v[d]);
+        v[b] = _mm256_xor_si256(v[b], v[c]);
+        v[b] = _mm256_or_si256(_mm256_srli_epi32(v[b], 12), _mm256_slli_epi32(v[b], 20));
+        v[a] = _mm256_add_epi32(_mm256_add_epi32(v[a], v[b]), y);
+        v[d] = _mm256_shuffle_epi8(_mm256_xor_si256(v[d], v[a]), rot8);
+        v[c] = _mm256_add_epi32(v[c], v[d]);
+        v[b] = _mm256_xor_si256(v[b], v[c]);
+        v[b] = _mm256_or_si256(_mm256_srli_epi32(v[b], 7), _mm256_slli_epi32(v[b], 25));
+    }
+
+    CPU_TARGET("avx512f")
+    static inline void g_x16(__m512i v[16], size_t a, size_t b, size_t c, size_t d, __m512i x,
+                             __m512i y)
+    {
+        v[a] = _mm512_add_epi32(_mm512_add_epi32(v[a], v[b]), x);
+        v[d] = _mm512_ror_epi32(_mm512_xor_si512(v[d], v[a]), 16);
+        v[c] = _mm512_add_epi32(v[c], v[d]);
+        v[b] = _mm512_ror_epi32(_mm512_xor_si512(v[b], v[c]), 12);
+        v[a] = _mm512_add_epi32(_mm512_add_epi32(v[a], v[b]), y);
+        v[d] = _mm512_ror_epi32(_mm512_xor_si512(v[d], v[a]), 8);
+        v[c] = _mm512_add_epi32(v[c], v[d]);
+        v[b] = _mm512_ror_epi32(_mm512_xor_si512(v[b], v[c]), 7);
+    }
+
+public:
+    static constexpr size_t BLOCK_SIZE = 64;
+    static constexpr size_t DIGEST_SIZE = 32;
+    static constexpr size_t ROUNDS_N = 10;
+
+    static constexpr uint32_t IV[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+
+    static constexpr uint8_t SIGMA[ROUNDS_N][16] = {
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+        {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+        {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+        {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+        {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+        {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+        {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+        {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+        {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+    };
+
+    // Chaining value: IV with the parameter block (32-byte digest, no key, fanout and depth 1)
+    static constexpr uint32_t H[8] = {
+        IV[0] ^ 0x01010000 ^ (uint32_t)DIGEST_SIZE, IV[1], IV[2], IV[3], IV[4], IV[5], IV[6],
+        IV[7],
+    };
+
+    // Initial work vector: counter t = BLOCK_SIZE and the final block flag
+    static constexpr uint32_t V[16] = {
+        H[0],  H[1],  H[2],  H[3],  H[4],  H[5],  H[6],  H[7],
+        IV[0], IV[1], IV[2], IV[3], IV[4] ^ (uint32_t)BLOCK_SIZE, IV[5], ~IV[6], IV[7],
+    };
+
+    Blake2s() = delete;
+
+    // Use the SSE4.1 kernel when the CPU has it, the portable code otherwise
+    static void hash_oneblock(uint8_t *digest, const void *message)
+    {
+        static const bool use_sse41 = CpuFeatures::get().sse41;
+
+        if (use_sse41)
+            hash_oneblock_sse41(digest, message);
+        else
+            hash_oneblock_scalar(digest, message);
+    }
+
+    static constexpr size_t LANES = 16;
+
+    /*
+    Hash n <= LANES independent blocks, blocks[i] into digests[i], with the fastest kernel of the
+    CPU: 16 lanes with AVX-512, 8 lanes with AVX2, one block at a time otherwise. Missing lanes
+    are filled with dummy work on the first block.
+    */
+    static void hash_oneblock_xN(uint8_t *const digests[], const void *const blocks[],
+                                 size_t n = LANES)
+    {
+        static const CpuFeatures &cpu = CpuFeatures::get();
+        static const size_t lanes = cpu.avx512f ? LANES_AVX512 : cpu.avx2 ? LANES_AVX2 : 1;
+
+        hash_oneblock_lanes<Blake2s>(digests, blocks, n, lanes, hash_oneblock_x16,
+                                     hash_oneblock_x8);
+    }
+
+    // Batch API (utils/hash_batch.hpp) on contiguous arrays, through the multi-buffer kernels
+    static void hash_many(uint8_t *out, const uint8_t *in, size_t n)
+    {
+        hash_many_lanes<Blake2s>(out, in, n);
+    }
+
+    static void hash_pairs(uint8_t *out, const uint8_t *left, const uint8_t *right, size_t n)
+    {
+        hash_pairs_lanes<Blake2s>(out, left, right, n);
+    }
+
+    static inline void g(uint32_t v[16], size_t a, size_t b, size_t c, size_t d, uint32_t x,
+                         uint32_t y)
+    {
+        v[a] = v[a] + v[b] + x;
+        v[d] = _rotr(v[d] ^ v[a], 16);
+        v[c] = v[c] + v[d];
+        v[b] = _rotr(v[b] ^ v[c], 12);
+        v[a] = v[a] + v[b] + y;
+        v[d] = _rotr(v[d] ^ v[a], 8);
+        v[c] = v[c] + v[d];
+        v[b] = _rotr(v[b] ^ v[c], 7);
+    }
+
+    static void hash_oneblock_scalar(uint8_t *digest, const void *message)
+    {
+        const uint32_t *m = (const uint32_t *)message;
+        uint32_t v[16];
+
+        for (size_t i = 0; i < 16; ++i)
+            v[i] = V[i];
+
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            const uint8_t *s = SIGMA[r];
+
+            g(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+            g(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+            g(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+            g(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+            g(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+            g(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+            g(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+            g(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+        }
+
+        for (size_t i = 0; i < 8; ++i)
+            ((uint32_t *)digest)[i] = H[i] ^ v[i] ^ v[i + 8];
+    }
+
+    /*
+    Same as hash_oneblock_scalar with the four G of a step in one register per row of the work
+    vector. The rows are rotated between the column and the diagonal steps.
+    */
+    CPU_TARGET("sse4.1")
+    static void hash_oneblock_sse41(uint8_t *digest, const void *message)
+    {
+        const uint32_t *m = (const uint32_t *)message;
+        __m128i row[4], x, y;
+
+        for (size_t i = 0; i < 4; ++i)
+            row[i] = _mm_loadu_si128((const __m128i *)&V[4 * i]);
+
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            const uint8_t *s = SIGMA[r];
+
+            x = _mm_set_epi32(m[s[6]], m[s[4]], m[s[2]], m[s[0]]);
+            y = _mm_set_epi32(m[s[7]], m[s[5]], m[s[3]], m[s[1]]);
+            g_sse41(row, x, y);
+
+            // rotate the rows, so that each diagonal is in one lane
+            row[1] = _mm_shuffle_epi32(row[1], _MM_SHUFFLE(0, 3, 2, 1));
+            row[2] = _mm_shuffle_epi32(row[2], _MM_SHUFFLE(1, 0, 3, 2));
+            row[3] = _mm_shuffle_epi32(row[3], _MM_SHUFFLE(2, 1, 0, 3));
+
+            x = _mm_set_epi32(m[s[14]], m[s[12]], m[s[10]], m[s[8]]);
+            y = _mm_set_epi32(m[s[15]], m[s[13]], m[s[11]], m[s[9]]);
+            g_sse41(row, x, y);
+
+            row[1] = _mm_shuffle_epi32(row[1], _MM_SHUFFLE(2, 1, 0, 3));
+            row[2] = _mm_shuffle_epi32(row[2], _MM_SHUFFLE(1, 0, 3, 2));
+            row[3] = _mm_shuffle_epi32(row[3], _MM_SHUFFLE(0, 3, 2, 1));
+        }
+
+        for (size_t i = 0; i < 2; ++i)
+            _mm_storeu_si128((__m128i *)digest + i,
+                             _mm_xor_si128(_mm_loadu_si128((const __m128i *)&H[4 * i]),
+                                           _mm_xor_si128(row[i], row[i + 2])));
+    }
+
+    /*
+    Multi-buffer kernels: LANES_AVX2 (resp. LANES_AVX512) independent blocks are hashed at once,
+    one block per 32-bit lane, with the message words transposed.
+    */
+    static constexpr size_t LANES_AVX2 = 8;
+    static constexpr size_t LANES_AVX512 = 16;
+
+    CPU_TARGET("avx2")
+    static void hash_oneblock_x8(uint8_t *const digests[LANES_AVX2],
+                                 const void *const blocks[LANES_AVX2])
+    {
+        const uint32_t *b[LANES_AVX2];
+        __m256i w[16];
+        __m256i v[16];
+
+        for (size_t l = 0; l < LANES_AVX2; ++l)
+            b[l] = (const uint32_t *)blocks[l];
+
+        for (size_t t = 0; t < 16; ++t)
+            w[t] = _mm256_set_epi32(b[7][t], b[6][t], b[5][t], b[4][t], b[3][t], b[2][t], b[1][t],
+                                    b[0][t]);
+
+        for (size_t i = 0; i < 16; ++i)
+            v[i] = _mm256_set1_epi32(V[i]);
+
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            const uint8_t *s = SIGMA[r];
+
+            g_x8(v, 0, 4, 8, 12, w[s[0]], w[s[1]]);
+            g_x8(v, 1, 5, 9, 13, w[s[2]], w[s[3]]);
+            g_x8(v, 2, 6, 10, 14, w[s[4]], w[s[5]]);
+            g_x8(v, 3, 7, 11, 15, w[s[6]], w[s[7]]);
+            g_x8(v, 0, 5, 10, 15, w[s[8]], w[s[9]]);
+            g_x8(v, 1, 6, 11, 12, w[s[10]], w[s[11]]);
+            g_x8(v, 2, 7, 8, 13, w[s[12]], w[s[13]]);
+            g_x8(v, 3, 4, 9, 14, w[s[14]], w[s[15]]);
+        }
+
+        alignas(32) uint32_t out[8][LANES_AVX2];
+
+        for (size_t i = 0; i < 8; ++i)
+            _mm256_store_si256((__m256i *)out[i],
+                               _mm256_xor_si256(_mm256_set1_epi32(H[i]),
+                                                _mm256_xor_si256(v[i], v[i + 8])));
+
+        for (size_t l = 0; l < LANES_AVX2; ++l)
+            for (size_t i = 0; i < 8; ++i)
+                ((uint32_t *)digests[l])[i] = out[i][l];
+    }
+
+    CPU_TARGET("avx512f")
+    static void hash_oneblock_x16(uint8_t *const digests[LANES_AVX512],
+                                  const void *const blocks[LANES_AVX512])
+    {
+        const uint32_t *b[LANES_AVX512];
+        __m512i w[16];
+        __m512i v[16];
+
+        for (size_t l = 0; l < LANES_AVX512; ++l)
+            b[l] = (const uint32_t *)blocks[l];
+
+        for (size_t t = 0; t < 16; ++t)
+            w[t] = _mm512_set_epi32(b[15][t], b[14][t], b[13][t], b[12][t], b[11][t], b[10][t],
+                                    b[9][t], b[8][t], b[7][t], b[6][t], b[5][t], b[4][t], b[3][t],
+                                    b[2][t], b[1][t], b[0][t]);
+
+        for (size_t i = 0; i < 16; ++i)
+            v[i] = _mm512_set1_epi32(V[i]);
+
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            const uint8_t *s = SIGMA[r];
+
+            g_x16(v, 0, 4, 8, 12, w[s[0]], w[s[1]]);
+            g_x16(v, 1, 5, 9, 13, w[s[2]], w[s[3]]);
+            g_x16(v, 2, 6, 10, 14, w[s[4]], w[s[5]]);
+            g_x16(v, 3, 7, 11, 15, w[s[6]], w[s[7]]);
+            g_x16(v, 0, 5, 10, 15, w[s[8]], w[s[9]]);
+            g_x16(v, 1, 6, 11, 12, w[s[10]], w[s[11]]);
+            g_x16(v, 2, 7, 8, 13, w[s[12]], w[s[13]]);
+            g_x16(v, 3, 4, 9, 14, w[s[14]], w[s[15]]);
+        }
+
+        alignas(64) uint32_t out[8][LANES_AVX512];
+
+        for (size_t i = 0; i < 8; ++i)
+            _mm512_store_si512(out[i], _mm512_xor_si512(_mm512_set1_epi32(H[i]),
+                                                        _mm512_xor_si512(v[i], v[i + 8])));
+
+        for (size_t l = 0; l < LANES_AVX512; ++l)
+            for (size_t i = 0; i < 8; ++i)
+                ((uint32_t *)digests[l])[i] = out[i][l];
+    }
+
+    static void hash_add(void *x, const void *y)
+    {
+        uint8_t *xb = (uint8_t *)x;
+        const uint8_t *yb = (const uint8_t *)y;
+
+        for (size_t i = 0; i < DIGEST_SIZE; ++i)
+            xb[i] ^= yb[i];
+    }
+};
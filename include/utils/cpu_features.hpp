@@ -0,0 +1,96 @@
+#pragma once
+
+#ifdef _WIN32
+    #include <intrin.h>
+#else
+    #include <cpuid.h>
+    #include <x86intrin.h>
+#endif
+#include <cinttypes>
+
+// Compile one function for an instruction set extension, regardless of -march
+#if defined(__GNUC__) || defined(__clang__)
+    #define CPU_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define CPU_TARGET(isa)
+#endif
+
+/*
+Instruction set extensions of the running CPU, detected once with cpuid. AVX/AVX-512 features
+are only reported if the OS also saves the corresponding registers (XCR0).
+*/
+struct CpuFeatures
+{
+    bool sse41 = false;
+    bool sha = false;
+    bool avx2 = false;
+    bool avx512f = false;
+    bool avx512bw = false;
+    bool avx512ifma = false;
+
+    static const CpuFeatures &get()
+    {
+        static const CpuFeatures features = detect();
+
+        return features;
+    }
+
+private:
+    static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+    {
+#ifdef _WIN32
+        int r[4];
+
+        __cpuidex(r, leaf, subleaf);
+        for (size_t i = 0; i < 4; ++i)
+            regs[i] = r[i];
+#else
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    }
+
+    static uint64_t xcr0()
+    {
+#ifdef _WIN32
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+
+        __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+        return ((uint64_t)edx << 32) | eax;
+#endif
+    }
+
+    static CpuFeatures detect()
+    {
+        CpuFeatures f;
+        uint32_t regs[4];
+
+        cpuid(0, 0, regs);
+        uint32_t max_leaf = regs[0];
+
+        if (max_leaf < 1)
+            return f;
+
+        cpuid(1, 0, regs);
+        f.sse41 = regs[2] & (1U << 19);
+
+        bool osxsave = regs[2] & (1U << 27);
+        uint64_t xcr = osxsave ? xcr0() : 0;
+        bool os_avx = (xcr & 0x6) == 0x6;      // XMM and YMM state
+        bool os_avx512 = (xcr & 0xe6) == 0xe6; // and opmask, ZMM state
+
+        if (max_leaf < 7)
+            return f;
+
+        cpuid(7, 0, regs);
+        f.sha = regs[1] & (1U << 29);
+        f.avx2 = os_avx && (regs[1] & (1U << 5));
+        f.avx512f = os_avx512 && (regs[1] & (1U << 16));
+        f.avx512bw = f.avx512f && (regs[1] & (1U << 30));
+        f.avx512ifma = f.avx512f && (regs[1] & (1U << 21));
+
+        return f;
+    }
+};
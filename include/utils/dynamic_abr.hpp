@@ -0,0 +1,147 @@
+#pragma once
+
+#include "utils/flat_abr.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#if __cplusplus >= 202002L
+    #include <ranges>
+#endif
+
+/*
+ABR whose height is chosen at runtime, holding any number of transactions. Transaction i goes to
+leaf i while there are leaves left, then to middle node i - leaves_n (in FixedAbr order). Padding
+rule: every leaf or middle node without a transaction gets the all-zero digest, no dummy block is
+hashed, and a tree without any transaction has no nodes and the all-zero root. By default the
+height is the smallest one (at least 3) whose capacity fits all the transactions; with exactly
+capacity() transactions the root is the same as FixedAbr.
+*/
+template<typename Hash>
+class DynamicAbr
+{
+public:
+    using Layout = FlatAbrLayout<Hash>;
+
+    static constexpr size_t MIN_HEIGHT = 3;
+    static constexpr size_t MAX_HEIGHT = 40;
+
+private:
+    Layout layout{};
+    size_t trans_n = 0;
+    std::vector<uint8_t> leaves{};
+    std::vector<uint8_t> middles{};
+    std::vector<uint8_t> internals{};
+
+public:
+    // Number of transactions held by an ABR of the given height
+    static constexpr size_t capacity(size_t height)
+    {
+        return (1ULL << (height - 1)) + (1ULL << (height - 2)) - 1;
+    }
+
+    // Smallest height holding n transactions
+    static constexpr size_t height_for(size_t n)
+    {
+        size_t height = MIN_HEIGHT;
+
+        while (capacity(height) < n)
+            ++height;
+
+        return height;
+    }
+
+    DynamicAbr() = default;
+
+#if __cplusplus >= 202002L
+    template<std::ranges::range Range>
+    DynamicAbr(const Range &range) :
+        DynamicAbr(std::ranges::cdata(range),
+                   std::ranges::size(range) * sizeof(*std::ranges::cdata(range)))
+    {}
+#endif
+
+    template<typename Iter>
+    DynamicAbr(const Iter begin, const Iter end) :
+        DynamicAbr(&*begin, std::distance(begin, end) * sizeof(*begin))
+    {}
+
+    DynamicAbr(const void *vdata, size_t sz) :
+        DynamicAbr(height_for(sz / Hash::BLOCK_SIZE), vdata, sz)
+    {}
+
+    DynamicAbr(size_t height, const void *vdata, size_t sz)
+    {
+        if (height < MIN_HEIGHT || height > MAX_HEIGHT)
+        {
+            std::cerr << "DynamicAbr: Bad tree height\n";
+            return;
+        }
+
+        if (sz % Hash::BLOCK_SIZE != 0 || sz / Hash::BLOCK_SIZE > capacity(height))
+        {
+            std::cerr << "DynamicAbr: Bad size of input data\n";
+            return;
+        }
+
+        // no transaction: the empty tree of the default constructor
+        if (sz == 0)
+            return;
+
+        const uint8_t *data = (const uint8_t *)vdata;
+
+        layout = Layout{height};
+        trans_n = sz / Hash::BLOCK_SIZE;
+
+        // padding digests are already zero
+        leaves.resize(layout.leaves_n * Hash::DIGEST_SIZE);
+        middles.resize(layout.internal_n * Hash::DIGEST_SIZE);
+        internals.resize((layout.leaves_n - 1) * Hash::DIGEST_SIZE);
+
+        // add leaves and middle nodes
+        size_t leaves_in = std::min(trans_n, layout.leaves_n);
+
+        Layout::hash_inputs(leaves.data(), data, leaves_in);
+        Layout::hash_inputs(middles.data(), data + leaves_in * Hash::BLOCK_SIZE,
+                            trans_n - leaves_in);
+        layout.build(internals.data(), leaves.data(), middles.data());
+    }
+
+    size_t height() const { return layout.height; }
+
+    // Number of transactions
+    size_t size() const { return trans_n; }
+
+    // Number of transactions the tree could hold with its height
+    size_t capacity() const { return layout.leaves_n + layout.internal_n; }
+
+    // Root, or the all-zero padding digest for an empty (or rejected) tree
+    const uint8_t *digest() const
+    {
+        static const uint8_t zero[Hash::DIGEST_SIZE]{};
+
+        if (internals.empty())
+            return zero;
+
+        return &internals[(layout.leaves_n - 2) * Hash::DIGEST_SIZE];
+    }
+
+    const uint8_t *get_leaf(size_t i) const { return &leaves[i * Hash::DIGEST_SIZE]; }
+
+    const uint8_t *get_middle(size_t i) const { return &middles[i * Hash::DIGEST_SIZE]; }
+
+    const uint8_t *get_internal(size_t i) const { return &internals[i * Hash::DIGEST_SIZE]; }
+
+    // Digest of node i, numbered as in FixedAbr (leaves, then middles, then internal nodes)
+    const uint8_t *get_digest(size_t i) const
+    {
+        if (i < layout.leaves_n)
+            return get_leaf(i);
+        if (i < capacity())
+            return get_middle(i - layout.leaves_n);
+
+        return get_internal(i - capacity());
+    }
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <libff/common/default_types/ec_pp.hpp>
+
+/*
+Initialize the parameters of libff::default_ec_pp once per program, on first use. The flag is a
+function-local static, so this works from any static initializer, whatever the order of
+initialization of the translation units (and is thread-safe).
+*/
+inline bool init_ec_params()
+{
+    static const bool done = (libff::default_ec_pp::init_public_params(), true);
+
+    return done;
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include <cstring>
+#include <gmp.h>
+#include <libff/algebra/fields/bigint.hpp>
+
+/*
+Conversions between field elements and their big-endian encoding (num_limbs * 8 bytes, right
+aligned), without GMP integers nor heap allocations: bytes are loaded into the limbs of a
+libff::bigint, which the Fp_model constructor brings into Montgomery form (one multiplication by
+R^2), and as_bigint() brings back out. Encodings of values >= p are reduced modulo p.
+The former mpz_export encoding left aligned the values below 2^248: MiMC digests (and roots of
+trees over them) computed before this class differ whenever such a value appears.
+*/
+template<typename FieldT>
+class FieldBytes
+{
+public:
+    static constexpr size_t LIMBS = FieldT::num_limbs;
+    static constexpr size_t SIZE = LIMBS * sizeof(mp_limb_t);
+
+    using Bigint = libff::bigint<LIMBS>;
+
+    static_assert(sizeof(mp_limb_t) == 8, "64-bit limbs expected");
+
+    // Big-endian bytes to limbs, least significant limb first
+    static void load(Bigint &x, const void *bytes)
+    {
+        const uint8_t *p = (const uint8_t *)bytes;
+
+        for (size_t i = 0; i < LIMBS; ++i)
+        {
+            mp_limb_t limb = 0;
+
+            for (size_t j = 0; j < sizeof(mp_limb_t); ++j)
+                limb = limb << 8 | p[i * sizeof(mp_limb_t) + j];
+            x.data[LIMBS - 1 - i] = limb;
+        }
+    }
+
+    static void store(void *bytes, const Bigint &x)
+    {
+        uint8_t *p = (uint8_t *)bytes;
+
+        for (size_t i = 0; i < LIMBS; ++i)
+        {
+            mp_limb_t limb = x.data[LIMBS - 1 - i];
+
+            for (size_t j = sizeof(mp_limb_t); j-- > 0; limb >>= 8)
+                p[i * sizeof(mp_limb_t) + j] = (uint8_t)limb;
+        }
+    }
+
+    static FieldT to_field(const void *bytes)
+    {
+        Bigint x;
+
+        load(x, bytes);
+
+        return FieldT{x};
+    }
+
+    static void from_field(void *bytes, const FieldT &x) { store(bytes, x.as_bigint()); }
+
+    // x = (x + y) mod p on the encodings, as an integer addition (no Montgomery conversion)
+    static void add(void *x, const void *y)
+    {
+        Bigint a, b;
+
+        load(a, x);
+        load(b, y);
+        reduce(a);
+        reduce(b);
+
+        mp_limb_t carry = 0;
+
+        for (size_t i = 0; i < LIMBS; ++i)
+        {
+            unsigned __int128 s = (unsigned __int128)a.data[i] + b.data[i] + carry;
+
+            a.data[i] = (mp_limb_t)s;
+            carry = (mp_limb_t)(s >> 64);
+        }
+        if (carry || !less_than_mod(a))
+            sub_mod(a);
+
+        store(x, a);
+    }
+
+private:
+    static bool less_than_mod(const Bigint &x)
+    {
+        for (size_t i = LIMBS; i-- > 0;)
+            if (x.data[i] != FieldT::mod.data[i])
+                return x.data[i] < FieldT::mod.data[i];
+
+        return false;
+    }
+
+    // x -= p, modulo 2^(64 * LIMBS)
+    static void sub_mod(Bigint &x)
+    {
+        mp_limb_t borrow = 0;
+
+        for (size_t i = 0; i < LIMBS; ++i)
+        {
+            unsigned __int128 d = (unsigned __int128)x.data[i] - FieldT::mod.data[i] - borrow;
+
+            x.data[i] = (mp_limb_t)d;
+            borrow = (mp_limb_t)(d >> 64) & 1;
+        }
+    }
+
+    static void reduce(Bigint &x)
+    {
+        while (!less_than_mod(x))
+            sub_mod(x);
+    }
+};
+
+
+/*
+Table of constant field elements in Montgomery form, as generated by utils/mimc_constants.py and
+utils/poseidon_constants.py (LIMBS little-endian 64-bit limbs per element). The limbs of an element
+are copied into the mont_repr of a FieldT on access, so the tables are never read through FieldT
+lvalues and need no initialization.
+*/
+template<typename FieldT>
+class MontTable
+{
+public:
+    using Limbs = uint64_t[FieldT::num_limbs];
+
+    constexpr MontTable(const Limbs *limbs) : limbs{limbs} {}
+
+    FieldT operator[](size_t i) const
+    {
+        FieldT x;
+
+        static_assert(sizeof(x.mont_repr.data) == sizeof(Limbs), "Unexpected FieldT layout");
+        memcpy(x.mont_repr.data, limbs[i], sizeof(Limbs));
+
+        return x;
+    }
+
+private:
+    const Limbs *limbs;
+};
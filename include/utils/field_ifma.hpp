@@ -0,0 +1,278 @@
+#pragma once
+
+#include "utils/cpu_features.hpp"
+#include "utils/field_bytes.hpp"
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+#include <immintrin.h>
+#include <vector>
+
+// Instruction sets of the FieldIfma functions, for the kernels built on them
+#define IFMA_TARGET "avx512f,avx512ifma"
+
+/*
+8-lane Montgomery arithmetic with AVX-512 IFMA in a prime field of 4 limbs (BN254 Fr). A Vec
+holds 8 field elements as 5 limbs of 52 bits, limb j of all the lanes in one register, and a
+product is computed in radix 2^52 with vpmadd52luq/vpmadd52huq, with R' = 2^260. Elements are
+brought from the Montgomery form of libff (R = 2^256) into this one by load() and back by
+store(), so that results are bit-for-bit the same as with FieldT. Every operation returns a
+fully reduced element.
+The vector functions must only be called if CpuFeatures::avx512ifma is set, from functions
+compiled with CPU_TARGET(IFMA_TARGET).
+*/
+template<typename FieldT>
+class FieldIfma
+{
+public:
+    static constexpr size_t LANES = 8;
+    static constexpr size_t LIMBS = 5;
+    static constexpr uint64_t MASK = (1ULL << 52) - 1;
+
+    using Bytes = FieldBytes<FieldT>;
+    using Limbs = std::array<uint64_t, LIMBS>;
+
+    static_assert(Bytes::LIMBS == 4, "Fields of 4 limbs expected");
+
+    struct Vec
+    {
+        __m512i l[LIMBS];
+    };
+
+    struct Constants
+    {
+        Limbs p;
+        uint64_t pinv;  // -p^-1 mod 2^52
+        Limbs to_mont;  // 2^264 mod p, from R to R'
+        Limbs from_mont; // 2^256 mod p, from R' to R
+    };
+
+    FieldIfma() = delete;
+
+    // Computed on first use, once the field parameters are initialized
+    static const Constants &constants()
+    {
+        static const Constants c = make_constants();
+
+        return c;
+    }
+
+    // 4 limbs of 64 bits into 5 limbs of 52 bits
+    static Limbs split(const mp_limb_t d[4])
+    {
+        return {d[0] & MASK, (d[0] >> 52 | d[1] << 12) & MASK, (d[1] >> 40 | d[2] << 24) & MASK,
+                (d[2] >> 28 | d[3] << 36) & MASK, d[3] >> 16};
+    }
+
+    static void join(mp_limb_t d[4], const Limbs &l)
+    {
+        d[0] = l[0] | l[1] << 52;
+        d[1] = l[1] >> 12 | l[2] << 40;
+        d[2] = l[2] >> 24 | l[3] << 28;
+        d[3] = l[3] >> 36 | l[4] << 16;
+    }
+
+    /*
+    a < 2p with unnormalized limbs (< 2^63): propagate the carries and subtract p if a >= p.
+    The top limb of a normalized value < 2p has less than 52 bits.
+    */
+    CPU_TARGET(IFMA_TARGET)
+    static inline void reduce(Vec &a, const Constants &c)
+    {
+        const __m512i mask = _mm512_set1_epi64(MASK);
+        __m512i d[LIMBS];
+        __m512i borrow = _mm512_setzero_si512();
+
+        for (size_t j = 0; j < LIMBS - 1; ++j)
+        {
+            a.l[j + 1] = _mm512_add_epi64(a.l[j + 1], _mm512_srli_epi64(a.l[j], 52));
+            a.l[j] = _mm512_and_si512(a.l[j], mask);
+        }
+
+        for (size_t j = 0; j < LIMBS; ++j)
+        {
+            d[j] = _mm512_sub_epi64(_mm512_add_epi64(a.l[j], borrow), _mm512_set1_epi64(c.p[j]));
+            borrow = _mm512_srai_epi64(d[j], 52);
+            d[j] = _mm512_and_si512(d[j], mask);
+        }
+
+        __mmask8 ge = _mm512_cmpge_epi64_mask(borrow, _mm512_setzero_si512());
+
+        for (size_t j = 0; j < LIMBS; ++j)
+            a.l[j] = _mm512_mask_blend_epi64(ge, a.l[j], d[j]);
+    }
+
+    // a = a * b / R' mod p, a and b < p (a and b may be the same)
+    CPU_TARGET(IFMA_TARGET)
+    static inline void mul(Vec &a, const Vec &b, const Constants &c)
+    {
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i pinv = _mm512_set1_epi64(c.pinv);
+        __m512i t[LIMBS + 1];
+
+        for (size_t j = 0; j <= LIMBS; ++j)
+            t[j] = zero;
+
+        for (size_t i = 0; i < LIMBS; ++i)
+        {
+            for (size_t j = 0; j < LIMBS; ++j)
+            {
+                t[j] = _mm512_madd52lo_epu64(t[j], a.l[j], b.l[i]);
+                t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a.l[j], b.l[i]);
+            }
+
+            // m * p cancels the low 52 bits of t
+            __m512i m = _mm512_madd52lo_epu64(zero, t[0], pinv);
+
+            for (size_t j = 0; j < LIMBS; ++j)
+            {
+                __m512i p = _mm512_set1_epi64(c.p[j]);
+
+                t[j] = _mm512_madd52lo_epu64(t[j], m, p);
+                t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, p);
+            }
+
+            t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+            for (size_t j = 0; j < LIMBS; ++j)
+                t[j] = t[j + 1];
+            t[LIMBS] = zero;
+        }
+
+        for (size_t j = 0; j < LIMBS; ++j)
+            a.l[j] = t[j];
+        reduce(a, c);
+    }
+
+    // Multiply all the lanes by the same element, given by its limbs (see to_limbs)
+    CPU_TARGET(IFMA_TARGET)
+    static inline void mul(Vec &a, const Limbs &b, const Constants &c)
+    {
+        Vec t;
+
+        for (size_t j = 0; j < LIMBS; ++j)
+            t.l[j] = _mm512_set1_epi64(b[j]);
+        mul(a, t, c);
+    }
+
+    CPU_TARGET(IFMA_TARGET)
+    static inline void cube(Vec &a, const Constants &c)
+    {
+        Vec t{a};
+
+        mul(a, t, c);
+        mul(a, t, c);
+    }
+
+    CPU_TARGET(IFMA_TARGET)
+    static inline void add(Vec &a, const Vec &b, const Constants &c)
+    {
+        for (size_t j = 0; j < LIMBS; ++j)
+            a.l[j] = _mm512_add_epi64(a.l[j], b.l[j]);
+        reduce(a, c);
+    }
+
+    // Add the same element, given by its limbs (see to_limbs), to all the lanes
+    CPU_TARGET(IFMA_TARGET)
+    static inline void add(Vec &a, const Limbs &b, const Constants &c)
+    {
+        for (size_t j = 0; j < LIMBS; ++j)
+            a.l[j] = _mm512_add_epi64(a.l[j], _mm512_set1_epi64(b[j]));
+        reduce(a, c);
+    }
+
+    CPU_TARGET(IFMA_TARGET)
+    static inline void load(Vec &a, const FieldT x[LANES], const Constants &c)
+    {
+        alignas(64) uint64_t l[LIMBS][LANES];
+        Vec r;
+
+        for (size_t k = 0; k < LANES; ++k)
+        {
+            Limbs xl = split(x[k].mont_repr.data);
+
+            for (size_t j = 0; j < LIMBS; ++j)
+                l[j][k] = xl[j];
+        }
+
+        for (size_t j = 0; j < LIMBS; ++j)
+        {
+            a.l[j] = _mm512_load_si512(l[j]);
+            r.l[j] = _mm512_set1_epi64(c.to_mont[j]);
+        }
+        mul(a, r, c);
+    }
+
+    CPU_TARGET(IFMA_TARGET)
+    static inline void store(FieldT x[LANES], const Vec &a, const Constants &c)
+    {
+        alignas(64) uint64_t l[LIMBS][LANES];
+        Vec t{a}, r;
+
+        for (size_t j = 0; j < LIMBS; ++j)
+            r.l[j] = _mm512_set1_epi64(c.from_mont[j]);
+        mul(t, r, c);
+
+        for (size_t j = 0; j < LIMBS; ++j)
+            _mm512_store_si512(l[j], t.l[j]);
+
+        for (size_t k = 0; k < LANES; ++k)
+        {
+            Limbs xl;
+
+            for (size_t j = 0; j < LIMBS; ++j)
+                xl[j] = l[j][k];
+            join(x[k].mont_repr.data, xl);
+        }
+    }
+
+    // Limbs of n elements in the Montgomery form of FieldIfma, for constants added with add()
+    CPU_TARGET(IFMA_TARGET)
+    static std::vector<Limbs> to_limbs(const FieldT *x, size_t n)
+    {
+        const Constants &c = constants();
+        std::vector<Limbs> out(n);
+        alignas(64) uint64_t l[LIMBS][LANES];
+
+        for (size_t i = 0; i < n; i += LANES)
+        {
+            FieldT lanes[LANES]{};
+            Vec a;
+
+            for (size_t k = 0; k < LANES && i + k < n; ++k)
+                lanes[k] = x[i + k];
+            load(a, lanes, c);
+
+            for (size_t j = 0; j < LIMBS; ++j)
+                _mm512_store_si512(l[j], a.l[j]);
+            for (size_t k = 0; k < LANES && i + k < n; ++k)
+                for (size_t j = 0; j < LIMBS; ++j)
+                    out[i + k][j] = l[j][k];
+        }
+
+        return out;
+    }
+
+private:
+    static Constants make_constants()
+    {
+        Constants c;
+        uint8_t r[Bytes::SIZE];
+        typename Bytes::Bigint b;
+
+        c.p = split(FieldT::mod.data);
+        c.pinv = FieldT::inv & MASK;
+
+        // R mod p is the Montgomery form of 1, and 2^8 R mod p is obtained by doublings
+        b = FieldT::one().mont_repr;
+        c.from_mont = split(b.data);
+
+        Bytes::store(r, b);
+        for (size_t i = 0; i < 8; ++i)
+            Bytes::add(r, r);
+        Bytes::load(b, r);
+        c.to_mont = split(b.data);
+
+        return c;
+    }
+};
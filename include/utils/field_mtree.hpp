@@ -0,0 +1,222 @@
+#pragma once
+
+#include "utils/ec_params.hpp"
+#include "utils/field_bytes.hpp"
+#include "utils/hash_batch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <omp.h>
+#include <vector>
+
+#if __cplusplus >= 202002L
+    #include <ranges>
+#endif
+
+/*
+Field-native view of a MiMC or Poseidon policy: a digest is DIGEST_N field elements (1 for Mimc256
+and Poseidon256, the branches of a MimcFeistel variant) and a node is hashed with Hash::hash_field
+directly, so that digests never leave the Montgomery form. Hashing a block gives the same digest
+as Hash::hash_oneblock.
+*/
+template<typename Hash>
+class FieldHash
+{
+public:
+    using FieldT = typename Hash::FieldT;
+    using Bytes = FieldBytes<FieldT>;
+
+    static constexpr size_t DIGEST_N = Hash::DIGEST_SIZE / Bytes::SIZE;
+
+    using Digest = std::array<FieldT, DIGEST_N>;
+
+    FieldHash() = delete;
+
+    static Digest hash(const Digest &left, const Digest &right)
+    {
+        if constexpr (DIGEST_N == 1)
+            return {Hash::hash_field(left[0], right[0])};
+        else
+            return Hash::hash_field(concat(left, right));
+    }
+
+    /*
+    out[i] = hash(lower[2i], lower[2i + 1]) for n nodes, Hash::LANES at a time through the
+    interleaved kernel Hash::hash_field_xN
+    */
+    static void hash_level(Digest *out, const Digest *lower, size_t n)
+    {
+        constexpr size_t LANES = Hash::LANES;
+
+        for (size_t c = 0; c < n; c += LANES)
+        {
+            size_t m = std::min(LANES, n - c);
+
+            if constexpr (DIGEST_N == 1)
+            {
+                FieldT x[LANES]{}, y[LANES]{}, h[LANES];
+
+                for (size_t l = 0; l < m; ++l)
+                {
+                    x[l] = lower[2 * (c + l)][0];
+                    y[l] = lower[2 * (c + l) + 1][0];
+                }
+                Hash::hash_field_xN(h, x, y);
+                for (size_t l = 0; l < m; ++l)
+                    out[c + l] = {h[l]};
+            }
+            else
+            {
+                typename Hash::Block x[LANES]{};
+                Digest h[LANES];
+
+                for (size_t l = 0; l < m; ++l)
+                    x[l] = concat(lower[2 * (c + l)], lower[2 * (c + l) + 1]);
+                Hash::hash_field_xN(h, x);
+                std::copy(h, h + m, out + c);
+            }
+        }
+    }
+
+    static Digest from_bytes(const void *bytes)
+    {
+        Digest d;
+
+        init_ec_params();
+
+        for (size_t i = 0; i < DIGEST_N; ++i)
+            d[i] = Bytes::to_field((const uint8_t *)bytes + i * Bytes::SIZE);
+
+        return d;
+    }
+
+    static void to_bytes(void *bytes, const Digest &d)
+    {
+        for (size_t i = 0; i < DIGEST_N; ++i)
+            Bytes::from_field((uint8_t *)bytes + i * Bytes::SIZE, d[i]);
+    }
+
+    static std::array<FieldT, 2 * DIGEST_N> concat(const Digest &left, const Digest &right)
+    {
+        std::array<FieldT, 2 * DIGEST_N> x;
+
+        std::copy(left.begin(), left.end(), x.begin());
+        std::copy(right.begin(), right.end(), x.begin() + DIGEST_N);
+
+        return x;
+    }
+
+    // Digest of one input block of BLOCK_SIZE bytes
+    static Digest hash_block(const void *block)
+    {
+        return hash(from_bytes(block), from_bytes((const uint8_t *)block + Hash::DIGEST_SIZE));
+    }
+};
+
+
+/*
+Merkle tree with the shape and the digests of FixedMTree, over a field-native hash: nodes are kept
+as FieldHash<Hash>::Digest, the parents read the field elements of their children directly, and
+bytes only appear at the boundary (input blocks and digest()). Nodes layout is the same as
+FixedMTree: the LEAVES_N leaves, then each upper level, the root being the last one.
+*/
+template<size_t height, typename Hash>
+class FieldMTree
+{
+public:
+    using Field = FieldHash<Hash>;
+    using FieldT = typename Field::FieldT;
+    using Digest = typename Field::Digest;
+
+    static constexpr size_t LEAVES_N = 1ULL << (height - 1);
+    static constexpr size_t NODES_N = (1ULL << height) - 1;
+    static constexpr size_t INPUT_SIZE = LEAVES_N * Hash::BLOCK_SIZE;
+
+private:
+    std::vector<Digest> nodes{};
+    uint8_t root_bytes[Hash::DIGEST_SIZE]{};
+
+    static constexpr size_t level_offset(size_t level)
+    {
+        return 2 * LEAVES_N - (2 * LEAVES_N >> level);
+    }
+
+public:
+    FieldMTree() = default;
+
+#if __cplusplus >= 202002L
+    template<std::ranges::range Range>
+    FieldMTree(const Range &range) :
+        FieldMTree(std::ranges::cdata(range),
+                   std::ranges::size(range) * sizeof(*std::ranges::cdata(range)))
+    {}
+#endif
+
+    template<typename Iter>
+    FieldMTree(const Iter begin, const Iter end) :
+        FieldMTree(&*begin, std::distance(begin, end) * sizeof(*begin))
+    {}
+
+    FieldMTree(const void *vdata, size_t sz) : nodes(NODES_N)
+    {
+        if (sz != INPUT_SIZE)
+        {
+            std::cerr << "FieldMTree: Bad size of input data\n";
+            return;
+        }
+
+        init_ec_params();
+
+        const uint8_t *data = (const uint8_t *)vdata;
+
+        // an input block is the encoding of two digests, hashed like an upper level
+#pragma omp parallel for
+        for (size_t c = 0; c < LEAVES_N; c += HASH_SLICE_N)
+        {
+            size_t m = std::min(HASH_SLICE_N, LEAVES_N - c);
+            Digest halves[2 * HASH_SLICE_N];
+
+            for (size_t i = 0; i < 2 * m; ++i)
+                halves[i] = Field::from_bytes(data + Hash::DIGEST_SIZE * (2 * c + i));
+            Field::hash_level(&nodes[c], halves, m);
+        }
+
+        for (size_t level = 1; level < height; ++level)
+        {
+            Digest *lower = &nodes[level_offset(level - 1)];
+            Digest *upper = &nodes[level_offset(level)];
+            size_t n = LEAVES_N >> level;
+
+#pragma omp parallel for
+            for (size_t c = 0; c < n; c += HASH_SLICE_N)
+                Field::hash_level(upper + c, lower + 2 * c, std::min(HASH_SLICE_N, n - c));
+        }
+
+        Field::to_bytes(root_bytes, nodes.back());
+    }
+
+    // Root as bytes, the same as FixedMTree::digest()
+    const uint8_t *digest() const { return root_bytes; }
+
+    const Digest &root() const { return nodes.back(); }
+
+    const Digest &get_node(size_t i) const { return nodes[i]; }
+
+    /*
+    Siblings of the path from leaf idx to the root (height - 1 digests, from the leaves up), in
+    the order of the `other` witnesses of MTree_Gadget
+    */
+    void get_path(size_t idx, Digest *other) const
+    {
+        if (idx >= LEAVES_N)
+        {
+            std::cerr << "FieldMTree: Bad index\n";
+            return;
+        }
+
+        for (size_t level = 0; level < height - 1; ++level, idx >>= 1)
+            other[level] = nodes[level_offset(level) + (idx ^ 1)];
+    }
+};
@@ -1,9 +1,13 @@
 #pragma once
 
+#include "utils/hash_batch.hpp"
 #include "utils/string_utils.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include <iostream>
+#include <omp.h>
 #include <vector>
 
 #if __cplusplus >= 202002L
@@ -103,11 +107,70 @@ private:
     std::vector<Node> nodes{};
     Node *root = nullptr;
 
+    /*
+    Recompute the digests of n <= HASH_SLICE_N (already linked) nodes of internal layer t from
+    their children, hashing them at once
+    */
+    static void rehash(size_t t, Node *const *targets, size_t n)
+    {
+        uint8_t block[HASH_SLICE_N][Hash::BLOCK_SIZE]{};
+        uint8_t out[HASH_SLICE_N][Hash::DIGEST_SIZE];
+
+        for (size_t j = 0; j < n; ++j)
+        {
+            const Node &node = *targets[j];
+
+            memcpy(block[j], node.l->digest, Hash::DIGEST_SIZE);
+            memcpy(block[j] + Hash::DIGEST_SIZE, node.r->digest, Hash::DIGEST_SIZE);
+            if (t > 0)
+            {
+                Hash::hash_add(block[j], node.e->digest);
+                Hash::hash_add(block[j] + Hash::DIGEST_SIZE, node.e->digest);
+            }
+        }
+        hash_many<Hash>(out[0], block[0], n);
+
+        for (size_t j = 0; j < n; ++j)
+        {
+            memcpy(targets[j]->digest, out[j], Hash::DIGEST_SIZE);
+            if (t > 0)
+                Hash::hash_add(targets[j]->digest, targets[j]->r->digest);
+        }
+    }
+
 public:
     static constexpr size_t INTERNAL_N = (1ULL << (height - 2)) - 1;
     static constexpr size_t LEAVES_N = 1ULL << (height - 1);
     static constexpr size_t INPUT_N = LEAVES_N + INTERNAL_N;
     static constexpr size_t INPUT_SIZE = INPUT_N * Hash::BLOCK_SIZE;
+    static constexpr size_t PATH_SIZE = (height - 2) * Hash::DIGEST_SIZE;
+
+    // offset of the t-th internal layer (0 is the one just above the leaves)
+    static constexpr size_t layer_offset(size_t t)
+    {
+        return INPUT_N + LEAVES_N - (LEAVES_N >> t);
+    }
+
+    // offset of the middle nodes of the t-th internal layer (t > 0)
+    static constexpr size_t middle_offset(size_t t)
+    {
+        return LEAVES_N + LEAVES_N / 2 - (LEAVES_N >> t);
+    }
+
+    // Internal layer and position of the node owning the middle node idx
+    static constexpr void middle_position(size_t idx, size_t &layer, size_t &pos)
+    {
+        size_t count = LEAVES_N / 4;
+
+        layer = 1;
+        pos = idx - LEAVES_N;
+        while (pos >= count)
+        {
+            pos -= count;
+            count /= 2;
+            ++layer;
+        }
+    }
 
     FixedAbr() = default;
 
@@ -182,56 +245,58 @@ public:
                 }
             }
         }
-        else // parallel code
+        else // parallel code, by slices of HASH_SLICE_N nodes hashed at once
         {
             // add leaves and middle nodes
 #pragma omp parallel for
-            for (size_t i = 0; i < INPUT_N; ++i)
-                this->nodes[i] = Node{data + Hash::BLOCK_SIZE * i, depth};
-            last = INPUT_N;
-
-
-            // build first internal layer (only hash, no addition)
-            --depth;
-            for (size_t i = 0; i < LEAVES_N; i += 2)
+            for (size_t c = 0; c < INPUT_N; c += HASH_SLICE_N)
             {
-                this->nodes[last] = Node{this->nodes[i].digest, this->nodes[i + 1].digest, depth};
+                size_t n = std::min(HASH_SLICE_N, INPUT_N - c);
+                uint8_t out[HASH_SLICE_N][Hash::DIGEST_SIZE];
 
-                this->nodes[last].l = &this->nodes[i];
-                this->nodes[last].r = &this->nodes[i + 1];
-                this->nodes[i].f = &this->nodes[last];
-                this->nodes[i + 1].f = &this->nodes[last];
-                ++last;
+                hash_many<Hash>(out[0], data + Hash::BLOCK_SIZE * c, n);
+                for (size_t j = 0; j < n; ++j)
+                {
+                    this->nodes[c + j].depth = depth;
+                    memcpy(this->nodes[c + j].digest, out[j], Hash::DIGEST_SIZE);
+                }
             }
+            last = INPUT_N;
 
-            for (size_t i = INPUT_N, len = i + LEAVES_N / 2, e = LEAVES_N; depth > 0;
-                 len += 1ULL << depth)
+            // build the internal layers, the first one has no middle nodes (only hash, no addition)
+            for (size_t t = 0, i = 0, e = LEAVES_N, iters = LEAVES_N / 2; depth > 0;
+                 ++t, iters /= 2)
             {
                 --depth;
-                size_t iters = (len - i) >> 1;
 #pragma omp parallel for
-                for (size_t j = 0; j < iters; ++j)
+                for (size_t c = 0; c < iters; c += HASH_SLICE_N)
                 {
-                    size_t k = i + j * 2;
-                    size_t l = last + j;
-                    size_t f = e + j;
-
-                    this->nodes[l] = Node{this->nodes[k].digest, this->nodes[k + 1].digest,
-                                          this->nodes[f].digest, depth};
-
-                    this->nodes[l].l = &this->nodes[k];
-                    this->nodes[l].e = &this->nodes[f];
-                    this->nodes[l].r = &this->nodes[k + 1];
-
-                    this->nodes[l].e->depth = depth + 1;
-
-                    this->nodes[k].f = &this->nodes[l];
-                    this->nodes[f].f = &this->nodes[l];
-                    this->nodes[k + 1].f = &this->nodes[l];
+                    size_t n = std::min(HASH_SLICE_N, iters - c);
+                    Node *targets[HASH_SLICE_N];
+
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        size_t k = i + (c + j) * 2;
+                        Node &node = this->nodes[last + c + j];
+
+                        node.depth = depth;
+                        node.l = &this->nodes[k];
+                        node.r = &this->nodes[k + 1];
+                        node.l->f = &node;
+                        node.r->f = &node;
+                        if (t > 0)
+                        {
+                            node.e = &this->nodes[e + c + j];
+                            node.e->f = &node;
+                            node.e->depth = depth + 1;
+                        }
+                        targets[j] = &node;
+                    }
+                    rehash(t, targets, n);
                 }
-                i += iters * 2;
+                i = t == 0 ? INPUT_N : i + iters * 2;
+                e += t == 0 ? 0 : iters;
                 last += iters;
-                e += iters;
             }
         }
     }
@@ -246,6 +311,127 @@ public:
         return &nodes[i];
     }
 
+    // Replace the leaf or middle node idx with a new block and update its ancestors
+    void update(size_t idx, const void *block) { update_many(&idx, 1, block, Hash::BLOCK_SIZE); }
+
+    /*
+    Replace the leaf or middle nodes indices[0..n) with the sz / BLOCK_SIZE blocks of vdata (if an
+    index is repeated, the last block wins). Only the ancestors of the updated nodes are
+    recomputed: they are deduplicated and rehashed layer by layer in parallel.
+    */
+    void update_many(const size_t *indices, size_t n, const void *vdata, size_t sz)
+    {
+        if (sz != n * Hash::BLOCK_SIZE)
+        {
+            std::cerr << "FixedAbr: Bad size of input data\n";
+            return;
+        }
+
+        for (size_t i = 0; i < n; ++i)
+            if (indices[i] >= INPUT_N)
+            {
+                std::cerr << "FixedAbr: Bad index\n";
+                return;
+            }
+
+        const uint8_t *data = (const uint8_t *)vdata;
+        std::vector<uint8_t> fresh(n * Hash::DIGEST_SIZE);
+        std::vector<std::vector<size_t>> dirty(height - 1);
+
+#pragma omp parallel for
+        for (size_t c = 0; c < n; c += HASH_SLICE_N)
+            hash_many<Hash>(&fresh[c * Hash::DIGEST_SIZE], data + Hash::BLOCK_SIZE * c,
+                            std::min(HASH_SLICE_N, n - c));
+
+        // copy serially, so that repeated indices keep the last block
+        for (size_t i = 0; i < n; ++i)
+        {
+            size_t idx = indices[i];
+
+            memcpy(nodes[idx].digest, &fresh[i * Hash::DIGEST_SIZE], Hash::DIGEST_SIZE);
+
+            if (idx < LEAVES_N)
+                dirty[0].push_back(idx >> 1);
+            else
+            {
+                size_t t = 0, pos = 0;
+
+                middle_position(idx, t, pos);
+                dirty[t].push_back(pos);
+            }
+        }
+
+        for (size_t t = 0; t < height - 1; ++t)
+        {
+            std::vector<size_t> &layer = dirty[t];
+
+            std::sort(layer.begin(), layer.end());
+            layer.erase(std::unique(layer.begin(), layer.end()), layer.end());
+
+#pragma omp parallel for
+            for (size_t c = 0; c < layer.size(); c += HASH_SLICE_N)
+            {
+                size_t m = std::min(HASH_SLICE_N, layer.size() - c);
+                Node *targets[HASH_SLICE_N];
+
+                for (size_t j = 0; j < m; ++j)
+                    targets[j] = &nodes[layer_offset(t) + layer[c + j]];
+                rehash(t, targets, m);
+            }
+
+            if (t + 1 < height - 1)
+                for (auto &&p : layer)
+                    dirty[t + 1].push_back(p >> 1);
+        }
+    }
+
+    /*
+    Extract the path of the leaf or middle node idx, as expected by FixedAbrPath and ABR_Gadget:
+    `other` gets one digest, `middle` and `otherx` get height - 2 digests each (PATH_SIZE bytes).
+    For a leaf, other is its sibling, middle[i] is the middle node of its ancestor in layer i + 1
+    and otherx[i] is the sibling of its ancestor in layer i.
+    For a middle node of a layer t node, other and otherx[0] are the left and right children of
+    that node, middle[0] is unused, and middle[i], otherx[i] (i > 0) are the same as above for
+    layer t + i; the unused digests are zeroed.
+    */
+    void get_path(size_t idx, uint8_t *other, uint8_t *middle, uint8_t *otherx) const
+    {
+        if (idx >= INPUT_N)
+        {
+            std::cerr << "FixedAbr: Bad index\n";
+            return;
+        }
+
+        auto copy = [&](uint8_t *out, size_t i, size_t node)
+        { memcpy(out + i * Hash::DIGEST_SIZE, nodes[node].digest, Hash::DIGEST_SIZE); };
+
+        memset(middle, 0, PATH_SIZE);
+        memset(otherx, 0, PATH_SIZE);
+
+        if (idx < LEAVES_N)
+        {
+            copy(other, 0, idx ^ 1);
+            for (size_t i = 0; i < height - 2; ++i)
+            {
+                copy(middle, i, middle_offset(i + 1) + (idx >> (i + 2)));
+                copy(otherx, i, layer_offset(i) + ((idx >> (i + 1)) ^ 1));
+            }
+        }
+        else
+        {
+            size_t t = 0, pos = 0;
+
+            middle_position(idx, t, pos);
+            copy(other, 0, layer_offset(t - 1) + 2 * pos);
+            copy(otherx, 0, layer_offset(t - 1) + 2 * pos + 1);
+            for (size_t i = 1; t + i < height - 1; ++i)
+            {
+                copy(middle, i, middle_offset(t + i) + (pos >> i));
+                copy(otherx, i, layer_offset(t + i - 1) + ((pos >> (i - 1)) ^ 1));
+            }
+        }
+    }
+
     friend std::ostream &operator<<(std::ostream &os, const FixedAbr &tree)
     {
         if (!tree.root)
@@ -254,3 +440,91 @@ public:
         return os << *tree.root;
     }
 };
+
+
+/*
+Rebuild the root of an ABR from the path of one transaction, with the same hash/hash_add sequence
+as ABR_Gadget, in O(height) hashes and without heap allocation. The inputs are the ones given by
+FixedAbr::get_path: trans is the leaf or middle node idx, other its sibling (or the left child of
+the node owning it), middle and otherx point to height - 2 digests each.
+*/
+template<size_t height, typename Hash>
+class FixedAbrPath
+{
+    static_assert(height > 2, "Bad tree height");
+
+public:
+    using Tree = FixedAbr<height, Hash>;
+    using Digest = std::array<uint8_t, Hash::DIGEST_SIZE>;
+
+    static constexpr size_t LEAVES_N = Tree::LEAVES_N;
+    static constexpr size_t INPUT_N = Tree::INPUT_N;
+    static constexpr size_t PATH_SIZE = Tree::PATH_SIZE;
+
+private:
+    // nodes[t] is the ancestor of the transaction in internal layer t, the root being the last
+    std::array<Digest, height - 1> nodes{};
+    size_t first = 0; // first layer of the path (0 for leaves)
+
+    // ABR node from the path node cur, its sibling and the middle node of their parent
+    static void hash_step(uint8_t *digest, const uint8_t *cur, const uint8_t *sibling,
+                          const uint8_t *middle, bool is_right)
+    {
+        const uint8_t *left = is_right ? sibling : cur;
+        const uint8_t *right = is_right ? cur : sibling;
+        uint8_t block[Hash::BLOCK_SIZE];
+
+        memcpy(block, left, Hash::DIGEST_SIZE);
+        memcpy(block + Hash::DIGEST_SIZE, right, Hash::DIGEST_SIZE);
+
+        Hash::hash_add(block, middle);
+        Hash::hash_add(block + Hash::DIGEST_SIZE, middle);
+        Hash::hash_oneblock(digest, block);
+        Hash::hash_add(digest, right);
+    }
+
+public:
+    FixedAbrPath() = default;
+
+    FixedAbrPath(const uint8_t *trans, const uint8_t *other, const uint8_t *middle,
+                 const uint8_t *otherx, size_t idx)
+    {
+        if (idx >= INPUT_N)
+        {
+            std::cerr << "FixedAbrPath: Bad index\n";
+            return;
+        }
+
+        size_t pos = 0;
+
+        if (idx < LEAVES_N)
+        {
+            // first hash without middle node and without remainder
+            uint8_t block[Hash::BLOCK_SIZE];
+
+            memcpy(block + (idx & 1) * Hash::DIGEST_SIZE, trans, Hash::DIGEST_SIZE);
+            memcpy(block + (~idx & 1) * Hash::DIGEST_SIZE, other, Hash::DIGEST_SIZE);
+            Hash::hash_oneblock(nodes[0].data(), block);
+
+            first = 0;
+            pos = idx >> 1;
+        }
+        else
+        {
+            // the transaction is the middle node, other and otherx[0] are the children
+            Tree::middle_position(idx, first, pos);
+            hash_step(nodes[first].data(), other, otherx, trans, false);
+        }
+
+        for (size_t t = first + 1, i = first ? 1 : 0; t < height - 1; ++t, ++i, pos >>= 1)
+            hash_step(nodes[t].data(), nodes[t - 1].data(), otherx + i * Hash::DIGEST_SIZE,
+                      middle + i * Hash::DIGEST_SIZE, pos & 1);
+    }
+
+    const uint8_t *digest() const { return nodes[height - 2].data(); }
+
+    // Ancestor of the transaction in internal layer t (t >= first_layer())
+    const uint8_t *get_node(size_t t) const { return nodes[t].data(); }
+
+    size_t first_layer() const { return first; }
+};
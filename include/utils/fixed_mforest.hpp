@@ -0,0 +1,117 @@
+#pragma once
+
+#include "utils/fixed_mtree.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <omp.h>
+#include <vector>
+
+#if __cplusplus >= 202002L
+    #include <ranges>
+#endif
+
+// Read-only view over one tree of a FixedMForest, with the same accessors as FixedMTree
+template<size_t height, typename Hash>
+class FixedMTreeView
+{
+public:
+    using Node = FixedMTreeNode<Hash>;
+
+    static constexpr size_t NODES_N = FixedMTree<height, Hash>::NODES_N;
+
+private:
+    const Node *nodes = nullptr;
+
+public:
+    FixedMTreeView() = default;
+
+    explicit FixedMTreeView(const Node *nodes) : nodes{nodes} {}
+
+    const uint8_t *digest() const { return nodes[NODES_N - 1].get_digest(); }
+
+    const Node *get_node(size_t i) const { return &nodes[i]; }
+
+    friend std::ostream &operator<<(std::ostream &os, const FixedMTreeView &tree)
+    {
+        if (!tree.nodes)
+            return os;
+
+        return os << tree.nodes[NODES_N - 1];
+    }
+};
+
+/*
+Many independent small trees built in one call. All the nodes live in a single arena, which is
+kept across calls to build(), and the parallelism is across trees: each thread builds whole trees
+serially, so there is one OpenMP region per call instead of one per tree level per tree.
+*/
+template<size_t height, typename Hash>
+class FixedMForest
+{
+public:
+    using Tree = FixedMTree<height, Hash>;
+    using Node = typename Tree::Node;
+    using View = FixedMTreeView<height, Hash>;
+
+    static constexpr size_t NODES_N = Tree::NODES_N;
+    static constexpr size_t INPUT_SIZE = Tree::INPUT_SIZE;
+
+private:
+    /*
+    Nodes layout: tree t occupies nodes [t * NODES_N, (t + 1) * NODES_N), with the same layout
+    as FixedMTree.
+    */
+    std::vector<Node> nodes{};
+    size_t trees_n = 0;
+
+public:
+    FixedMForest() = default;
+
+    // The nodes link to each other inside the arena: a move keeps it, a copy would not
+    FixedMForest(const FixedMForest &) = delete;
+    FixedMForest(FixedMForest &&) = default;
+    FixedMForest &operator=(const FixedMForest &) = delete;
+    FixedMForest &operator=(FixedMForest &&) = default;
+
+#if __cplusplus >= 202002L
+    template<std::ranges::range Range>
+    FixedMForest(const Range &range) :
+        FixedMForest(std::ranges::cdata(range),
+                     std::ranges::size(range) * sizeof(*std::ranges::cdata(range)))
+    {}
+#endif
+
+    template<typename Iter>
+    FixedMForest(const Iter begin, const Iter end) :
+        FixedMForest(&*begin, std::distance(begin, end) * sizeof(*begin))
+    {}
+
+    FixedMForest(const void *vdata, size_t sz) { build(vdata, sz); }
+
+    // (Re)build the forest from sz / INPUT_SIZE consecutive tree inputs, reusing the arena
+    void build(const void *vdata, size_t sz)
+    {
+        if (sz % INPUT_SIZE != 0)
+        {
+            std::cerr << "FixedMForest: Bad size of input data\n";
+            return;
+        }
+
+        const uint8_t *data = (const uint8_t *)vdata;
+
+        trees_n = sz / INPUT_SIZE;
+        if (nodes.size() < trees_n * NODES_N)
+            nodes.resize(trees_n * NODES_N);
+
+#pragma omp parallel for schedule(static)
+        for (size_t t = 0; t < trees_n; ++t)
+            Tree::build_serial(&nodes[t * NODES_N], data + t * INPUT_SIZE);
+    }
+
+    size_t size() const { return trees_n; }
+
+    View operator[](size_t t) const { return View{&nodes[t * NODES_N]}; }
+
+    const uint8_t *digest(size_t t) const { return nodes[(t + 1) * NODES_N - 1].get_digest(); }
+};
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "utils/hash_batch.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <omp.h>
+#include <vector>
+
+#if __cplusplus >= 202002L
+    #include <ranges>
+#endif
+
+/*
+Pointer-free ABR of runtime height. Leaves, middle nodes and internal nodes are kept in three
+separate contiguous arrays of digests, and parents/children are found by index arithmetic:
+- leaves[i], i < LEAVES_N
+- middles[i], i < INTERNAL_N, the middle nodes of internal layer 1, then of layer 2, ...
+- internals[i], i < LEAVES_N - 1, internal layer 0 (parents of the leaves), then layer 1, ...,
+  the root being the last one
+Internal layer t has LEAVES_N >> (t + 1) nodes; every layer but the first one also has one
+middle node per node. Digests are the same as FixedAbr, so the roots match.
+*/
+template<typename Hash>
+class FlatAbrLayout
+{
+public:
+    static constexpr size_t DIGEST_SIZE = Hash::DIGEST_SIZE;
+
+    size_t height = 0;
+    size_t leaves_n = 0;
+    size_t internal_n = 0;
+
+    FlatAbrLayout() = default;
+
+    explicit FlatAbrLayout(size_t height) :
+        height{height}, leaves_n{1ULL << (height - 1)}, internal_n{(1ULL << (height - 2)) - 1}
+    {}
+
+    // Number of nodes in internal layer t
+    size_t layer_size(size_t t) const { return leaves_n >> (t + 1); }
+
+    // Index of the first node of internal layer t in the internal array
+    size_t layer_offset(size_t t) const { return leaves_n - (leaves_n >> t); }
+
+    // Index of the first middle node of internal layer t (t > 0) in the middle array
+    size_t middle_offset(size_t t) const { return leaves_n / 2 - (leaves_n >> t); }
+
+    // Hash n input blocks into n digests, in parallel
+    static void hash_inputs(uint8_t *digests, const uint8_t *data, size_t n)
+    {
+#pragma omp parallel for schedule(static)
+        for (size_t c = 0; c < n; c += HASH_SLICE_N)
+            hash_many<Hash>(digests + c * DIGEST_SIZE, data + c * Hash::BLOCK_SIZE,
+                            std::min(HASH_SLICE_N, n - c));
+    }
+
+    /*
+    Hash the nodes [c, c + HASH_SLICE_N) (or less) of a layer from the lower layer and, if not
+    null, from the middle nodes of the layer. A node is H(l || r) without middle node, otherwise
+    H(l ^ m || r ^ m) ^ r, with ^ being Hash::hash_add (same as FixedAbrNode).
+    */
+    static void hash_chunk(uint8_t *layer, const uint8_t *lower, const uint8_t *middle, size_t c,
+                           size_t n)
+    {
+        size_t m = std::min(HASH_SLICE_N, n - c);
+
+        if (!middle)
+        {
+            hash_level<Hash>(layer + c * DIGEST_SIZE, lower + 2 * c * DIGEST_SIZE, m);
+            return;
+        }
+
+        uint8_t block[HASH_SLICE_N][Hash::BLOCK_SIZE]{};
+
+        for (size_t j = 0; j < m; ++j)
+        {
+            size_t p = c + j;
+
+            memcpy(block[j], lower + 2 * p * DIGEST_SIZE, 2 * DIGEST_SIZE);
+            Hash::hash_add(block[j], middle + p * DIGEST_SIZE);
+            Hash::hash_add(block[j] + DIGEST_SIZE, middle + p * DIGEST_SIZE);
+        }
+        hash_many<Hash>(layer + c * DIGEST_SIZE, block[0], m);
+
+        for (size_t j = 0; j < m; ++j)
+            Hash::hash_add(layer + (c + j) * DIGEST_SIZE, lower + (2 * (c + j) + 1) * DIGEST_SIZE);
+    }
+
+    /*
+    Compute all the internal nodes from the leaf and middle digests. There is a single parallel
+    region: every layer is split statically among the threads (by slices of HASH_SLICE_N nodes),
+    so each thread mostly rehashes the outputs it produced at the previous layer.
+    */
+    void build(uint8_t *internals, const uint8_t *leaves, const uint8_t *middles) const
+    {
+#pragma omp parallel
+        {
+            // first internal layer (only hash, no addition)
+#pragma omp for schedule(static)
+            for (size_t c = 0; c < layer_size(0); c += HASH_SLICE_N)
+                hash_chunk(internals, leaves, nullptr, c, layer_size(0));
+
+            for (size_t t = 1; t < height - 1; ++t)
+            {
+                uint8_t *layer = internals + layer_offset(t) * DIGEST_SIZE;
+                const uint8_t *lower = internals + layer_offset(t - 1) * DIGEST_SIZE;
+                const uint8_t *middle = middles + middle_offset(t) * DIGEST_SIZE;
+
+#pragma omp for schedule(static)
+                for (size_t c = 0; c < layer_size(t); c += HASH_SLICE_N)
+                    hash_chunk(layer, lower, middle, c, layer_size(t));
+            }
+        }
+    }
+};
+
+
+template<size_t height, typename Hash>
+class FlatAbr
+{
+public:
+    using Layout = FlatAbrLayout<Hash>;
+
+    static constexpr size_t INTERNAL_N = (1ULL << (height - 2)) - 1;
+    static constexpr size_t LEAVES_N = 1ULL << (height - 1);
+    static constexpr size_t INPUT_N = LEAVES_N + INTERNAL_N;
+    static constexpr size_t INPUT_SIZE = INPUT_N * Hash::BLOCK_SIZE;
+    static constexpr size_t NODES_N = (1ULL << height) - 1 + INTERNAL_N;
+
+private:
+    std::vector<uint8_t> leaves{};
+    std::vector<uint8_t> middles{};
+    std::vector<uint8_t> internals{};
+
+public:
+    FlatAbr() = default;
+
+#if __cplusplus >= 202002L
+    template<std::ranges::range Range>
+    FlatAbr(const Range &range) :
+        FlatAbr(std::ranges::cdata(range),
+                std::ranges::size(range) * sizeof(*std::ranges::cdata(range)))
+    {}
+#endif
+
+    template<typename Iter>
+    FlatAbr(const Iter begin, const Iter end) :
+        FlatAbr(&*begin, std::distance(begin, end) * sizeof(*begin))
+    {}
+
+    FlatAbr(const void *vdata, size_t sz) :
+        leaves(LEAVES_N * Hash::DIGEST_SIZE), middles(INTERNAL_N * Hash::DIGEST_SIZE),
+        internals((LEAVES_N - 1) * Hash::DIGEST_SIZE)
+    {
+        if (sz / Hash::BLOCK_SIZE != INPUT_N || sz % Hash::BLOCK_SIZE != 0)
+        {
+            std::cerr << "FlatAbr: Bad size of input data\n";
+            return;
+        }
+
+        const uint8_t *data = (const uint8_t *)vdata;
+
+        // add leaves and middle nodes
+        Layout::hash_inputs(leaves.data(), data, LEAVES_N);
+        Layout::hash_inputs(middles.data(), data + LEAVES_N * Hash::BLOCK_SIZE, INTERNAL_N);
+        Layout{height}.build(internals.data(), leaves.data(), middles.data());
+    }
+
+    const uint8_t *digest() const { return &internals[(LEAVES_N - 2) * Hash::DIGEST_SIZE]; }
+
+    const uint8_t *get_leaf(size_t i) const { return &leaves[i * Hash::DIGEST_SIZE]; }
+
+    const uint8_t *get_middle(size_t i) const { return &middles[i * Hash::DIGEST_SIZE]; }
+
+    const uint8_t *get_internal(size_t i) const { return &internals[i * Hash::DIGEST_SIZE]; }
+
+    // Digest of node i, numbered as in FixedAbr (leaves, then middles, then internal nodes)
+    const uint8_t *get_digest(size_t i) const
+    {
+        if (i < LEAVES_N)
+            return get_leaf(i);
+        if (i < INPUT_N)
+            return get_middle(i - LEAVES_N);
+
+        return get_internal(i - INPUT_N);
+    }
+};
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+/*
+Optional batch API of a Hash policy, on contiguous arrays:
+- Hash::hash_many(out, in, n): out[i] = H(in[i]) for n blocks of BLOCK_SIZE bytes
+- Hash::hash_pairs(out, left, right, n): out[i] = H(left[i] || right[i]) for n digests
+A policy with a multi-buffer or interleaved kernel provides both; the free functions below call
+them when available and fall back to one hash_oneblock per block otherwise. Tree builders hash
+their levels by slices of HASH_SLICE_N nodes through these functions.
+*/
+static constexpr size_t HASH_SLICE_N = 64;
+
+#if __cplusplus >= 202002L
+template<typename Hash>
+concept BatchHash = requires(uint8_t *out, const uint8_t *in, size_t n) {
+    Hash::hash_many(out, in, n);
+    Hash::hash_pairs(out, in, in, n);
+};
+
+template<typename Hash>
+inline constexpr bool is_batch_hash_v = BatchHash<Hash>;
+#else
+template<typename Hash, typename = void>
+struct is_batch_hash : std::false_type
+{};
+
+template<typename Hash>
+struct is_batch_hash<Hash, std::void_t<decltype(Hash::hash_many(nullptr, nullptr, 0)),
+                                        decltype(Hash::hash_pairs(nullptr, nullptr, nullptr, 0))>>
+    : std::true_type
+{};
+
+template<typename Hash>
+inline constexpr bool is_batch_hash_v = is_batch_hash<Hash>::value;
+#endif
+
+template<typename Hash>
+void hash_many(uint8_t *out, const uint8_t *in, size_t n)
+{
+    if constexpr (is_batch_hash_v<Hash>)
+        Hash::hash_many(out, in, n);
+    else
+        for (size_t i = 0; i < n; ++i)
+            Hash::hash_oneblock(out + i * Hash::DIGEST_SIZE, in + i * Hash::BLOCK_SIZE);
+}
+
+template<typename Hash>
+void hash_pairs(uint8_t *out, const uint8_t *left, const uint8_t *right, size_t n)
+{
+    if constexpr (is_batch_hash_v<Hash>)
+        Hash::hash_pairs(out, left, right, n);
+    else
+    {
+        uint8_t block[Hash::BLOCK_SIZE]{};
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            memcpy(block, left + i * Hash::DIGEST_SIZE, Hash::DIGEST_SIZE);
+            memcpy(block + Hash::DIGEST_SIZE, right + i * Hash::DIGEST_SIZE, Hash::DIGEST_SIZE);
+            Hash::hash_oneblock(out + i * Hash::DIGEST_SIZE, block);
+        }
+    }
+}
+
+// Hash n Merkle nodes from their 2n children, stored contiguously in lower (one tree level)
+template<typename Hash>
+void hash_level(uint8_t *out, const uint8_t *lower, size_t n)
+{
+    if constexpr (Hash::BLOCK_SIZE == 2 * Hash::DIGEST_SIZE)
+        hash_many<Hash>(out, lower, n);
+    else
+    {
+        uint8_t block[Hash::BLOCK_SIZE]{};
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            memcpy(block, lower + 2 * i * Hash::DIGEST_SIZE, 2 * Hash::DIGEST_SIZE);
+            Hash::hash_oneblock(out + i * Hash::DIGEST_SIZE, block);
+        }
+    }
+}
+
+/*
+Dispatcher of a policy with two multi-buffer kernels, wide (Hash::LANES_AVX512 lanes) and narrow
+(Hash::LANES_AVX2 lanes): hash n <= Hash::LANES blocks given by pointers, blocks[i] into
+digests[i], with `lanes` lanes per kernel call as picked from the CPU, or one block at a time with
+Hash::hash_oneblock if lanes is 1. Missing lanes are filled with dummy work on the first block.
+*/
+template<typename Hash, typename Wide, typename Narrow>
+void hash_oneblock_lanes(uint8_t *const digests[], const void *const blocks[], size_t n,
+                         size_t lanes, Wide wide, Narrow narrow)
+{
+    if (lanes == 1 || n == 0)
+    {
+        for (size_t i = 0; i < n; ++i)
+            Hash::hash_oneblock(digests[i], blocks[i]);
+        return;
+    }
+
+    uint8_t dummy[Hash::DIGEST_SIZE];
+    uint8_t *lane_digests[Hash::LANES];
+    const void *lane_blocks[Hash::LANES];
+
+    for (size_t c = 0; c < n; c += lanes)
+    {
+        for (size_t l = 0; l < lanes; ++l)
+        {
+            lane_digests[l] = c + l < n ? digests[c + l] : dummy;
+            lane_blocks[l] = c + l < n ? blocks[c + l] : blocks[0];
+        }
+
+        if (lanes == Hash::LANES_AVX512)
+            wide(lane_digests, lane_blocks);
+        else
+            narrow(lane_digests, lane_blocks);
+    }
+}
+
+/*
+Helpers for policies with a multi-buffer kernel Hash::hash_oneblock_xN(digests[], blocks[], n),
+which hashes up to Hash::LANES blocks given by pointers.
+*/
+template<typename Hash>
+void hash_many_lanes(uint8_t *out, const uint8_t *in, size_t n)
+{
+    uint8_t *digests[Hash::LANES];
+    const void *blocks[Hash::LANES];
+
+    for (size_t c = 0; c < n; c += Hash::LANES)
+    {
+        size_t m = n - c < Hash::LANES ? n - c : Hash::LANES;
+
+        for (size_t j = 0; j < m; ++j)
+        {
+            digests[j] = out + (c + j) * Hash::DIGEST_SIZE;
+            blocks[j] = in + (c + j) * Hash::BLOCK_SIZE;
+        }
+        Hash::hash_oneblock_xN(digests, blocks, m);
+    }
+}
+
+template<typename Hash>
+void hash_pairs_lanes(uint8_t *out, const uint8_t *left, const uint8_t *right, size_t n)
+{
+    uint8_t block[Hash::LANES][Hash::BLOCK_SIZE]{};
+
+    for (size_t c = 0; c < n; c += Hash::LANES)
+    {
+        size_t m = n - c < Hash::LANES ? n - c : Hash::LANES;
+
+        for (size_t j = 0; j < m; ++j)
+        {
+            memcpy(block[j], left + (c + j) * Hash::DIGEST_SIZE, Hash::DIGEST_SIZE);
+            memcpy(block[j] + Hash::DIGEST_SIZE, right + (c + j) * Hash::DIGEST_SIZE,
+                   Hash::DIGEST_SIZE);
+        }
+        hash_many_lanes<Hash>(out + c * Hash::DIGEST_SIZE, block[0], m);
+    }
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "utils/hash_batch.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <omp.h>
+#include <type_traits>
+#include <vector>
+
+#if __cplusplus >= 202002L
+    #include <ranges>
+#endif
+
+/*
+Level policy of a HybridMTree: the levels below split (the leaves being level 0) are hashed with
+Lower, the levels from split up to the root with Upper, e.g. SplitLevels<k, Sha256, Mimc256> for
+a fast native hash at the bottom of the tree, where most of the hashes are, and a circuit-friendly
+one at the top, the only part proven by HybridMTree_Gadget. Any policy with a Hash<level> alias
+and the first level SPLIT of its circuit-friendly hash works.
+*/
+template<size_t split, typename Lower, typename Upper>
+struct SplitLevels
+{
+    static constexpr size_t SPLIT = split;
+
+    template<size_t level>
+    using Hash = std::conditional_t<(level < split), Lower, Upper>;
+};
+
+/*
+Merkle tree with a hash per level given by Levels: level 0 hashes the input blocks into the
+leaves, level l > 0 the digests of level l - 1 by pairs, up to the root at level height - 1. All
+the hashes must have the same DIGEST_SIZE. The levels are built one after the other, each one
+with the batch API of its own hash. Nodes layout is the same as FixedMTree: the LEAVES_N leaves,
+then each upper level, the root being the last one.
+*/
+template<size_t height, typename Levels>
+class HybridMTree
+{
+public:
+    template<size_t level>
+    using HashAt = typename Levels::template Hash<level>;
+
+    static constexpr size_t HEIGHT = height;
+    static constexpr size_t SPLIT = Levels::SPLIT;
+    static constexpr size_t DIGEST_SIZE = HashAt<0>::DIGEST_SIZE;
+    static constexpr size_t LEAVES_N = 1ULL << (height - 1);
+    static constexpr size_t NODES_N = (1ULL << height) - 1;
+    static constexpr size_t INPUT_SIZE = LEAVES_N * HashAt<0>::BLOCK_SIZE;
+
+    static constexpr size_t level_offset(size_t level)
+    {
+        return 2 * LEAVES_N - (2 * LEAVES_N >> level);
+    }
+
+private:
+    std::vector<uint8_t> nodes{};
+
+    uint8_t *node(size_t i) { return &nodes[i * DIGEST_SIZE]; }
+
+    template<size_t level>
+    void build_level(const uint8_t *data)
+    {
+        using Hash = HashAt<level>;
+
+        static_assert(Hash::DIGEST_SIZE == DIGEST_SIZE, "Levels must have the same digest size");
+
+        const size_t n = LEAVES_N >> level;
+        uint8_t *upper = node(level_offset(level));
+
+        if constexpr (level == 0)
+        {
+#pragma omp parallel for
+            for (size_t c = 0; c < n; c += HASH_SLICE_N)
+                hash_many<Hash>(upper + c * DIGEST_SIZE, data + c * Hash::BLOCK_SIZE,
+                                std::min(HASH_SLICE_N, n - c));
+        }
+        else
+        {
+            static_assert(Hash::BLOCK_SIZE >= 2 * DIGEST_SIZE, "Block too small for two digests");
+
+            const uint8_t *lower = node(level_offset(level - 1));
+
+#pragma omp parallel for
+            for (size_t c = 0; c < n; c += HASH_SLICE_N)
+                hash_level<Hash>(upper + c * DIGEST_SIZE, lower + 2 * c * DIGEST_SIZE,
+                                 std::min(HASH_SLICE_N, n - c));
+        }
+
+        if constexpr (level + 1 < height)
+            build_level<level + 1>(data);
+    }
+
+public:
+    HybridMTree() = default;
+
+#if __cplusplus >= 202002L
+    template<std::ranges::range Range>
+    HybridMTree(const Range &range) :
+        HybridMTree(std::ranges::cdata(range),
+                    std::ranges::size(range) * sizeof(*std::ranges::cdata(range)))
+    {}
+#endif
+
+    template<typename Iter>
+    HybridMTree(const Iter begin, const Iter end) :
+        HybridMTree(&*begin, std::distance(begin, end) * sizeof(*begin))
+    {}
+
+    HybridMTree(const void *vdata, size_t sz) : nodes(NODES_N * DIGEST_SIZE)
+    {
+        if (sz != INPUT_SIZE)
+        {
+            std::cerr << "HybridMTree: Bad size of input data\n";
+            return;
+        }
+
+        build_level<0>((const uint8_t *)vdata);
+    }
+
+    const uint8_t *digest() const { return get_node(NODES_N - 1); }
+
+    const uint8_t *get_node(size_t i) const { return &nodes[i * DIGEST_SIZE]; }
+
+    // Node of level on the path from leaf idx to the root
+    const uint8_t *get_node(size_t level, size_t idx) const
+    {
+        return get_node(level_offset(level) + (idx >> level));
+    }
+
+    /*
+    Siblings of the path from leaf idx to the root, of the levels [first, height - 1) from the
+    leaves up (first = 0 for the whole path)
+    */
+    void get_path(size_t idx, uint8_t *other, size_t first = 0) const
+    {
+        if (idx >= LEAVES_N)
+        {
+            std::cerr << "HybridMTree: Bad index\n";
+            return;
+        }
+
+        for (size_t level = first; level < height - 1; ++level, other += DIGEST_SIZE)
+            memcpy(other, get_node(level_offset(level) + ((idx >> level) ^ 1)), DIGEST_SIZE);
+    }
+};
@@ -0,0 +1,234 @@
+#pragma once
+
+#include "utils/cpu_features.hpp"
+#include "utils/hash_batch.hpp"
+#include "utils/knapsack_constants.hpp"
+
+#ifdef _WIN32
+    #include <intrin.h>
+#else
+    #include <x86intrin.h>
+#endif
+#include <cinttypes>
+#include <climits>
+
+/*
+Knapsack (subset sum) hash over the scalar field r of BN254, the CRH of libsnark's knapsack
+gadgets: the digest of a block of bits b_k is sum(b_k * C_k) mod r, with the coefficients of
+knapsack_CRH_with_field_out_gadget (utils/knapsack_constants.py). Bits are taken MSB first in
+each byte, as in a digest_variable, and the digest is the big-endian encoding of the sum, whose
+2 top bits are 0. The hash is linear in the bits: a CRH for Merkle trees, not a random oracle.
+*/
+class Knapsack
+{
+public:
+    static constexpr size_t BLOCK_SIZE = 64;
+    static constexpr size_t DIGEST_SIZE = 32;
+    static constexpr size_t BLOCK_BITS = BLOCK_SIZE * CHAR_BIT;
+
+    static_assert(BLOCK_BITS <= KNAPSACK_N, "Not enough knapsack coefficients");
+
+    Knapsack() = delete;
+
+    // Branchless sum of the coefficients, in 5 limbs of 64 bits (the sum is < 2^9 r)
+    static void hash_oneblock(uint8_t *digest, const void *message)
+    {
+        const uint8_t *m = (const uint8_t *)message;
+        uint64_t acc[5]{};
+
+        for (size_t k = 0; k < BLOCK_BITS; ++k)
+        {
+            const uint64_t mask = -(uint64_t)(m[k / 8] >> (7 - k % 8) & 1);
+            const uint64_t *c = KNAPSACK_C[k];
+            unsigned char carry = 0;
+
+            carry = _addcarry_u64(carry, acc[0], c[0] & mask, (unsigned long long *)&acc[0]);
+            carry = _addcarry_u64(carry, acc[1], c[1] & mask, (unsigned long long *)&acc[1]);
+            carry = _addcarry_u64(carry, acc[2], c[2] & mask, (unsigned long long *)&acc[2]);
+            carry = _addcarry_u64(carry, acc[3], c[3] & mask, (unsigned long long *)&acc[3]);
+            acc[4] += carry;
+        }
+
+        reduce(acc);
+        store(digest, acc);
+    }
+
+    static constexpr size_t LANES = 8;
+
+    /*
+    Hash n <= LANES independent blocks, blocks[i] into digests[i], with the fastest kernel of the
+    CPU: 8 lanes with AVX-512, 4 lanes with AVX2, one block at a time otherwise. Missing lanes
+    are filled with dummy work on the first block.
+    */
+    static void hash_oneblock_xN(uint8_t *const digests[], const void *const blocks[],
+                                 size_t n = LANES)
+    {
+        static const CpuFeatures &cpu = CpuFeatures::get();
+        static const size_t lanes = cpu.avx512f ? LANES_AVX512 : cpu.avx2 ? LANES_AVX2 : 1;
+
+        hash_oneblock_lanes<Knapsack>(digests, blocks, n, lanes, hash_oneblock_x8,
+                                      hash_oneblock_x4);
+    }
+
+    // Batch API (utils/hash_batch.hpp) on contiguous arrays, through the multi-buffer kernels
+    static void hash_many(uint8_t *out, const uint8_t *in, size_t n)
+    {
+        hash_many_lanes<Knapsack>(out, in, n);
+    }
+
+    static void hash_pairs(uint8_t *out, const uint8_t *left, const uint8_t *right, size_t n)
+    {
+        hash_pairs_lanes<Knapsack>(out, left, right, n);
+    }
+
+    static constexpr size_t LANES_AVX2 = 4;
+    static constexpr size_t LANES_AVX512 = 8;
+
+    /*
+    Multi-buffer kernels: one message per 64-bit lane, the sum kept in 5 limbs of 52 bits without
+    carries (a limb of 2^9 coefficients stays below 2^61), normalized once at the end.
+    */
+    CPU_TARGET("avx2")
+    static void hash_oneblock_x4(uint8_t *const digests[LANES_AVX2],
+                                 const void *const blocks[LANES_AVX2])
+    {
+        const uint8_t *b[LANES_AVX2];
+        __m256i acc[5];
+
+        for (size_t l = 0; l < LANES_AVX2; ++l)
+            b[l] = (const uint8_t *)blocks[l];
+        for (size_t j = 0; j < 5; ++j)
+            acc[j] = _mm256_setzero_si256();
+
+        for (size_t i = 0; i < BLOCK_SIZE; ++i)
+        {
+            const __m256i bytes = _mm256_set_epi64x(b[3][i], b[2][i], b[1][i], b[0][i]);
+
+            for (size_t t = 0; t < CHAR_BIT; ++t)
+            {
+                const __m256i bit = _mm256_set1_epi64x(0x80 >> t);
+                const __m256i mask = _mm256_cmpeq_epi64(_mm256_and_si256(bytes, bit), bit);
+                const uint64_t *c = KNAPSACK_C_52[i * CHAR_BIT + t];
+
+                for (size_t j = 0; j < 5; ++j)
+                    acc[j] = _mm256_add_epi64(
+                        acc[j], _mm256_and_si256(mask, _mm256_set1_epi64x(c[j])));
+            }
+        }
+
+        alignas(32) uint64_t out[5][LANES_AVX2];
+
+        for (size_t j = 0; j < 5; ++j)
+            _mm256_store_si256((__m256i *)out[j], acc[j]);
+
+        for (size_t l = 0; l < LANES_AVX2; ++l)
+            store_limbs52(digests[l], out[0][l], out[1][l], out[2][l], out[3][l], out[4][l]);
+    }
+
+    CPU_TARGET("avx512f")
+    static void hash_oneblock_x8(uint8_t *const digests[LANES_AVX512],
+                                 const void *const blocks[LANES_AVX512])
+    {
+        const uint8_t *b[LANES_AVX512];
+        __m512i acc[5];
+
+        for (size_t l = 0; l < LANES_AVX512; ++l)
+            b[l] = (const uint8_t *)blocks[l];
+        for (size_t j = 0; j < 5; ++j)
+            acc[j] = _mm512_setzero_si512();
+
+        for (size_t i = 0; i < BLOCK_SIZE; ++i)
+        {
+            const __m512i bytes = _mm512_set_epi64(b[7][i], b[6][i], b[5][i], b[4][i], b[3][i],
+                                                   b[2][i], b[1][i], b[0][i]);
+
+            for (size_t t = 0; t < CHAR_BIT; ++t)
+            {
+                const __mmask8 mask =
+                    _mm512_test_epi64_mask(bytes, _mm512_set1_epi64(0x80 >> t));
+                const uint64_t *c = KNAPSACK_C_52[i * CHAR_BIT + t];
+
+                for (size_t j = 0; j < 5; ++j)
+                    acc[j] = _mm512_mask_add_epi64(acc[j], mask, acc[j], _mm512_set1_epi64(c[j]));
+            }
+        }
+
+        alignas(64) uint64_t out[5][LANES_AVX512];
+
+        for (size_t j = 0; j < 5; ++j)
+            _mm512_store_si512(out[j], acc[j]);
+
+        for (size_t l = 0; l < LANES_AVX512; ++l)
+            store_limbs52(digests[l], out[0][l], out[1][l], out[2][l], out[3][l], out[4][l]);
+    }
+
+    static void hash_add(void *x, const void *y)
+    {
+        uint8_t *xb = (uint8_t *)x;
+        const uint8_t *yb = (const uint8_t *)y;
+
+        for (size_t i = 0; i < DIGEST_SIZE; ++i)
+            xb[i] ^= yb[i];
+    }
+
+private:
+    // a mod r for a < 2^9 r: conditional subtractions of r * 2^s, s = 8 .. 0
+    static void reduce(uint64_t a[5])
+    {
+        for (size_t s = 9; s-- > 0;)
+        {
+            uint64_t p[5], d[5];
+            uint64_t borrow = 0;
+
+            p[0] = KNAPSACK_P[0] << s;
+            for (size_t j = 1; j < 4; ++j)
+                p[j] = KNAPSACK_P[j] << s | (s ? KNAPSACK_P[j - 1] >> (64 - s) : 0);
+            p[4] = s ? KNAPSACK_P[3] >> (64 - s) : 0;
+
+            for (size_t j = 0; j < 5; ++j)
+            {
+                unsigned __int128 t = (unsigned __int128)a[j] - p[j] - borrow;
+
+                d[j] = (uint64_t)t;
+                borrow = (uint64_t)(t >> 64) & 1;
+            }
+
+            if (!borrow)
+                for (size_t j = 0; j < 5; ++j)
+                    a[j] = d[j];
+        }
+    }
+
+    // Big-endian encoding of a < r
+    static void store(uint8_t *digest, const uint64_t a[5])
+    {
+        for (size_t i = 0; i < 4; ++i)
+        {
+            uint64_t limb = a[3 - i];
+
+            for (size_t j = 8; j-- > 0; limb >>= 8)
+                digest[i * 8 + j] = (uint8_t)limb;
+        }
+    }
+
+    // Carries of unnormalized limbs of 52 bits, then 5 limbs of 64 bits
+    static void store_limbs52(uint8_t *digest, uint64_t l0, uint64_t l1, uint64_t l2, uint64_t l3,
+                              uint64_t l4)
+    {
+        static constexpr uint64_t MASK = (1ULL << 52) - 1;
+        uint64_t a[5];
+
+        l1 += l0 >> 52;
+        l2 += l1 >> 52;
+        l3 += l2 >> 52;
+        l4 += l3 >> 52;
+        a[0] = (l0 & MASK) | l1 << 52;
+        a[1] = (l1 & MASK) >> 12 | l2 << 40;
+        a[2] = (l2 & MASK) >> 24 | l3 << 28;
+        a[3] = (l3 & MASK) >> 36 | l4 << 16;
+        a[4] = l4 >> 48;
+
+        reduce(a);
+        store(digest, a);
+    }
+};
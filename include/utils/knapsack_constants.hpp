@@ -0,0 +1,1046 @@
+// Generated by utils/knapsack_constants.py, do not edit
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+
+/*
+Knapsack CRH of libsnark over the BN254 scalar field r:
+- KNAPSACK_P: r, 4 little-endian limbs of 64 bits
+- KNAPSACK_C[k]: coefficient of input bit k, libff::SHA512_rng<Fr>(k), 4 limbs of 64 bits
+- KNAPSACK_C_52[k]: the same, 5 little-endian limbs of 52 bits
+*/
+static constexpr size_t KNAPSACK_N = 512;
+
+inline constexpr uint64_t KNAPSACK_P[4] = {
+    0x43e1f593f0000001, 0x2833e84879b97091, 0xb85045b68181585d, 0x30644e72e131a029};
+
+alignas(64) inline constexpr uint64_t KNAPSACK_C[KNAPSACK_N][4] = {
+    {0xf4e7df38c8ba6c0b, 0x82c20ef00dbda17e, 0x076121c91055f4fd, 0x0d0c393540b8cf2c},
+    {0x21b8a7b7a7e9ce6f, 0x287937823cc041d2, 0xa4788ca0e78268bc, 0x05cd20a2bf991122},
+    {0xaa7d86cafb329170, 0x3629f4c1a6fc64dd, 0x2e595ec0b3ff14bb, 0x2f9d3c73a8645a9a},
+    {0x985b82586a40bc64, 0x80994d7b4f2f58de, 0x91ed914f84af59c5, 0x130e3fa1c13c3c03},
+    {0xcab448ace895f51b, 0xd3e6ecc3b31f4f78, 0x93931e035aa6266e, 0x19acacc6cf8c65f6},
+    {0xa1fd83a4912deadb, 0xc55c504b913a6692, 0x3ae5f26d3ca1f176, 0x02067044982ef124},
+    {0x59b3e8973f775df8, 0x83b012d5847d2ba8, 0x81697b01f4a7fb0f, 0x270d1ed5cd24dd12},
+    {0xb0569c3ca88c61be, 0xf48393d28ce7b4cf, 0x081a04962d8d52a2, 0x2705079a3d1b1bbf},
+    {0x8814bb723e408f68, 0x7096182429b4137e, 0x58b38d9ef607681a, 0x0b8b01259a8d780e},
+    {0xd61de6192675dd61, 0xe124d776a6d40083, 0x0d82526a5f2a4da4, 0x079d78f775b9e54b},
+    {0xca8472da54053b8c, 0x927551693fe6102d, 0x5d1d8acc446e4988, 0x2c60f3adf5ed482d},
+    {0xadb04084e58f5eb9, 0x8b6a34c51cb0cda9, 0x5442034ccbe054ae, 0x28c3f17ab762c61c},
+    {0xda0e77bfe2aa6382, 0xe4e0214db1205ac0, 0xea13d35423c1d421, 0x2a69ded3622c1eb8},
+    {0xd0dafb74d31edd40, 0x01149e1bf3897a67, 0x9c9f9d68a6095121, 0x1331ca4b3065bda9},
+    {0x2160c54b568a0460, 0x7436a14304c1c4aa, 0x695bd5348f739023, 0x1fe6f57216a171ed},
+    {0xe6f8230bc254c85c, 0x6331ff031efa1a21, 0x87da23a3a66b2f97, 0x0c0aee572eb9bc4e},
+    {0x8d70d94c8726efd5, 0xac36ae5cf8d05856, 0xf8abb8d2cc26416b, 0x158ad9cd9d70e33c},
+    {0xa09822f22cba5a3f, 0x26bebbbc73d1ec86, 0x4d0235dd81508e3c, 0x0ab8f80af4162235},
+    {0x1705105250baac9f, 0x460be7458e462910, 0xc2f022ff2f4b059e, 0x178f7f2ec91d540e},
+    {0x25a525038f509383, 0xc01a78c4412f0b51, 0xffdd6673ce9c7bc9, 0x26f88bc2525ee359},
+    {0x823b4b69cb483332, 0x5fbb1e5098313d8f, 0x8999742df3726c1f, 0x1f10f721a37f3d5a},
+    {0x7f1b986809410acb, 0xf47128cebe4e5cec, 0x242e1c212eebd675, 0x0527e6e5b6b2e25a},
+    {0xf81c68f6187fc374, 0xf7ccb95a6923cba5, 0x3f460ec645b64b96, 0x295dc6d9e53baf18},
+    {0x56bfbc2be353102b, 0x71d6b5acff120ad1, 0x617f73e1319faa5b, 0x0df8294471e4bfd1},
+    {0x83aa10cc5fdab1f3, 0x5b9c4b4ee1af7b1b, 0x9ab640bea69bd8c6, 0x1fccd25fbd85c052},
+    {0x064674a7d117eeda, 0x5818f5b9a37478f7, 0x975f3a3ffbdc1962, 0x2565ae7e327e3b6a},
+    {0xaaf521edca42ea08, 0xf7c292d7b1713d13, 0xc901ba1e1b1528a3, 0x1931d55d6d734961},
+    {0x78ee44d456b8b647, 0x22d4c3ef2d3ef842, 0xb5fe63749784465e, 0x1907b64a5920bd3a},
+    {0xe6411053bd3f896b, 0x981ed9e9aa565183, 0xc57d26e8d42b300b, 0x00be4a0c2f4411d6},
+    {0x54c386ae66885b69, 0x8f21dfe014ed895b, 0x3a9b382ddf22de68, 0x0a05cea56b1d6bdd},
+    {0xbd53a39ef72bd056, 0x7249ea0d5ca7893a, 0x6734a98f8a4809eb, 0x04a59762482b117f},
+    {0x22f3d3b0dd33c897, 0x5e3c81d6e86dd158, 0x31fc9fe42f967757, 0x23607051865569f8},
+    {0x81891adadf9ceca0, 0x9ced5f977d864354, 0x9fb45a75f8b49941, 0x185efda590c6cb57},
+    {0xa5554cd561afeb29, 0x2a0afea0758a910f, 0x749451c1f3975917, 0x26e999e8fc1652b0},
+    {0x1c74265eac8f205e, 0x2dd9608527df840a, 0x882f0c882ac4b080, 0x10a9440eba951f16},
+    {0x76a7e57f441c1b19, 0x808a4fc10593fc10, 0x0baac802e7fbcfb5, 0x1afb0f2ee2ed2939},
+    {0x1e05f1aaf024bcfa, 0xf47d955da7be684f, 0x82faad9f8630970e, 0x18428bfa146c4710},
+    {0x4202174acf0b2a20, 0x355b24a4e284ac40, 0xd21eb600aec6663f, 0x01e4fb829cb668b3},
+    {0x3ff58e5618a749ba, 0x15e8ed488c802dfe, 0x1c76264cef252da5, 0x0258926bdd152db1},
+    {0x89d808e7444e6775, 0x5eb28692e828ddb5, 0xca65abea5cb08f8c, 0x0e4679ba3c56f5a1},
+    {0x170dfb0ddd6f94ab, 0x8928f1e92178ef19, 0x7817746151acd778, 0x037fba8cbec001f8},
+    {0xe8140965dfa72104, 0x1849200eaec47ed6, 0xfafc390f686875b5, 0x0753f30c63a27a41},
+    {0x2b75ddadbbe1c962, 0xe38082e4db9bc5bf, 0xdf1876c639707060, 0x264ff0304f531d45},
+    {0xd74d0779c69cf5fd, 0x41376e9f899a22df, 0xffbee8755045c874, 0x048e219b53e11c2b},
+    {0x833efee9d0158710, 0x05fd88fcda6d6467, 0x3a5b8348e33ae39e, 0x0fbe02036793a2ee},
+    {0xb0d96176f7a41cac, 0x99b911e6d10e26c0, 0xdfdfbd35fb4af3e4, 0x0c1b7d54a712a13c},
+    {0x2ec48d1ec3d1690b, 0x26e6b9786c4b4f48, 0x46dcc8cffaeabcaf, 0x11792e4653c81bae},
+    {0x704edf517145a0e6, 0x4a4185aa6e0ad4ba, 0xca36fc812061e531, 0x11c19f636dddc38b},
+    {0xaabbdbff0178acea, 0xc2f2632c250812e0, 0xbe83edd6e4f36253, 0x17d41374bf415b66},
+    {0xe6b6076029072def, 0x3c35791b20549490, 0xb5aa13caf5b41ed4, 0x1fbe4afb411087d4},
+    {0x4b863ccc5ad8b41b, 0xbecda2cdf650fd04, 0xbd2332199589bf53, 0x1e5e874cc8c07826},
+    {0xfbb6349f04a7372f, 0x804b66d30a769fbe, 0x6cc20d49a843555b, 0x2eef195788272ded},
+    {0x65815130f696db5e, 0xcfc81865c71989c2, 0x81f36c25bc5d5bd7, 0x0f3f2702b24545da},
+    {0xf49ce6bd4d0ab2a4, 0x02a39de975caea1d, 0x9ec183c24bbff58d, 0x0d45a985b67ebaed},
+    {0xb5e50c333e00105b, 0x67aab4b1581e4642, 0xd033783bc607261e, 0x03e9619062b29183},
+    {0xed9088922320d7e2, 0xa973146457ee792f, 0x5a78e2913c1c0ecd, 0x0a65d4e4a5605335},
+    {0x8280e8dc24c2958f, 0xe9cb5c9648d2f6ef, 0xb54f4eb3f852fbfb, 0x1e684c69388843a1},
+    {0x12aaee647bff076e, 0x60704dca34212252, 0x26e519d4bb4b9398, 0x15d54b8796ddd831},
+    {0xf46936b2404914a3, 0xcbf14c07a090dbb6, 0x8b5c76fb416636b1, 0x02b08a15b2876a24},
+    {0xa90807d8d1143920, 0xa7867905539d64b9, 0x189a8a78a3cb21a4, 0x10f718d83cb35b0d},
+    {0x310646e0bdd58fa4, 0xd3f2468e6f9f0ab0, 0x118262aff2306bbe, 0x02cbb110da8cc490},
+    {0xd76cddfcabe08a85, 0x9444e964cea527fa, 0x1ad4957b9dd012a9, 0x2b382471a24b43f0},
+    {0x7ca908a4826d46fe, 0x7b1a2c9f2e97c77f, 0x28c5f0cd455f2b6a, 0x2a8e174c3bd9b80d},
+    {0x5646dec0b4ccd748, 0x798aadb5062d58e3, 0xa07eca4a9be45bce, 0x216640f95b2e6f1f},
+    {0xf39d9f84a18f587a, 0x1045b2b0907db770, 0xc3f8afe216555596, 0x1e25bb1907d19b67},
+    {0x8280d55cec933c50, 0x2bcf861e90463213, 0x127572bcc061ea96, 0x2fa365225df15be0},
+    {0x91ebdfd67d882b8b, 0xaee4bf815c13246f, 0x76d18aecb49496af, 0x26c2446c01eefc79},
+    {0x2c2caf5383ecf6ec, 0x439fce9b25de986e, 0xfc450dba692854b1, 0x3000712f06e14eab},
+    {0x19256f4672733d07, 0x009891b85c6ac08a, 0xdbe41a9ef4cb392a, 0x2a735f7d93ed2cc4},
+    {0xe73c445841101884, 0xf3cf98d8f621d069, 0x2e7fe1f1c340ba99, 0x1300e0e4dc197269},
+    {0x50f52721137e000a, 0x266d61850b961fc9, 0xe912a594d0a901b5, 0x2a24f57b6bf042c5},
+    {0x2fdcae16673f1a10, 0x17dbb3e0ce6519d3, 0xf33fa36ec9f6595e, 0x299e3fae4a5e2e0d},
+    {0x0b67d59073b28d74, 0xa6390cddd80d572e, 0x37b1a3f5fc57593b, 0x07a0ae0155b1e142},
+    {0x8b4ebd9f890c07e9, 0xf55e6c0573d76fcf, 0x0944f8dfb70db2b9, 0x247c50a37898c46b},
+    {0xe6e32bff11a95534, 0xa45b1da27abbb9c1, 0x872ebd16b3be9ed6, 0x09292474a6da18f0},
+    {0x79eaaa1fb617c593, 0x8d95d99db60b5435, 0xd9a15c727514dad5, 0x191d6363f9fbc514},
+    {0xd1d06c0682607a89, 0x8fa04beca9327e5d, 0xbe31f3af4713132f, 0x0a3633a98f9217b3},
+    {0x967236eaacb7204c, 0xd9e27711c9163e2b, 0xf4b7bea9ff865fd6, 0x0821bc35257a34cf},
+    {0xd02bee8143d07864, 0x633346315d46a6e4, 0xc12ce952b7643135, 0x1f77e8c7c24ab141},
+    {0xd9854bedaca1b975, 0xdff0a6675b4f5ddc, 0x199af49e0ae730a0, 0x2fd35328e9b13144},
+    {0x428847cabda22d1f, 0x9c2b1acf8ea76178, 0x186463bb5fa2e67f, 0x1348222242cf7898},
+    {0xb74a49a388cdec12, 0xcda0a557cc7f5a91, 0x9b61551176de92af, 0x1a2536f7c07684cb},
+    {0x74d15d166ab8c454, 0x7d7f139974c5f74d, 0xfde8d0cdf7d5d218, 0x253409a8ccda28e9},
+    {0x7b5b3f525e289d0f, 0xaaea992c56d3e1a6, 0x945955981ae31be7, 0x15031e940759c838},
+    {0xcaf0e1be841210d2, 0xe1c8b5feaccb3743, 0xfacdaff2a7512d0f, 0x26fbb17e6da9c69f},
+    {0xdbbb150f9aaf6a13, 0x1e208225961b694f, 0x2715b18e9ab60180, 0x247607f194cc9f94},
+    {0x50fd9346d8c78b11, 0x53847a0950ec331e, 0x585d18fa7ee9ad2b, 0x0d5da8c459bfb560},
+    {0xc34b0212a0fc0e32, 0x4079089ce8829146, 0x5fd418c72a32a33d, 0x2383f03b591637bc},
+    {0x632f8bdd6ab18f7d, 0x59bb3375ab848f85, 0x472cd9a9d2fee8c2, 0x0edf27e4e9513052},
+    {0xedbbc97cb9319cb8, 0xf446f6fab0337b2e, 0x538d261d62658c21, 0x143189a8b99b423c},
+    {0x866f4ddf3d6e5ede, 0xd6d54542399449e5, 0x74a7ef8126ffde10, 0x280210b7d8a01229},
+    {0x79a4d6a150275a2d, 0x6345a1cc4266a2af, 0x27e0c70d19d07eac, 0x0482ad2ebdeab0be},
+    {0x24985b26f9ff178a, 0xdfdc55e3eed9c5fc, 0xc7a44dbb9329d409, 0x1f694f71c00e0a55},
+    {0x46bb736bb5b0245e, 0x619d356bc8447724, 0x650600fa3987623e, 0x048674a5ff5987fd},
+    {0x601155401ce5de6f, 0x999d0e3adb24ac9a, 0xaaf1499f1ddddc77, 0x10843607888b8610},
+    {0xac298c35e2397d58, 0xc28f0c03a2e7a07d, 0xa28a6ef69bef83aa, 0x28a052a6591961cc},
+    {0x386feb3205d7981f, 0x476444a089878f95, 0x09d6f346424d92ee, 0x1360f9ed23cab4dc},
+    {0x5490998335384da6, 0x1cf808b7c59dc3c0, 0xf8b637f0eebd93d7, 0x0b17c56201aa7282},
+    {0xbb909232fd795c1f, 0xd6962d3c7ba8753b, 0xa5d9ca33ab948c0b, 0x070dc090500d0d0c},
+    {0x9e6dffe92ebf7019, 0xe5fee8d840ab1493, 0xcb9abc5f6da083ad, 0x07e5940e570231ef},
+    {0xccff6eeee6cdf519, 0x2b764ecbbecdedad, 0x0a3c099248b8e05e, 0x2062bbca760b2f23},
+    {0xfef5f151e834455d, 0xcb93e93666e268e4, 0xe364cf99195155f2, 0x2e882d06ec44091c},
+    {0x59e77050ef9c8640, 0xd9b217933e1aa0cd, 0xfe93a0ae82c0aa2b, 0x1080fe5cb45c900d},
+    {0x151484d2fc0220b3, 0x18eddc8968052c2c, 0x89b6d1fd6927b098, 0x30597117ad3501c0},
+    {0xf874f9965eaf4c19, 0x429ab218855aeb92, 0x19196ebdcfd89444, 0x213328335ca70b70},
+    {0x442054f45d27f4ea, 0x5ad2af6126d44766, 0x5817a4d4311c352d, 0x23a9cefcc1e0aee6},
+    {0xc64ebe6b929f995b, 0x94144c28768ad8db, 0x2086945dee0b406b, 0x210620b11dac120b},
+    {0x5f891a2099405234, 0xdc489b565e2cb485, 0x4a1aaed52eb379fe, 0x24863abb8857f7ac},
+    {0x2106de6e2958f103, 0xec055f0cac2b1965, 0xc28752a49cb82687, 0x182c2bfd1b97b729},
+    {0x236de00192fcb6e6, 0x6a74316ce625fd60, 0x29a59fbba545b0b4, 0x2ed8f79231494d48},
+    {0xc6e9e8855f9c70dd, 0xf58408514f3db266, 0x6f4d8bd746c045d3, 0x069ac6bb0b341ff1},
+    {0x788a1b1ef0261578, 0xe6d390e211840ea1, 0xfa4e419846a8e123, 0x14d7580be826da0d},
+    {0x04ab660a1007f26b, 0x5ef7ad5681fd70e2, 0x54ddd176a5afcdb2, 0x2c96d5428d157ec6},
+    {0x67c907a7764db29b, 0x039b8a9f5d1819ca, 0x87959351d50b6bd7, 0x1f4b92007fcb6c4d},
+    {0xd9f870980087dbfc, 0x16329021de0a2fab, 0xaf13418dfb935206, 0x1f9132c96c7f5013},
+    {0x04e2b2e9d4fc5b84, 0x4f1977717762fcef, 0xbdc65c56d23e36e4, 0x14fb6f2e07bc2868},
+    {0x2a68c954c4fc049f, 0x87252f4a11e01e39, 0xe930dca686528670, 0x136c7b5e6ade21be},
+    {0xa66477f357d376fa, 0x1b9d921142def6ff, 0xb30e700634c02e34, 0x16d211cfac9f1c5c},
+    {0x5e832d7661dbde3b, 0x24bdb326f4575e26, 0x46d5b93c7f067bb3, 0x17c4388c9ad222b5},
+    {0xa1776fff6a2bbc22, 0x240c6740bc3bdda4, 0x64e62049973aa2ad, 0x134373ac036e6e39},
+    {0x8f677f7dd1405833, 0x241c0ea4924b6e1a, 0xf26c91391f1a31ad, 0x1bc398ebab748952},
+    {0xb63873264a57a588, 0x058215da9554884d, 0xa2e87fef8fc97fc0, 0x233d8de7bb169141},
+    {0x37fdf621f35a2e82, 0x0eabe75690b44957, 0x307f80e5e6f61801, 0x1f78b4d74a2c8f5d},
+    {0x324024e0f4fb9fdb, 0xc421ffa5fedc9e84, 0xb48fdbe21afbb10f, 0x1fa57a4d200a9fa1},
+    {0x9227c84d3cacb8ec, 0x7b5abf40c7333909, 0x1e91af162c2d57db, 0x0447b6f05e193159},
+    {0x5f88734466f02a10, 0xac37d7eb177e0e07, 0x7d50f0522dcad0a2, 0x00d86c97a0c44727},
+    {0x71ab94861e244fa0, 0xd28b562047fb56a4, 0x60e4104cf4f202fa, 0x2a97ba3bc637bbc7},
+    {0x09f9801d54fbf036, 0xeb5e82414b0b8184, 0x15c9e7c4a045e005, 0x2b54a53b33b0a1c6},
+    {0xdabe834c4406e296, 0x7491f4866b2b1bc5, 0x9da912ea70d2ddd1, 0x0fff06fd9d5723b3},
+    {0x5ac93497c74b9fb6, 0x6eca35bdbd18d8af, 0xb5927880c8bbd077, 0x03393b78b3e391c3},
+    {0xf7d56f81c243597c, 0x5a705d88cbbca115, 0x5a1ab0854769910c, 0x1c8de6fd14d3d5c3},
+    {0xf12f23e832ad064d, 0x38439908177c138b, 0xdb6b3f5b426531ff, 0x0a81822eca4d64f2},
+    {0xff7e54b3c1a64836, 0x2a9df7d3caa8c9fa, 0xcf760248ec7e6aeb, 0x10f880acc4a4265a},
+    {0xa7353ec78d1353e7, 0x811dd17f0500a1d2, 0x8c0d45628d14d5ea, 0x18144eff9abcd465},
+    {0x230b40bc852153c1, 0x13057a265e78a5c0, 0x4c9e765c6b9e4d43, 0x131b0592586840a1},
+    {0xfde902dfb5b408aa, 0xfe8d07972b04d57d, 0x26181013e79b88ca, 0x09d9efa01acece9e},
+    {0x3ab33ade5b56e8dd, 0xff27a84ae341e8c5, 0x4ec019735a1e1b5b, 0x085eb9da56a16628},
+    {0xbcdd489573491e26, 0xa5b1a6b63ea9085d, 0x865db4d192c61cfe, 0x2fb69507e54dc833},
+    {0x13abcf3aedd0edd9, 0x767dd6372b447da2, 0xbc683bb835511ff3, 0x1f89263558c8fd69},
+    {0x505a189d19db178b, 0x2933e966f93afd9c, 0x358cfabf9b83dfac, 0x203cebefbfb2aa8e},
+    {0x5bf82a1b402b7727, 0x3c10defa6795f1da, 0xd934d1f5ca62b50c, 0x0af9b617820c0d98},
+    {0x487410751865cfce, 0x8edf4bfc36212b4b, 0xc0a309b74a33c63b, 0x1c5e9b44247fc47f},
+    {0x7c5c3eac14dd8afe, 0xefc27e97ebf05f97, 0xa6b8f454f6d377bd, 0x00962e3a5b641d79},
+    {0x8ffeb5d688790062, 0x44507c44f754b59c, 0xedd0f86f814b7aef, 0x2298274220f4546c},
+    {0xaac4d8795672a2bf, 0x8e50ea94a52b51a6, 0xb92b84421ea06864, 0x17b589b72e06ac11},
+    {0x82ea6e65a5a488ad, 0xcffca6ec5ac74952, 0x21296e6a318160a2, 0x12c6bccb33064fcb},
+    {0xaafaf04148c9f5d7, 0xc4e86bb9f5759d71, 0x81c541daf159bbab, 0x1fff9223c7198a42},
+    {0x02386f9f8fe00aea, 0x1a7a3a90db1abbb8, 0x8a42fbacd1227516, 0x0b7517babfe7ef6a},
+    {0x54b1c2e36bb6ad8e, 0xd087f52650060fe2, 0x068430838f81bbc3, 0x2a616d4a5ea70d69},
+    {0x9f214273b21fa5ea, 0x50bb0c15c9fdacbb, 0xd59b9138758ec65c, 0x10a45ad5861657e8},
+    {0xc4433671dbd56069, 0xbb16422e86c0ba4d, 0xa67d9420861309f6, 0x0cf593e4e4045ee1},
+    {0xd80972ee9db8b9d8, 0xd73426067cff04d3, 0x41d3a18d3550c6c4, 0x0599143adfca7a77},
+    {0xd5abacaa581c8db0, 0xb3b67a3fa868a02f, 0xc05da9ba2601e811, 0x0a7342f5a1b271b2},
+    {0xbe8be09ad455b316, 0x0f23c36d0fe87935, 0x915176aa3ad7bdf4, 0x24823f1db0866e49},
+    {0x7c2a22b3b9247c1b, 0xb149a8b6efdc6733, 0x0032e5a7cf6a6257, 0x08bc00e2b21b90fe},
+    {0xc4f334b4f233f3c5, 0xbe9359d022cc5e67, 0x2d238f7e21379ce8, 0x07b05e1de5f7ae53},
+    {0xb88de32adb1d6fb0, 0xbf8ab386a75f300b, 0x5f23eff276ce558d, 0x287e381d8f4ebb25},
+    {0x10402dddfcb47692, 0x2070cb7873c74d41, 0xbf3b003635fc1d5d, 0x24f1d2519616198c},
+    {0x232fdb8f0e209807, 0xc7af4551fdae9e87, 0x0c68c8b61045bc2d, 0x2d5d9065ce66f320},
+    {0x68d2141701b7ede9, 0xa8d3f720b8f827ba, 0x2b1e9dcbff9d6b85, 0x05b4f98948c94692},
+    {0x5baa7a19e95fc43d, 0xd6e2ba366d92673b, 0xa20b58492e527183, 0x253735141a834117},
+    {0xe773beb612f00db8, 0x0a28ebebfdc94496, 0x03f9f16180c75676, 0x2035eaead7fb62c3},
+    {0xe64cbcc8a20ec508, 0x4a7f9fbab33902be, 0x356829f2a0f11d73, 0x28895d0a84474c87},
+    {0x95ee4631b9c297c3, 0x2404d94c87a579d8, 0x0f6c92ec158f72f4, 0x0cd73a1fc4753308},
+    {0xad371ebdde60d46f, 0x9ee1e25eb7e1439b, 0x716045f31f242b07, 0x1686f65d9979dbf5},
+    {0xb39b9b270422da3d, 0xc34cd3067ca24d3a, 0x71ee6cf349208999, 0x268ed0aab94586b8},
+    {0xe940c8262b347d4a, 0x605858c5358fa3c9, 0x3d2547ce3ca671aa, 0x1b3d09c3f7d448bf},
+    {0xed412b912237052b, 0xf150e7455e6a3894, 0x8c7878ca4f96f9bb, 0x2fcb5aff4d82c2c4},
+    {0x3ad1edc1a9e9e48c, 0xd747a703cddfed6b, 0x559130b3114983f0, 0x1769e82e1834a13c},
+    {0x255cedd43f278606, 0x7f76b9f7fef399d4, 0xd1c66f98824cda97, 0x1bd618c7e8b98a55},
+    {0xac744339f4462649, 0xb4735b40bbe6fedd, 0x302172dd63ddbfc3, 0x2e0b456e4d1b10a0},
+    {0xcaa231837ef47032, 0x6ea8099911a80fa4, 0x0d94dc802cf1bca0, 0x15a613dfb40a574d},
+    {0xac03e4f94bd37084, 0x9b0ddceb0a0233e0, 0x226d51996fc27b98, 0x1a440f739a5078f5},
+    {0xf4954622e7388c38, 0xbd71061660f4a6ec, 0x818b57f126e91150, 0x1479d522aa22cd23},
+    {0x1b0976785b9a6431, 0x19ccc08dba3f6303, 0x511347c136aa3111, 0x1e1ccbcf8cb370e6},
+    {0xc105f4a776ae5368, 0xd7d7954dda5fd2fc, 0xeb63d73c4c13ab3a, 0x17afbc9c019f05ec},
+    {0x45ce014e962140bd, 0x5430859a6bf2a942, 0xb507b41ca09750e8, 0x1f9fbecade2de8ba},
+    {0x32a77f4db4de2c62, 0xb987d752899e754e, 0x30fa68a74227fbbb, 0x20a1b9edb37f1540},
+    {0x45b58bc4c57b7438, 0x3f28747625407b93, 0xd091379eca785da7, 0x0cda012f886f4430},
+    {0x4f716165f77c4774, 0x924b3ba4d09fe9ea, 0xe9f229ec23314def, 0x09d770db78525f63},
+    {0x0a1e2b32c652985b, 0x47de5a2690fac931, 0x3f4c0961cc0ba22d, 0x2a074367bc99a69c},
+    {0xf4ff083f06cce059, 0xef0060cb2cd4a627, 0x4e549051b32f72f9, 0x12cbd76e1eb4929f},
+    {0xfa2952c7b2e94850, 0x2be9adab745a100e, 0x98e60e917e767fdf, 0x23343a4932e8a10d},
+    {0xc8dfacd256e66bd1, 0xcacff94fb9efef17, 0x4dc353aa9cc2b50a, 0x29be9e9819603517},
+    {0xdb56cf3cf1569e84, 0x064a489a19579f45, 0x2b45f1f166a6996c, 0x022be5f5f43a4cdb},
+    {0x1a0fab0131fd96a0, 0xefce97ba42fdf9ac, 0x35c8112b63192744, 0x2bc9aab83b2c1eb2},
+    {0xc465f70930681584, 0xf3aa0dcb06c9e480, 0xaf527f4fb12bbc52, 0x26a696587373264a},
+    {0x8169b4522cd22b67, 0x90767ba61823e4fc, 0xf3a33aee330049e4, 0x20d9a2d37506fef3},
+    {0xc9e5c1bf8b4e6c85, 0xe69def7502a0a5f3, 0xea93bec783f5da04, 0x0137bc4b4d9db106},
+    {0x4c91494c4470be24, 0x7a67bfed8e1806c9, 0x610834fa71ed2c1c, 0x274b95d0dc6c98a5},
+    {0xc42fa6c0326886fe, 0xc91909aa4aa1714b, 0xb7d3e510b7050b24, 0x0390902e5d451e80},
+    {0x7083d7763d0b0a0a, 0xbf1da20d7b56029e, 0xac7f1493a5b78fcb, 0x25b8bec4f987130a},
+    {0xcc3d1e96a2f9a801, 0x07c8d3a704f530b6, 0x913b22c48793254a, 0x0ff48699da526a8e},
+    {0x602d979bfe13855e, 0x9d84a331c2db6744, 0xdbd5d4546e54dd4f, 0x1dccc9a182eaa830},
+    {0x2ceedab70bcde0c8, 0x94123151019d5dc3, 0xeded35d37bacf3b1, 0x2b82f54a6d41ffe8},
+    {0x99da7a3960b55686, 0x5973594e91e9482e, 0x17879ca4fb318183, 0x126ad6010248d7ed},
+    {0xbc306f46b3ee7988, 0x90c9cc5eaaa11d0f, 0x25fa3b853d49ebf5, 0x2262ca82b00e29b2},
+    {0x463bf869f66a0588, 0x0dde987b2eedb88e, 0xcd8d3b17196b973e, 0x2ceeac7e4e3ff46d},
+    {0x1d174cf11930a4bc, 0x9349a537db5e03b2, 0xb1d7f026ff9e4ee0, 0x1367a1ef17ecda2a},
+    {0x53f55f8a87485219, 0x6769274e5d2c4454, 0x715cc9c7f564f184, 0x02a26eb0678297fa},
+    {0x3107a0422cde39b2, 0xe5132e09e1e0afdf, 0x9c23bc191e7c01a6, 0x0813c0bc46479f31},
+    {0xa735fabc5b9c99a4, 0xf40f0a8298cad360, 0x2e0baeb0f9d1758c, 0x17473ba70b5c9d6d},
+    {0x8dee7e1ef7d30dfe, 0xc97997cdcc060c22, 0x866c67c654d02a6c, 0x034553b4c2f6176a},
+    {0x6362e621e19a9aa3, 0x9c0fe116894ff524, 0x67feabd20ab2c8d5, 0x24dda30748e0993c},
+    {0x640c6e7a6a127926, 0x9ba1fe83ce41cfd1, 0x81d1e96416a31b23, 0x1d7ff00f85d06bf9},
+    {0xff9f5559e8b4e07e, 0x4823da0efb35e96c, 0xb97e5fe77b73b631, 0x0b59562cda37bad8},
+    {0xf03b43826d5f1ee3, 0x2e236c81b677d09b, 0x46f1a0c4ed99231a, 0x16a512575efcddee},
+    {0x437b98112c55a491, 0x075473a4abbff054, 0x3881f9d4039b31d9, 0x1f1b68c94b29d335},
+    {0xd09b3a1335186e90, 0x93cf992555392119, 0xbbe65cd21f4fd1cc, 0x2120d948965f2957},
+    {0x52574f69a2f3fde0, 0x945a9f7c956738d3, 0x3821fe5289a2aeb8, 0x1eff27b20eca64d9},
+    {0x1de56265ca2bb9e3, 0x0f2251f9b0d98094, 0x14d715cbe80f11e7, 0x25b08f9c24e0b8a1},
+    {0xe2d81cff2a7e3fd3, 0xc9ea8ad146112174, 0x0000ac77c9515d39, 0x03cbfadb4c039003},
+    {0xa172e0bfab7c3be5, 0x2e3bc8a823bed8e9, 0x2a585e2646f3d053, 0x268df06dbe5bc2e7},
+    {0x686453a77f572f2e, 0x3a53276bf0baae01, 0x804498e1d9c4c7b4, 0x18dd9f7a0e8dd231},
+    {0x116f5d5f2962fcf9, 0x388cb2802478ce52, 0x31f2b53c3f24fc72, 0x0fbac01362cb7b5d},
+    {0xa965e756419b0e41, 0xf057b394a24c2508, 0x12c288a2362f2ee7, 0x2553b5a2dcc71e2a},
+    {0x32e87dcb1c33ea3e, 0x03fcad522339df39, 0xd17ca269c091f2b4, 0x15134524175473f4},
+    {0x1f89bddb4367e4d6, 0xfd1fa4dfcef756e1, 0xbbdf42e417d12730, 0x10156499fd693ebe},
+    {0x495016730bf78591, 0x57662713065cc9a7, 0xc9ff4efe4faf3a9a, 0x1e34f34f29b27592},
+    {0x4bcb2afb9da29192, 0xb8fc4a2ac665bf50, 0x90ed57963641e617, 0x119d462312090aff},
+    {0xa1a4302568f19bcc, 0x16ac09c8ac54b47a, 0x70974d3b2fe1bf23, 0x25893d4fd9f01668},
+    {0xfc91987a716cacc2, 0xd580055b905598db, 0x89aeecd87d7db64a, 0x07966163eabb27fa},
+    {0x870ff6337a0c851a, 0xbdf3d2da3288d714, 0x1a2c7f3bc096b9e8, 0x0e89b4334e6dee06},
+    {0x92e0f8ddb5989ab1, 0x0b6eae387f459641, 0x70b69b8d6054a122, 0x0add9257f1cd669c},
+    {0xa6473a0f2d0085ee, 0xb635ce98f859f7db, 0xaa79ef4c67f3bc39, 0x2e6fd6d40f2dd319},
+    {0xf50d451022c341f2, 0x2b73595442b56b46, 0x04aed79f603f7697, 0x0c88d54cdb755f65},
+    {0xe844e1f978267ac6, 0x58fab0ff918fc7fc, 0x94d83d4e3fe73d13, 0x2743f30fa4b3122e},
+    {0x1b799cb5a84c4d0a, 0xa06e3cab4c06102e, 0x84335f1e95426635, 0x05613ebccc100490},
+    {0x571b4aa30b184e9c, 0x2b866b49b8310df7, 0x9a2a702104201568, 0x15ea0cce60c9a7c4},
+    {0x1050835e5548ae23, 0x4567e2616f966b3c, 0x0790592dd4028751, 0x06643eee19982ed8},
+    {0x907a7434e3971e7a, 0x1cc935bed32df14a, 0x1865ec4f8b75273b, 0x18ce137b05d22526},
+    {0xdbd82a857db3bbe8, 0x2faaa7663e6d93b9, 0x307637679765cff7, 0x02136cb16ddd6feb},
+    {0xea654964e153a555, 0x948ef60683bb0e92, 0x4a02c8965f52f036, 0x0dc83123db67230c},
+    {0x73ad1131fdc9f914, 0xd436ac72959ad050, 0xcbcadf201516e9d2, 0x2083c765fa13ff70},
+    {0x2ca01546bcc028e1, 0x0edd85c91001a242, 0xa2bc620bb9421581, 0x08e317927e75210a},
+    {0x2ebd03443d90962d, 0x6e7d57fea6359e49, 0xe6475e9250504615, 0x0ea204d38f01a006},
+    {0x94378b60bf36bc9d, 0xcfa824726b596292, 0xe48f024070d1ef9f, 0x260eb8c7c1cbdfe3},
+    {0xee7654fbef6368d1, 0x8e3de5c8c5bc26c0, 0x819372f41e5e3a91, 0x00f1cd4bc57450a9},
+    {0x0e52b13bd4c573af, 0x6dd9f73f75c419ca, 0x51aefef3790dea83, 0x2a3cd2b83804adda},
+    {0x4ea03d739354d84f, 0xc9dc81b69f6cc7aa, 0xb60a531463c88d1e, 0x1c9d790ffe4cbf54},
+    {0x91f7b0b448357629, 0xc9a47e7139e9cbbd, 0xddd642b8a8499296, 0x0b6db409e6ef8d95},
+    {0xaaa1b55c450ee34a, 0x067096bd0ff48205, 0xb72455da75b33264, 0x2508e3b9661586c7},
+    {0x0c7b208498c06cca, 0x1c646c37806b91f3, 0xb99929d9edee0ee2, 0x05fdcae9b190b5f6},
+    {0x4fa69814f660ebad, 0x97c50c39f56f5ffd, 0x8c8a11e0aab1333e, 0x0de7b6579de8815c},
+    {0x1d880a1ab2dad1d4, 0x17f90d5081965881, 0xc29d834badf1f4ac, 0x005014b2b6d87544},
+    {0x07f2bd2a7fc9908f, 0xa5a01313dc6eb9c2, 0xbd90817c74d1916d, 0x171afa068f975203},
+    {0x094ea54886c4aab9, 0xd926d8d04072af39, 0x5e104d00980d7fc6, 0x2dadffcef3888542},
+    {0x206d692649420364, 0xc8c42d4d8bfa4d52, 0x25e2c9329f020e24, 0x0e84b015db322dfe},
+    {0xeb34b64929f7244d, 0x7acdb819d599bf2f, 0x9a026dcae1b775ae, 0x0124526a492c8948},
+    {0x17cbfa76639793c6, 0x7a0d4e81773f086e, 0x0980144927bae1c2, 0x2e45dfcd5052eab5},
+    {0xfbf26d0bd359976f, 0x5fa1185f376d695a, 0xae663338d6b9b285, 0x1715c0813a52b9fc},
+    {0xd574532db31a0dfa, 0x4e6d6d5a7bf4fcd5, 0xa417e6022826869d, 0x1a7c0319857644ac},
+    {0xedb3670770f40de0, 0x050709056d5cfe7e, 0xcd4fecf79b044616, 0x16adea364f0d3a6c},
+    {0x50a3f7c08b363688, 0x1cafa648096f48b6, 0xb9af1220d031007a, 0x11f60ec56910d58d},
+    {0x35be4381afb8ee98, 0x566886a96a1fbde4, 0x651e09cb18817da7, 0x181eefa70c4d7695},
+    {0x6aeb847fe7de80be, 0xfffd4015ab51ea61, 0x4e29b34c1c9c116d, 0x192544b955d45d64},
+    {0x4d066a4d674d5ee2, 0x75ed699631943814, 0xa833f030a8839e6a, 0x209fa81b269eacfd},
+    {0x76abf8a17cac1be7, 0xaac17f042ec53e7d, 0x8cb2a043b6b45456, 0x0b218f043b0bc8cd},
+    {0xd8199d2a3ea77b69, 0xd33be7ed91a203ce, 0xcdbe1982cd6ff735, 0x0114113de13b0254},
+    {0x1db4789223b526c5, 0x786b8d81cfd6fe0d, 0x394784f631b2182a, 0x15f43866f4dd151f},
+    {0x95cab02d15d07272, 0x5cc8b9937db859e8, 0x3a6e65b34e6930b2, 0x1d80a6261ec1175a},
+    {0xa6937646b8fe81b5, 0xf199dc474b8e1d8f, 0xd43d4a23d028641e, 0x2d1fa0cf15e34f54},
+    {0xc040b31a8984c904, 0x5fae9012149b756b, 0xefedf718d6b6d48d, 0x1ed67fb50c5c1ea8},
+    {0x49284c74668877d5, 0xf6e1c795aa3c0d2e, 0xa89f29beb1845fb6, 0x0c9f6d62c930dcf2},
+    {0xb97e924fece4ca78, 0x5a47fa120002c97d, 0xba4a5a0f99298937, 0x15cd7ec7a230a887},
+    {0xde1d5ba99bed478f, 0xcff1b94f65fdbebd, 0x1be2099e713b0444, 0x131d2628a7f9b5e9},
+    {0xf2237311ef36e5a7, 0x43ba531480e53e66, 0xc7d44d4eb575c0eb, 0x22770c31950a117e},
+    {0x97e8136e95f4f176, 0x4ce03fdfae5cf308, 0xb760cf1a10eaf70a, 0x1788a378d08da470},
+    {0x026e00aeff54e458, 0xa1d3981f3b8bc406, 0x6a579ce426b9bdbb, 0x01855601372d88a2},
+    {0x1ef74823cd6a31f4, 0x1903f5f408967d75, 0x4faebee236458fb3, 0x27ea4898afce63a7},
+    {0x4b39c1ef684f1d59, 0xc8281d319fd65949, 0x9c17b2504d0b375e, 0x1037a189bea2f5ec},
+    {0x5fb83cb3d74c6b39, 0x14d109e58ffd5dd1, 0xa33a52f69f6d34ff, 0x150c9fae6fa519aa},
+    {0xb926ef97b7b3b4e7, 0x219e61eee41ab814, 0x1f9ca400c0ba737c, 0x1e9812afc21a7050},
+    {0xde5b527846ffef9d, 0x7113fa8068f5a90c, 0xeb2d5fbd814d7dce, 0x0b12331843f422d4},
+    {0xe55ab41499381fb7, 0x5698722c3f3aa433, 0xb04f3427661026bd, 0x085da8263f8d4b87},
+    {0x6dd63bbd845cc024, 0x2ad3ba98ff5a955a, 0x51b49bc960f9504e, 0x2dca369c931fa4a2},
+    {0x749e1a563f85da3c, 0x7d56761cdddef147, 0x943a02b8bf09013d, 0x137ff0d3570acc1a},
+    {0xf78a1f7c2519c3a3, 0x1ef99724f8a6db5e, 0xd1575ef90d57be81, 0x0d30eddf4d5ef4e3},
+    {0xb558227ec2b354d9, 0x3ff3656395d84269, 0x3b442ee89a9a865e, 0x1f9e7e9916f4f5ac},
+    {0x0e57c5f9cd1a5b90, 0x3fbcfd7bf1ab093b, 0x6fd5a3f3b6cc28d4, 0x14099695c6092c25},
+    {0xe67ca79742e35fd3, 0x3ccf4cfacb45a633, 0x11fd0479f3648000, 0x0ddf17e910cb14a1},
+    {0xf67bdeceeb0b3883, 0x2a67f4271421eca5, 0x22d8d8ead61c12de, 0x13e58d6507853b1c},
+    {0xddd41382def99d26, 0x710d623ce861d3ce, 0xef7f12f19cd2c257, 0x0d1f29bfa49af2ed},
+    {0x8dd6e93c9ac68299, 0xce441e232141b52b, 0x3f0186d9268402f0, 0x2246f11ec88cb962},
+    {0x9624d4ea9bbefea0, 0xcfee7c23bd072798, 0xe5ca169ac9024ad2, 0x28102bc360c90427},
+    {0xc071f223c48bfc0e, 0xbd0ae55bae08d9a7, 0xef567245ca517436, 0x2ddc6bea50bad9f4},
+    {0xb5c9763dd8dcb0e8, 0xd995a2c07969d914, 0x26250175048f8167, 0x0becd75b561e73ba},
+    {0xff796c47b857d457, 0xeb12dfd259e360ab, 0xc3961f1dc6da8652, 0x0f5cb5f0dab4b4a6},
+    {0x0dd28d1df50224b5, 0x784908b5c6b539a3, 0x06fe2d00c6809b81, 0x0a1f6402b9649bdd},
+    {0xf300a060a2800674, 0x277fc1e4e83db554, 0x95d4c4f51f882764, 0x04351673b0353bd6},
+    {0x54b2284aa3b002b6, 0x3596d48ff1203f59, 0xf82e8162c4ee05ea, 0x28a7d25e6c042792},
+    {0xdd23ecc614c97bee, 0xcccbdf8de52f9501, 0xb8a143d45b22f76e, 0x2da62c7ac95090de},
+    {0x8f90c35fc631baac, 0x041fa7091a1ab1cd, 0x59b99e82f5b8b163, 0x2f5401ef401ec99d},
+    {0xfa4e1fab3ec89404, 0x0482c65c16040abc, 0xfbee73aeb4466617, 0x0a8c196694b24178},
+    {0x6e74a2e2b09ef524, 0x4c022d55b502eda7, 0x5dfe0483a00d5221, 0x0c14e0014544f0a1},
+    {0x759b833ba33676da, 0x23dfcc559f55e80c, 0x216b5f6a531c1dd7, 0x1fb27276ad20aebf},
+    {0xb1a70a504b6537dc, 0x314ede2c2ab2e23c, 0xd27176b7945ee5ce, 0x0a2a29298efa823e},
+    {0x40af5f39576c0803, 0x0879efe6fdcd41fe, 0xd41cc3491155f6ec, 0x1a79241cab1c5cbd},
+    {0xca164f5f302b9532, 0x182336b2dbd179cb, 0x65290654a404c86d, 0x2e81d0890fe5efae},
+    {0x9323b5179ffd965b, 0xe3c22adcdd6507d3, 0x18cd6fd98b4224c6, 0x0f9ca4273134b1c8},
+    {0xd63675d4331609a4, 0x679bd12d4b2d8250, 0xaacc456b671c23ca, 0x29cce00e689210a0},
+    {0x9de7bc240b016cd0, 0x93316cbd9cdb6444, 0xcdd6b8172c14db99, 0x07cb3c14425c384b},
+    {0x1ddcc2fb12b8e114, 0x6f311b9a351f8172, 0x5e3ae9086e09c953, 0x227e5a2969aa5746},
+    {0xd5ab9e9dc1eb0642, 0xdccffd7639c01b67, 0xfd41d7e753f09c6f, 0x06188232bb216621},
+    {0xd6910d065806781f, 0x431625d17d37b99d, 0xe4359793cbf706f3, 0x25fbc05242aa0b3d},
+    {0x665000450286a653, 0xe2103e5f56022429, 0x8d34815fdbf24da5, 0x06f379dc7457a093},
+    {0xf48fe5ce8f5d99b6, 0xf927eb5795117c5e, 0x2f58f471933932bc, 0x03649243029e6bce},
+    {0xa0a1843ed2d3ede5, 0xe8e19a19bdfb87a3, 0x7aa6ede1466d8475, 0x210eed12dc7bd61e},
+    {0xfb1bbb0cb1fc5a60, 0x78c9879f67d53f2e, 0x01f31ad2a16f816a, 0x0ba0e74c0e4d31e2},
+    {0xafcd2bbdd0f67272, 0x68103bf1ae8bc465, 0xcee71d1cd0c3bf6c, 0x09d4e184b629075f},
+    {0x6e9e78e538da5912, 0x07e673c61711b725, 0xd500254fd68e6828, 0x261496b76b6ac210},
+    {0xcdfc9d134ab9f1cc, 0xb16497d87ae09547, 0x54af465e99e97bbd, 0x300b656d2f0f91da},
+    {0xe7fefb2e7abba3b6, 0x2f7ac7f9d540c512, 0x3f6defc1987dc50e, 0x2d26dca273e6d87d},
+    {0xb7578bddbdd71c10, 0xad01fc7b8ec2454e, 0x6f9fc95341cdd775, 0x19fc3b947c9ef96e},
+    {0x6aebe4abb529cc42, 0x661d1aa5bc3557d9, 0x5ff8811e2fe0e336, 0x19f531006fa6ef95},
+    {0xb97bd4f689688b5a, 0xd429ca9e62a3a778, 0xa42ecf77d23d880c, 0x114be0fef3059b9b},
+    {0x7a8b1a1af02bd19c, 0xe55afb6eaadedf94, 0xc50edfcba3496e90, 0x0083636b6ab0d43c},
+    {0x61fe9cae5aa0bf07, 0xf5817158ceea0671, 0xf9460b2fe93af900, 0x2df6b4861218ca64},
+    {0x32cb1cd90382b3fd, 0xd682e5176644e4fe, 0x25db2ccfa706fd4c, 0x13403c6b13a375f2},
+    {0x689bbcf174b16678, 0x3570bd3b6f121e83, 0x6861c33b50f2d283, 0x0396a857a3a5f0cc},
+    {0xf3eb91c19753e74b, 0x27b5849e05dedd17, 0x67ee46e6915d9c51, 0x0e2759f87aaa4415},
+    {0x8ad471653a893381, 0xcfd1431925f1f4a7, 0x1833109bf7752ef4, 0x2f35a7de0a18c2b1},
+    {0x90604af5f2ce7a1b, 0x8781df1dcf97bf9a, 0xf4a3a101b621ed4f, 0x05626b577ea36f63},
+    {0xf4000d0270d5930e, 0x4963c4b226b89f45, 0x2c38979d7743c087, 0x190544b0dbda1727},
+    {0x15ac6bbee2ed578f, 0x0008038f9cddd3e6, 0xda2457366da59eac, 0x06a648450bc4f512},
+    {0x8eec1bb2480bbab7, 0x50128a6f5881977d, 0x6dbe67cec578d9bf, 0x038af954148368e2},
+    {0xf3118cfa2f978549, 0x6a7dc191e8c9c84b, 0xaaa376f48473cb9c, 0x1b71bdb99d2e83f6},
+    {0xd712a2d62f6c77c0, 0xf83adbe9879f04b7, 0x471eaa5e110061d4, 0x2b3d30a2ceef79dc},
+    {0xa654afc26a852040, 0xfd22ae052c6a3ac9, 0x1f1d0b6375d416f0, 0x27a6667c8ea52c52},
+    {0xfd3d7d4f69ca0271, 0x6eaae2b3cf64c3e5, 0xb401068b95b02953, 0x268fff84e5859724},
+    {0x83a1754dc1f5db20, 0xae6eb875f0001f33, 0x7912ea23d4978b20, 0x140bb5e3ffd7d2f0},
+    {0x14cb8804ddd7dde4, 0xbcd00111cf06b2b8, 0xe7704475e716894c, 0x02eb5cbf3b01ab2e},
+    {0x848f63fd178729a8, 0x5c65288b4d676c0e, 0xd3c69d8426f767b1, 0x244d833e8c903124},
+    {0x83d8080fdb59aac4, 0x05d09aad8246d62c, 0x2065179c2d87d932, 0x15ded499a471a374},
+    {0x1e818de4689a7a28, 0xab38138906b50512, 0xb7b6236f2dbfca32, 0x2bfaa33d5e933e17},
+    {0xd948a4d3386dcc08, 0x388a708c25bc04c5, 0xf4419fa588cc9465, 0x123ae41e34795158},
+    {0xf766abf2c16ae7ff, 0xcae1f74ccf28e8dd, 0x4fcf7cbd7cf91773, 0x25708ad8100e291d},
+    {0x0a7a55819707ec41, 0x291ffe095b9d82e7, 0x473d1e0964362b25, 0x11f3f268b4d3da33},
+    {0xf3e8a2446c46ecf3, 0x296ca02425e1bc0c, 0x8eda3c1bf700b4cd, 0x1f775460be137b67},
+    {0xdd3b2dac90396249, 0x1f2c53043353e049, 0x3bc17e901ea2a868, 0x0dc6bba61434d9af},
+    {0xd701ab71881c8c5a, 0x4618856d3f93c885, 0x1c0abebee135d048, 0x2d7427b72414be11},
+    {0x3b2461b209cde70a, 0x00f1ab16a80b1e6a, 0x267b71400e940a90, 0x25ccde69f4f7b85e},
+    {0xa5c0d0371769b15d, 0x3ab26eaca86e3d9f, 0x9a9adf269dbbaed3, 0x1099cf2cb731bf8a},
+    {0xd44a805a7713a7c5, 0xc6cf809375a28307, 0x563e65a811d33be7, 0x276c7e6dc2c5a943},
+    {0x55379a82ea5b27f4, 0x7e00caf924bc1038, 0xbbcb014e4efee54c, 0x2b402b13121aa7d8},
+    {0x40c930e1d3360bc1, 0x99bf45de8d7a4bd6, 0x2ddc340fe769cb23, 0x233db74c1dcad733},
+    {0xda94e58b8e5a98e0, 0xb8a554e7ee66fe18, 0x34c8a254c4dc5a78, 0x03c311be052bab2b},
+    {0xce9d1871f9fb2666, 0x83420aa5f27141af, 0xf4879b002c65f032, 0x21c04921e19ed8cd},
+    {0x623528a4db4b9207, 0x90a320338d2d0be9, 0xdf4cc996b338d1a7, 0x2516a9529518c79f},
+    {0x71fc631033dc9f08, 0x098779673afd29a1, 0xfcef59cbb06ff123, 0x1f359082f5713aa6},
+    {0x4df87aa86648f705, 0x5c19cda89c1ee310, 0xb6ca9700f639c55e, 0x1f619aa58241f7a7},
+    {0xd34f49393d2d250c, 0xb4cd1956be98925e, 0x9ed8d0d3255e403a, 0x0c4059be9f5266b8},
+    {0x040ae650baae15c1, 0x03e61581f4b3f552, 0x167e15cb5b224adf, 0x15e03dffe65bd210},
+    {0x56a4df23e56a9623, 0x70af1c072d9d6884, 0xf4a54695b2ea2650, 0x27c049fbba543535},
+    {0x0025a28c4da47ff5, 0x69aa508f7c635aa5, 0xeab093d6b8e2d87a, 0x05ecfd9349109d34},
+    {0xbe9d877ea58d6c01, 0x12308f47e6e06882, 0x930b53469426aa29, 0x09531df992754faf},
+    {0x4662e03722d2c2da, 0x13cf388f142ecd08, 0x09470ca5d107473a, 0x0aa37d161297989d},
+    {0xdc941e8262a6c2f5, 0x566b0e7b5410e8b8, 0x6c4c410b79043a38, 0x13fe1e144e745df6},
+    {0x3241f175b34095fd, 0xe22eaf008ed23e89, 0x0d9d83edadd1947f, 0x052e50f224ed7665},
+    {0x345e56a5153028d3, 0x9ad22335ff2174a1, 0x4355508f716b8a1a, 0x2b413bf3f0107724},
+    {0x39cc99294caf729a, 0x3f8c3f508450cbc3, 0x450924335431f6da, 0x0c32363b84f7066e},
+    {0xa7788cd376f6c148, 0xad3809f6b7417b9c, 0xc8cd3705fd9979c9, 0x1a5409082b2359ba},
+    {0x16c38f0200472cd1, 0x3e7fb8b8916b9cbe, 0x043dc621a79a6950, 0x299977775793ce7e},
+    {0x47be52e57cb4662a, 0x4f1861290794bf80, 0x85af40a211c184b5, 0x2e5eb6aa3bbf492b},
+    {0x1f7ee4fe80bbdf88, 0x0e22292e9fd774ec, 0x38811c39ca0f1000, 0x0443033865aa5cce},
+    {0x0eeeac0a35b36f26, 0xaea81deb437d2aa7, 0xd47627923141bc86, 0x1202e06d0a791ead},
+    {0x354f11c6a8e8717d, 0x853fcc7bfd9f9627, 0x1fc5e72243c5b3f6, 0x1f83a595603bf279},
+    {0xa195ec47ab11f6ef, 0x4aededfba649258e, 0x1d99f93638040f52, 0x13f7daa0b360ce84},
+    {0x85eb3e13d1998e12, 0x46a95b2aef502149, 0xfa8c89f444cf9aeb, 0x179b44717cb15c4d},
+    {0xc86bfba16946b45c, 0x98a9883aee9180ab, 0x553ea34507806e8a, 0x2e7b61c93a30ef69},
+    {0xb9093f0c540b870b, 0x28e2f4d9a54cd1dc, 0x32395f6a00d42a68, 0x156848e6202269f3},
+    {0x2ba805538a0621b1, 0x1e597193679d9ef0, 0x454b5f400b4f5afd, 0x221818e3e3f8fa31},
+    {0xad027b8dbbaf89e9, 0xe61fb895948939ab, 0x2e8cf288871ec586, 0x078d3d1a09ba7a2b},
+    {0x00cbeb4b4a0e0ac6, 0x5af4fb1f3222a99a, 0x74742b919990061c, 0x29d5214ec0fa4da5},
+    {0x18cadbe37a3f93f4, 0xbb6b72ff20e026de, 0x8dd7142e413f080e, 0x26abe155deee7088},
+    {0x4097641535a0217a, 0x0fd1b8825f59981b, 0xe6a5e5bda2c6c9db, 0x22baf2c1b6d22a43},
+    {0x9fe39ab15d452dd1, 0x9f66857a5a300cf6, 0x0b1d69a75cfea1f1, 0x239b701a67adba85},
+    {0xa32e282d2f2c922f, 0x46732bf2e89682fe, 0xa1665d24dd33d8f7, 0x258d3f1220dbb6af},
+    {0xd6d38cb49aa86d0f, 0x9cf2283e00771daa, 0x0de29ee45b749602, 0x1dcd27c6f28264b9},
+    {0xe270281c625c9e0b, 0x673cf67caa26a08d, 0xd208107949368716, 0x1cbd320965d01516},
+    {0x1a555bdd13df5a13, 0x35cf4fd53554b537, 0xf76d4a3d88d36832, 0x0a6295e91af814eb},
+    {0x4161c7970a01629f, 0xcc3c78c2379862fe, 0x4d955e602b1f4722, 0x08c6ba7c0df2e340},
+    {0x03422ab397beab0a, 0xa927fa25f89b49fe, 0x6310e25ba27c8a5f, 0x261202cb760507f8},
+    {0xebabca91bb885bb1, 0x8faafa6f0bc9a545, 0x7de969a702d22760, 0x1956f63e842e0427},
+    {0x841984d33bfed6c3, 0xcc5dc57740b15520, 0xa78a6d6fce2bdd76, 0x2ac20d99d2854b42},
+    {0x586ec10ff6270302, 0xf884111653a4ea45, 0xd61f136911e8eb5c, 0x2c568eb78943d3f1},
+    {0x224ae2d0e86f08c5, 0x6f504c5def80f2c7, 0xc3241b8a198baaa6, 0x0fb999109b282652},
+    {0x2ea32cfbcf5dab35, 0xd11d80f5c986036a, 0xf28297ac71c4f25e, 0x245df8edea1ddfad},
+    {0xb6559e922b72d241, 0xa91e501eaf770518, 0xc4d8173180cbc1d5, 0x12e671444b4cd748},
+    {0x794ce5f02b44915f, 0xbab1e6db46962fe1, 0x3725e76c948bf3dd, 0x1699c4ee050f46bb},
+    {0xb91be8ef269e0dc2, 0xf9e207c041d53cbe, 0xa72156627ba608c2, 0x16807ff307485283},
+    {0xabd8b7eab1866d4a, 0xcf61696ab50208bb, 0x34ef20c079d053d4, 0x11dc534bc7dc9ad7},
+    {0x50041f75db66e31a, 0xae09daa4fb48ec2f, 0xda4a29e598d2bb21, 0x00e455664250b33e},
+    {0x3a47feece5898f3f, 0xeffdefe99af4458d, 0x362d0dcf6e8859a2, 0x0a5fbd21b8fcd612},
+    {0x1387c3793aa55c28, 0xa857ac8020ecc43f, 0xebb03b61de615fc1, 0x1444bdf06df4b4f1},
+    {0xab0b7e596eeaec47, 0x67bb3d198b528fe2, 0xe3db7423948ce953, 0x2a15d14db3a3b177},
+    {0xd295c7a34922b2fc, 0x0c5e1597910e7f04, 0xc47954a687250c80, 0x06f5d69c92fc936d},
+    {0x73cec62a48396530, 0x7f2e2b9ca1c2ea9a, 0xf1206ea39a5c8f5c, 0x09437c2715d0073b},
+    {0x52a122c4e5f18f08, 0xef31144aed5385ec, 0x3b2b3082fc493e8f, 0x202b8bfe0baaca37},
+    {0xb0aedd11946887c7, 0xe341b092c0dfa71e, 0x0db5da1827c3dece, 0x0d8defc7f4878806},
+    {0xb238cf4d6b6c5d9b, 0xa96c400db87ff0e9, 0x45d55732f8e7832f, 0x0aa5a27a6c161c9d},
+    {0x43b8234ae33f3f9b, 0xc9cc8308bb27870f, 0xa052cb3420033ca1, 0x1a673e2b0f29010f},
+    {0x05f2939c332f6a95, 0xd6b29d548e96ff59, 0x35abea5d7714f881, 0x2f34c69baa03b05b},
+    {0x1e7c1fab604d05c0, 0x9372e934a5b8bf56, 0x81da39e1b82afed3, 0x011f7adb14f8c449},
+    {0x2ad8190e6701d3df, 0x1f49003f9dd3b84b, 0x7aeddddca98edd78, 0x116c805d36fc2148},
+    {0xce7b4aab9d02cf01, 0x2081f7fdb5e4ff82, 0xb651dabf9827d522, 0x2594b3cb09c5d7a3},
+    {0x372050463747866b, 0x96a401db0557cf6f, 0x77ea010168a37c91, 0x06c42dd8dbca18ce},
+    {0xa1060369af4b04df, 0xc1ffedbefcdaddf2, 0x0a53aa8b372abc8d, 0x1d2cd813d866729b},
+    {0x76c554e0168bd084, 0x85aad45aa8193715, 0x3e7da0ff2652d125, 0x1ebc5ee79aec78bb},
+    {0x11e1310a50009fc6, 0xf47bffd150474402, 0x3d75ef1b80c4e46a, 0x12139215233daecc},
+    {0x6d158e647d279006, 0x3be9723b39623f6d, 0x79982ca8713537fe, 0x29b2b0511e0b848f},
+    {0xc02c31226467e9ce, 0xaad1b28be8559705, 0x25a9af9f617d62b0, 0x15a096f565eb55da},
+    {0xf534f186f7956e62, 0x1768cc9369b79fcb, 0xc541609724e26b98, 0x1fbc99db1fbca3b2},
+    {0x8d2d7e0610539d41, 0xf9325c7c570b9db6, 0xde9fdaf9dcbdd759, 0x1a3bdbdd6e9ae987},
+    {0xaad2ffa625a32ad6, 0x47ac7e69940a3675, 0x6ad8223b6d4c2124, 0x287cde9cd9edbbd9},
+    {0xfd7c8ad20337c25f, 0x41baf9e8726d210a, 0xf16e4b515a950b4e, 0x27f843791fb030d5},
+    {0x3648dc5299710358, 0x0cdb812fe3c19be6, 0x7a996d401115c4c2, 0x22516066a9475bfb},
+    {0x4c0c0dc545e4fe33, 0x3d52a5caab97b507, 0x827e98788f2a7350, 0x26224e417b7d1484},
+    {0xbb8b7385838c443d, 0x868ee161ae6fc2b5, 0x9ad3de4030739e4c, 0x02ac30cd809c1530},
+    {0x51b3712a39a41606, 0xd52b4e9c8b27169c, 0x2470f359cc7a464c, 0x15438776ff1b1ee5},
+    {0x4e1b6752ee78bf6a, 0xcf3d5708c19c2e10, 0xdbc4327c2ae9d3cb, 0x18933c1205fd365c},
+    {0x0758f7b18e809061, 0x25244d55ddd62876, 0xa346fcd7fcb8df1b, 0x0f227c5944f01732},
+    {0x47571eee922b4b88, 0xf7cea3417b00290e, 0xb1c8de23bd39e738, 0x2e9190f97a381c76},
+    {0x526fe7bc54c3dd65, 0x5715e276d76e7986, 0x488ea9f80a7513e0, 0x2f979152b16f9777},
+    {0xf0ac056b86c554e7, 0x27cc32b6089f53a0, 0x5a6c83c477314d1e, 0x12739f3029edef51},
+    {0x7d694697570db8a8, 0x74d746c5012c8749, 0x7551c4fb3a02299b, 0x075081f8949b5187},
+    {0xea2c75c89147ee62, 0xf53c74457568f541, 0xab3cf3128084944d, 0x0680894346ec3285},
+    {0xd40482047e96e615, 0xf15a41a7b279d0cc, 0xc959950829138c02, 0x1a8791d40e09556e},
+    {0x91d345a21c00943b, 0xbd2a47b9fe02c2aa, 0x798ae90c6ad52828, 0x199d9ff527357632},
+    {0xe8ac1db24e6a1c74, 0xae32fcbaa27b4cf7, 0xc5fae565abbfd182, 0x189ca68254c07624},
+    {0x1026ca956f4c08b8, 0x66bf75aaecdf9d27, 0xdac371fb7d4d6203, 0x15d88b6c3fafe22e},
+    {0x917754c23b2c132f, 0xc9b2ad1b88692b42, 0xc0ea640a5753d974, 0x2f677e1420572132},
+    {0x666ed0cd1fa55c14, 0xdfa097077b2a0034, 0x41c0b91c7c62a322, 0x2fd667624e1281ef},
+    {0xe4fa59977c8ca58f, 0x1687d14df37f048f, 0x19573c08b89fd8b9, 0x1c09d7c64ea459ec},
+    {0x611d7d7fd465c52b, 0x0fd69342b32393f7, 0xce3eab58c00822f0, 0x2eb12cf46e24b7ba},
+    {0x4bfa76554b4d15ea, 0x30236d5df3779d9f, 0xc7841ff4143773cb, 0x2a14e651df3f59a9},
+    {0xa8490cd78f09924f, 0x1f899975867d21cc, 0x1685dd89e2537dbc, 0x21ff73a29ae9c346},
+    {0x19757bbacebe911f, 0xf8aa20adc834a84b, 0x0afead840b5861d0, 0x161ba6f284f584b9},
+    {0x61e2f820866d63c1, 0x3aeb1dc93e24a406, 0x54e32cd998e3658c, 0x15d722d09a51e88e},
+    {0x13bc0b478de00df8, 0x89ffda9c6cd376b5, 0xfad8294999932dcb, 0x2c82dc51509a3f44},
+    {0xb322bccc95dae293, 0xb2ca743482d77dfd, 0xd9b97a7c7a2b6ec9, 0x2b0482c4a06ea504},
+    {0xbf5b79097ae6160f, 0x13422cb685d1aa80, 0xb5d31185cef9ddb0, 0x1c38dba0c2a9c40d},
+    {0xcb7cd352d0f268e2, 0xc5fc1f51c024ec9e, 0xffa9292a310eef23, 0x156571cd91ffe74e},
+    {0x7d8c911481cf5acf, 0xbf1c9f1802729d7a, 0x82844ed98632771d, 0x07b5bb143a49e717},
+    {0xe6a95b4de8818685, 0x6b692ab0af6ceeef, 0xbe5cd47a2f476fdb, 0x0fe8cddd03dd489d},
+    {0x699a77e8c6ff2764, 0xf55a338881fc4e7b, 0x6aa30acf21c6ee93, 0x21bba4cfb01072f6},
+    {0x969119aedd97cfa8, 0x4d0b13c2ac36b7a0, 0xaa03547c70ea01c4, 0x2ad943b3df3db94f},
+    {0x139cde747888ed6e, 0x8ee073861c30150e, 0x0a838843f274ee60, 0x0f6c59280f18e7d1},
+    {0x8b0dda0695b39242, 0x2a9fe9f418371f8d, 0x5e04a2349d3565ad, 0x06fb6832d579ceee},
+    {0xc20cd8500181bf32, 0xdd68e17c86361e5d, 0x981c46c8bb31653d, 0x1020a2ebaff7d463},
+    {0x7d342de9872ec37a, 0x60025858f2efe2e4, 0x407052da1b351ce4, 0x18b7b8158ab997eb},
+    {0x7d1b0fdc8571e923, 0x28c822a2de36778b, 0xf8d2e1e3ad7f6404, 0x2eecd0917bd66a46},
+    {0x0484b179319d1305, 0x9ef001ee3a529e46, 0x46bdb5623c524d9f, 0x0acaa8ba020efb00},
+    {0x730b3b8960f3889b, 0xacc8fb53a9305709, 0xb6f1ff3ca9cb2bd7, 0x2704e4d712d1c00b},
+    {0x680cad4c833e045e, 0xa2154c5f391f0057, 0xce08c9f2634142ef, 0x0d877a7975cb0483},
+    {0xa1dc563d12edf8a4, 0x3bbbc91a04391eff, 0x5ef419edab7897bd, 0x2dac95ace708a768},
+    {0xb0706430dd5a3c56, 0xaa17c6317384f1e9, 0x8ab9c01a14393b1b, 0x2ad9e7b0a4177e1c},
+    {0x60cf639ff53eb47e, 0x99ee51299b8d5c62, 0x1e8974ee12865e00, 0x303b9fec0b4d8528},
+    {0x12d75d03caeeafca, 0x812e2900359a505e, 0x530a10b3be471a0a, 0x06d413e8685af709},
+    {0x294ab2627359feaf, 0x5e222e3b84a25d0d, 0xcaadf3ce1f61107e, 0x0b136fe87f00806e},
+    {0xcf1626f842c6ead2, 0x0092a2d18e09bac7, 0x0d91ecc75b47406f, 0x0c5800ca5f8d2f03},
+    {0x86a81aadac946bd0, 0x445cdff072c0561d, 0x1f77db0cd48e903a, 0x1e375094ac6f3198},
+    {0x16a0a1e394836dd1, 0x6e635d22c9cb4e84, 0x863e365ea30e3d60, 0x11a7602dea046461},
+    {0x446067ca1f7f8a04, 0x3133b88a88db4b4c, 0xa34dff135e5e398c, 0x2603b2a953e7b953},
+    {0xa076a12cf4f9ce09, 0xf321d61338219928, 0xdf3ee787efc7cf97, 0x28dd842816ab1c19},
+    {0x5e731fde20722a00, 0xd4405bca87121d8b, 0xa5613480367f4a01, 0x017e07c06c7e20fe},
+    {0x7946977acf38ed4e, 0xd83e8e2754cf013f, 0xdcbb3a86005419a8, 0x2050d94a12201c9e},
+    {0x29a6babdc104b16b, 0x7b4894db1cb5409e, 0x5d80874813c0deda, 0x1ac4ebaf24e0d6d9},
+    {0x24455049df9a7457, 0xa528db33c92b4f66, 0x48dd593c961f94db, 0x1ebb02fc2f8cfd4a},
+    {0xcd4285f016cb515a, 0xabddbe3109769eb5, 0xdf34b3fb2faa172e, 0x181e87add29fdce3},
+    {0xc2555536a9d092f5, 0x25f2947ec0fb8959, 0xe72cd9a1dd8a9126, 0x23baf950f47cbd72},
+    {0xdccfd71ca91a7a26, 0x61e0752057a8a8a8, 0xea4dd10573d8a5bb, 0x1c162a717bb14dcd},
+    {0x1d63a999228df12a, 0xd674f3cc34610b4b, 0xaf1113baa008683e, 0x29fd83a0524fc3e5},
+    {0xa3948f465c991226, 0xe456a7440b656f91, 0xe740ae6004ac8fd8, 0x0ef46b271daa8355},
+    {0xba70927037f190b5, 0xaeccd6998ad48ecb, 0x182abdce51749ecb, 0x2ad9584d273a883b},
+    {0x9e09fefa49e2f919, 0x7f3d6a7a4c45e1f7, 0xd5c1f3b63a3e97ed, 0x1db295f1345ee7fe},
+    {0x2897a295af25bbe4, 0x140e4984d958c69f, 0x5759a23fa025c7d8, 0x1b6ae05f1847add4},
+    {0xd20f4c402b5e079f, 0xeb6cbcd81a8a70c6, 0x16b0970b895e3c74, 0x0dedc0917bd7dfeb},
+    {0xe606f0ed121dcb3c, 0xdac0d39105bcdf9f, 0x0278e8abb8ae0ca6, 0x0a966908580229e8},
+    {0x1219ba12a8f8bc72, 0x0a9c8062a4dc2fee, 0x0e513a0357336ef7, 0x14c61c1c647a351d},
+    {0x9bd7787420cdcd02, 0xcdd1346026d06629, 0x3ad3608d0e041f73, 0x27a3fcb6aba78b9e},
+    {0xd2ce6a487b7e39f6, 0x24b38b138f4ab68d, 0xb1f371404fa39da7, 0x046565e967fd49eb},
+    {0x25084911dafa9730, 0x74264db3305a1372, 0x680af88620e6c7ae, 0x23eaf5caa78414fb},
+    {0x817c06e92d5fc225, 0xb949ee32f2538c05, 0xfd3a07c851229618, 0x1d73e35da3a412a1},
+    {0xafc244da2298460b, 0x4f5e878943a9497f, 0xf25fa2c5e82d1f8c, 0x077f42073a608e69},
+    {0xd13d00b1ffdb2995, 0xad9c28997d539d4a, 0x44447fdf921d9997, 0x05742854734683bd},
+    {0x1cb11a39ae8e3389, 0x8389c2fb29687acf, 0x27fcc2d684bf5dc5, 0x2cf5d2f5d114d5b4},
+    {0x90a6b9b0b42f46ff, 0x04781a30e3ace961, 0xc800457dbf1808b2, 0x08f973dcb5b0bf99},
+    {0xeb6a38569c3a91f9, 0x1d733d57711ba69f, 0x6b4655ee716dd3c1, 0x07bbd2b1880580d6},
+    {0xd76c1f098a2f7803, 0xbf28b9614390f7c1, 0x91f68107b50b248e, 0x0893d52658dd164c},
+    {0xa20f2f1c4f4d5498, 0x9c67b1f1dafb1949, 0xc853055beead3f83, 0x24a045acd7008099},
+    {0xb654f28eb966b3a1, 0x6d866390c3269810, 0x2c967c9e7ced1e6f, 0x0ed7992763d2cfae},
+    {0x3980e13f9aad775f, 0xb510d06e9a37d96f, 0xd1ad1fb13ac5d33f, 0x0ba0d060b67047b6},
+    {0x88bdddb59264c7ea, 0x3c27f3065355d2a6, 0xb14f2ac2517c8e6f, 0x22f7961a40464f5e},
+    {0xce30a3aa02d0eaab, 0x632cfca6780ce8c9, 0xa753f4b7a5bce92d, 0x0c4e118b3520d99a},
+    {0x3fb70d587c2a4c11, 0x5ae952a96f88003b, 0xb9969e757fcd6c8c, 0x30114e76b5f7bc03},
+    {0x5aba19698a310650, 0x8f72a6ca7860f16e, 0x6f56218309a8fa70, 0x1170aedfae0044a0},
+    {0x62e97e565aa37731, 0xd9109f4b8c9972ec, 0xbe45bec581e06d89, 0x0d494bdfca92baf8},
+    {0x72691e9108564777, 0xd2c2973ec66f5d8c, 0x358382c81f1933aa, 0x1f73aabdde2c8fe4},
+    {0x3d80d9159fbd5540, 0x76f99403f20b98d5, 0xbf42b53ae0fd9872, 0x188e9dc9605c1915},
+    {0x4b9f4443c24de9fe, 0x249bae39ae9b9c9e, 0x31b161921a65500f, 0x143d4a0c4c9968b7},
+    {0xa029c552467c3432, 0x03460ef8c8995d9e, 0x203745d4a1a0fde4, 0x0379757079e3462f},
+    {0xd519edcdd5051bf6, 0x1a90f43914725ddc, 0xd9668a0dc2cdddf6, 0x10d2dc2170eed4f0},
+    {0xb27e313cc74770c6, 0xd0a11b63dddf5025, 0x43551b21b2d8458f, 0x2f2f7816c39c880c},
+    {0xe0ea5a6216425f81, 0x523fedc05b19bd10, 0x4f633768c527cbec, 0x069f6628d9f36132},
+    {0xd4e8221b3b735a48, 0x69b7001826821379, 0x4ba795857b908988, 0x2d4893fe0df53cd6},
+    {0xc302315790ab47ab, 0x5d73cdcf7d5e7a5b, 0x38c05f3102aed164, 0x10f16765a4ff39bf},
+    {0xc395d387d78b097a, 0xc6be86de6d09eb07, 0x248d94bb28870262, 0x0ea0b4642a20370d},
+    {0x059725aeb44d271e, 0xc1fc4d0269ffdc3a, 0x8ef6510cb5528143, 0x166b19f5fede91af},
+    {0xc098630325f007c2, 0x1931d82d417642a3, 0xd7dfc6a51fd42e6c, 0x12305221fc67c93f},
+    {0x7ae2f3e3495cf6a4, 0x6da0f1701337a7bd, 0x98142c75537e2295, 0x0feae6dc726137c3},
+    {0x625518f326b922f8, 0x520bbfd89cdb7458, 0x3a9a6bd4097d864d, 0x23a33d38d291315c},
+};
+
+alignas(64) inline constexpr uint64_t KNAPSACK_C_52[KNAPSACK_N][5] = {
+    {0x7df38c8ba6c0b, 0xf00dbda17ef4e, 0x055f4fd82c20e, 0xcf2c076121c91, 0x00d0c393540b8},
+    {0x8a7b7a7e9ce6f, 0x823cc041d221b, 0x78268bc287937, 0x1122a4788ca0e, 0x005cd20a2bf99},
+    {0xd86cafb329170, 0xc1a6fc64ddaa7, 0x3ff14bb3629f4, 0x5a9a2e595ec0b, 0x02f9d3c73a864},
+    {0xb82586a40bc64, 0x7b4f2f58de985, 0x4af59c580994d, 0x3c0391ed914f8, 0x0130e3fa1c13c},
+    {0x448ace895f51b, 0xc3b31f4f78cab, 0xaa6266ed3e6ec, 0x65f693931e035, 0x019acacc6cf8c},
+    {0xd83a4912deadb, 0x4b913a6692a1f, 0xca1f176c55c50, 0xf1243ae5f26d3, 0x002067044982e},
+    {0x3e8973f775df8, 0xd5847d2ba859b, 0x4a7fb0f83b012, 0xdd1281697b01f, 0x0270d1ed5cd24},
+    {0x69c3ca88c61be, 0xd28ce7b4cfb05, 0xd8d52a2f48393, 0x1bbf081a04962, 0x02705079a3d1b},
+    {0x4bb723e408f68, 0x2429b4137e881, 0x607681a709618, 0x780e58b38d9ef, 0x00b8b01259a8d},
+    {0xde6192675dd61, 0x76a6d40083d61, 0xf2a4da4e124d7, 0xe54b0d82526a5, 0x0079d78f775b9},
+    {0x472da54053b8c, 0x693fe6102dca8, 0x46e4988927551, 0x482d5d1d8acc4, 0x02c60f3adf5ed},
+    {0x04084e58f5eb9, 0xc51cb0cda9adb, 0xbe054ae8b6a34, 0xc61c5442034cc, 0x028c3f17ab762},
+    {0xe77bfe2aa6382, 0x4db1205ac0da0, 0x3c1d421e4e021, 0x1eb8ea13d3542, 0x02a69ded3622c},
+    {0xafb74d31edd40, 0x1bf3897a67d0d, 0x609512101149e, 0xbda99c9f9d68a, 0x01331ca4b3065},
+    {0x0c54b568a0460, 0x4304c1c4aa216, 0xf7390237436a1, 0x71ed695bd5348, 0x01fe6f57216a1},
+    {0x8230bc254c85c, 0x031efa1a21e6f, 0x66b2f976331ff, 0xbc4e87da23a3a, 0x00c0aee572eb9},
+    {0x0d94c8726efd5, 0x5cf8d058568d7, 0xc26416bac36ae, 0xe33cf8abb8d2c, 0x0158ad9cd9d70},
+    {0x822f22cba5a3f, 0xbc73d1ec86a09, 0x1508e3c26bebb, 0x22354d0235dd8, 0x00ab8f80af416},
+    {0x5105250baac9f, 0x458e462910170, 0xf4b059e460be7, 0x540ec2f022ff2, 0x0178f7f2ec91d},
+    {0x525038f509383, 0xc4412f0b5125a, 0xe9c7bc9c01a78, 0xe359ffdd6673c, 0x026f88bc2525e},
+    {0xb4b69cb483332, 0x5098313d8f823, 0x3726c1f5fbb1e, 0x3d5a8999742df, 0x01f10f721a37f},
+    {0xb986809410acb, 0xcebe4e5cec7f1, 0xeebd675f47128, 0xe25a242e1c212, 0x00527e6e5b6b2},
+    {0xc68f6187fc374, 0x5a6923cba5f81, 0x5b64b96f7ccb9, 0xaf183f460ec64, 0x0295dc6d9e53b},
+    {0xfbc2be353102b, 0xacff120ad156b, 0x19faa5b71d6b5, 0xbfd1617f73e13, 0x00df8294471e4},
+    {0xa10cc5fdab1f3, 0x4ee1af7b1b83a, 0x69bd8c65b9c4b, 0xc0529ab640bea, 0x01fccd25fbd85},
+    {0x674a7d117eeda, 0xb9a37478f7064, 0xbdc19625818f5, 0x3b6a975f3a3ff, 0x02565ae7e327e},
+    {0x521edca42ea08, 0xd7b1713d13aaf, 0xb1528a3f7c292, 0x4961c901ba1e1, 0x01931d55d6d73},
+    {0xe44d456b8b647, 0xef2d3ef84278e, 0x784465e22d4c3, 0xbd3ab5fe63749, 0x01907b64a5920},
+    {0x11053bd3f896b, 0xe9aa565183e64, 0x42b300b981ed9, 0x11d6c57d26e8d, 0x000be4a0c2f44},
+    {0x386ae66885b69, 0xe014ed895b54c, 0xf22de688f21df, 0x6bdd3a9b382dd, 0x00a05cea56b1d},
+    {0x3a39ef72bd056, 0x0d5ca7893abd5, 0xa4809eb7249ea, 0x117f6734a98f8, 0x004a59762482b},
+    {0x3d3b0dd33c897, 0xd6e86dd15822f, 0xf9677575e3c81, 0x69f831fc9fe42, 0x0236070518655},
+    {0x91adadf9ceca0, 0x977d864354818, 0x8b499419ced5f, 0xcb579fb45a75f, 0x0185efda590c6},
+    {0x54cd561afeb29, 0xa0758a910fa55, 0x39759172a0afe, 0x52b0749451c1f, 0x026e999e8fc16},
+    {0x4265eac8f205e, 0x8527df840a1c7, 0xac4b0802dd960, 0x1f16882f0c882, 0x010a9440eba95},
+    {0x7e57f441c1b19, 0xc10593fc1076a, 0x7fbcfb5808a4f, 0x29390baac802e, 0x01afb0f2ee2ed},
+    {0x5f1aaf024bcfa, 0x5da7be684f1e0, 0x630970ef47d95, 0x471082faad9f8, 0x018428bfa146c},
+    {0x2174acf0b2a20, 0xa4e284ac40420, 0xec6663f355b24, 0x68b3d21eb600a, 0x001e4fb829cb6},
+    {0x58e5618a749ba, 0x488c802dfe3ff, 0xf252da515e8ed, 0x2db11c76264ce, 0x00258926bdd15},
+    {0x808e7444e6775, 0x92e828ddb589d, 0xcb08f8c5eb286, 0xf5a1ca65abea5, 0x00e4679ba3c56},
+    {0xdfb0ddd6f94ab, 0xe92178ef19170, 0x1acd7788928f1, 0x01f8781774615, 0x0037fba8cbec0},
+    {0x40965dfa72104, 0x0eaec47ed6e81, 0x86875b5184920, 0x7a41fafc390f6, 0x00753f30c63a2},
+    {0x5ddadbbe1c962, 0xe4db9bc5bf2b7, 0x9707060e38082, 0x1d45df1876c63, 0x0264ff0304f53},
+    {0xd0779c69cf5fd, 0x9f899a22dfd74, 0x045c87441376e, 0x1c2bffbee8755, 0x0048e219b53e1},
+    {0xefee9d0158710, 0xfcda6d6467833, 0x33ae39e05fd88, 0xa2ee3a5b8348e, 0x00fbe02036793},
+    {0x96176f7a41cac, 0xe6d10e26c0b0d, 0xb4af3e499b911, 0xa13cdfdfbd35f, 0x00c1b7d54a712},
+    {0x48d1ec3d1690b, 0x786c4b4f482ec, 0xaeabcaf26e6b9, 0x1bae46dcc8cff, 0x011792e4653c8},
+    {0xedf517145a0e6, 0xaa6e0ad4ba704, 0x061e5314a4185, 0xc38bca36fc812, 0x011c19f636ddd},
+    {0xbdbff0178acea, 0x2c250812e0aab, 0x4f36253c2f263, 0x5b66be83edd6e, 0x017d41374bf41},
+    {0x6076029072def, 0x1b20549490e6b, 0x5b41ed43c3579, 0x87d4b5aa13caf, 0x01fbe4afb4110},
+    {0x63ccc5ad8b41b, 0xcdf650fd044b8, 0x589bf53becda2, 0x7826bd2332199, 0x01e5e874cc8c0},
+    {0x6349f04a7372f, 0xd30a769fbefbb, 0x843555b804b66, 0x2ded6cc20d49a, 0x02eef19578827},
+    {0x15130f696db5e, 0x65c71989c2658, 0xc5d5bd7cfc818, 0x45da81f36c25b, 0x00f3f2702b245},
+    {0xce6bd4d0ab2a4, 0xe975caea1df49, 0xbbff58d02a39d, 0xbaed9ec183c24, 0x00d45a985b67e},
+    {0x50c333e00105b, 0xb1581e4642b5e, 0x607261e67aab4, 0x9183d033783bc, 0x003e9619062b2},
+    {0x088922320d7e2, 0x6457ee792fed9, 0xc1c0ecda97314, 0x53355a78e2913, 0x00a65d4e4a560},
+    {0x0e8dc24c2958f, 0x9648d2f6ef828, 0x852fbfbe9cb5c, 0x43a1b54f4eb3f, 0x01e684c693888},
+    {0xaee647bff076e, 0xca3421225212a, 0xb4b939860704d, 0xd83126e519d4b, 0x015d54b8796dd},
+    {0x936b2404914a3, 0x07a090dbb6f46, 0x16636b1cbf14c, 0x6a248b5c76fb4, 0x002b08a15b287},
+    {0x807d8d1143920, 0x05539d64b9a90, 0x3cb21a4a78679, 0x5b0d189a8a78a, 0x010f718d83cb3},
+    {0x646e0bdd58fa4, 0x8e6f9f0ab0310, 0x2306bbed3f246, 0xc490118262aff, 0x002cbb110da8c},
+    {0xcddfcabe08a85, 0x64cea527fad76, 0xdd012a99444e9, 0x43f01ad4957b9, 0x02b382471a24b},
+    {0x908a4826d46fe, 0x9f2e97c77f7ca, 0x55f2b6a7b1a2c, 0xb80d28c5f0cd4, 0x02a8e174c3bd9},
+    {0x6dec0b4ccd748, 0xb5062d58e3564, 0xbe45bce798aad, 0x6f1fa07eca4a9, 0x0216640f95b2e},
+    {0xd9f84a18f587a, 0xb0907db770f39, 0x65555961045b2, 0x9b67c3f8afe21, 0x01e25bb1907d1},
+    {0x0d55cec933c50, 0x1e90463213828, 0x061ea962bcf86, 0x5be0127572bcc, 0x02fa365225df1},
+    {0xbdfd67d882b8b, 0x815c13246f91e, 0x49496afaee4bf, 0xfc7976d18aecb, 0x026c2446c01ee},
+    {0xcaf5383ecf6ec, 0x9b25de986e2c2, 0x92854b1439fce, 0x4eabfc450dba6, 0x03000712f06e1},
+    {0x56f4672733d07, 0xb85c6ac08a192, 0x4cb392a009891, 0x2cc4dbe41a9ef, 0x02a735f7d93ed},
+    {0xc445841101884, 0xd8f621d069e73, 0x340ba99f3cf98, 0x72692e7fe1f1c, 0x01300e0e4dc19},
+    {0x52721137e000a, 0x850b961fc950f, 0x0a901b5266d61, 0x42c5e912a594d, 0x02a24f57b6bf0},
+    {0xcae16673f1a10, 0xe0ce6519d32fd, 0x9f6595e17dbb3, 0x2e0df33fa36ec, 0x0299e3fae4a5e},
+    {0x7d59073b28d74, 0xddd80d572e0b6, 0xc57593ba6390c, 0xe14237b1a3f5f, 0x007a0ae0155b1},
+    {0xebd9f890c07e9, 0x0573d76fcf8b4, 0x70db2b9f55e6c, 0xc46b0944f8dfb, 0x0247c50a37898},
+    {0x32bff11a95534, 0xa27abbb9c1e6e, 0x3be9ed6a45b1d, 0x18f0872ebd16b, 0x009292474a6da},
+    {0xaaa1fb617c593, 0x9db60b543579e, 0x514dad58d95d9, 0xc514d9a15c727, 0x0191d6363f9fb},
+    {0x06c0682607a89, 0xeca9327e5dd1d, 0x713132f8fa04b, 0x17b3be31f3af4, 0x00a3633a98f92},
+    {0x236eaacb7204c, 0x11c9163e2b967, 0xf865fd6d9e277, 0x34cff4b7bea9f, 0x00821bc35257a},
+    {0xbee8143d07864, 0x315d46a6e4d02, 0x7643135633346, 0xb141c12ce952b, 0x01f77e8c7c24a},
+    {0x54bedaca1b975, 0x675b4f5ddcd98, 0xae730a0dff0a6, 0x3144199af49e0, 0x02fd35328e9b1},
+    {0x847cabda22d1f, 0xcf8ea76178428, 0xfa2e67f9c2b1a, 0x7898186463bb5, 0x01348222242cf},
+    {0xa49a388cdec12, 0x57cc7f5a91b74, 0x6de92afcda0a5, 0x84cb9b6155117, 0x01a2536f7c076},
+    {0x15d166ab8c454, 0x9974c5f74d74d, 0x7d5d2187d7f13, 0x28e9fde8d0cdf, 0x0253409a8ccda},
+    {0xb3f525e289d0f, 0x2c56d3e1a67b5, 0xae31be7aaea99, 0xc838945955981, 0x015031e940759},
+    {0x0e1be841210d2, 0xfeaccb3743caf, 0x7512d0fe1c8b5, 0xc69ffacdaff2a, 0x026fbb17e6da9},
+    {0xb150f9aaf6a13, 0x25961b694fdbb, 0xab601801e2082, 0x9f942715b18e9, 0x0247607f194cc},
+    {0xd9346d8c78b11, 0x0950ec331e50f, 0xee9ad2b53847a, 0xb560585d18fa7, 0x00d5da8c459bf},
+    {0xb0212a0fc0e32, 0x9ce8829146c34, 0xa32a33d407908, 0x37bc5fd418c72, 0x02383f03b5916},
+    {0xf8bdd6ab18f7d, 0x75ab848f85632, 0x2fee8c259bb33, 0x3052472cd9a9d, 0x00edf27e4e951},
+    {0xbc97cb9319cb8, 0xfab0337b2eedb, 0x2658c21f446f6, 0x423c538d261d6, 0x0143189a8b99b},
+    {0xf4ddf3d6e5ede, 0x42399449e5866, 0x6ffde10d6d545, 0x122974a7ef812, 0x0280210b7d8a0},
+    {0x4d6a150275a2d, 0xcc4266a2af79a, 0x9d07eac6345a1, 0xb0be27e0c70d1, 0x00482ad2ebdea},
+    {0x85b26f9ff178a, 0xe3eed9c5fc249, 0x329d409dfdc55, 0x0a55c7a44dbb9, 0x01f694f71c00e},
+    {0xb736bb5b0245e, 0x6bc844772446b, 0x987623e619d35, 0x87fd650600fa3, 0x0048674a5ff59},
+    {0x155401ce5de6f, 0x3adb24ac9a601, 0xddddc77999d0e, 0x8610aaf1499f1, 0x010843607888b},
+    {0x98c35e2397d58, 0x03a2e7a07dac2, 0xbef83aac28f0c, 0x61cca28a6ef69, 0x028a052a65919},
+    {0xfeb3205d7981f, 0xa089878f95386, 0x24d92ee476444, 0xb4dc09d6f3464, 0x01360f9ed23ca},
+    {0x0998335384da6, 0xb7c59dc3c0549, 0xebd93d71cf808, 0x7282f8b637f0e, 0x00b17c56201aa},
+    {0x09232fd795c1f, 0x3c7ba8753bbb9, 0xb948c0bd6962d, 0x0d0ca5d9ca33a, 0x0070dc090500d},
+    {0xdffe92ebf7019, 0xd840ab14939e6, 0xda083ade5fee8, 0x31efcb9abc5f6, 0x007e5940e5702},
+    {0xf6eeee6cdf519, 0xcbbecdedadccf, 0x8b8e05e2b764e, 0x2f230a3c09924, 0x02062bbca760b},
+    {0x5f151e834455d, 0x3666e268e4fef, 0x95155f2cb93e9, 0x091ce364cf991, 0x02e882d06ec44},
+    {0x77050ef9c8640, 0x933e1aa0cd59e, 0x2c0aa2bd9b217, 0x900dfe93a0ae8, 0x01080fe5cb45c},
+    {0x484d2fc0220b3, 0x8968052c2c151, 0x927b09818eddc, 0x01c089b6d1fd6, 0x030597117ad35},
+    {0x4f9965eaf4c19, 0x18855aeb92f87, 0xfd89444429ab2, 0x0b7019196ebdc, 0x0213328335ca7},
+    {0x054f45d27f4ea, 0x6126d44766442, 0x11c352d5ad2af, 0xaee65817a4d43, 0x023a9cefcc1e0},
+    {0xebe6b929f995b, 0x28768ad8dbc64, 0xe0b406b94144c, 0x120b2086945de, 0x0210620b11dac},
+    {0x91a2099405234, 0x565e2cb4855f8, 0xeb379fedc489b, 0xf7ac4a1aaed52, 0x024863abb8857},
+    {0x6de6e2958f103, 0x0cac2b1965210, 0xcb82687ec055f, 0xb729c28752a49, 0x0182c2bfd1b97},
+    {0xde00192fcb6e6, 0x6ce625fd60236, 0x545b0b46a7431, 0x4d4829a59fbba, 0x02ed8f7923149},
+    {0x9e8855f9c70dd, 0x514f3db266c6e, 0x6c045d3f58408, 0x1ff16f4d8bd74, 0x0069ac6bb0b34},
+    {0xa1b1ef0261578, 0xe211840ea1788, 0x6a8e123e6d390, 0xda0dfa4e41984, 0x014d7580be826},
+    {0xb660a1007f26b, 0x5681fd70e204a, 0x5afcdb25ef7ad, 0x7ec654ddd176a, 0x02c96d5428d15},
+    {0x907a7764db29b, 0x9f5d1819ca67c, 0x50b6bd7039b8a, 0x6c4d87959351d, 0x01f4b92007fcb},
+    {0x870980087dbfc, 0x21de0a2fabd9f, 0xb935206163290, 0x5013af13418df, 0x01f9132c96c7f},
+    {0x2b2e9d4fc5b84, 0x717762fcef04e, 0x23e36e44f1977, 0x2868bdc65c56d, 0x014fb6f2e07bc},
+    {0x8c954c4fc049f, 0x4a11e01e392a6, 0x652867087252f, 0x21bee930dca68, 0x0136c7b5e6ade},
+    {0x477f357d376fa, 0x1142def6ffa66, 0x4c02e341b9d92, 0x1c5cb30e70063, 0x016d211cfac9f},
+    {0x32d7661dbde3b, 0x26f4575e265e8, 0xf067bb324bdb3, 0x22b546d5b93c7, 0x017c4388c9ad2},
+    {0x76fff6a2bbc22, 0x40bc3bdda4a17, 0x73aa2ad240c67, 0x6e3964e620499, 0x0134373ac036e},
+    {0x77f7dd1405833, 0xa4924b6e1a8f6, 0xf1a31ad241c0e, 0x8952f26c91391, 0x01bc398ebab74},
+    {0x873264a57a588, 0xda9554884db63, 0xfc97fc0058215, 0x9141a2e87fef8, 0x0233d8de7bb16},
+    {0xdf621f35a2e82, 0x5690b4495737f, 0x6f618010eabe7, 0x8f5d307f80e5e, 0x01f78b4d74a2c},
+    {0x024e0f4fb9fdb, 0xa5fedc9e84324, 0xafbb10fc421ff, 0x9fa1b48fdbe21, 0x01fa57a4d200a},
+    {0x7c84d3cacb8ec, 0x40c7333909922, 0xc2d57db7b5abf, 0x31591e91af162, 0x00447b6f05e19},
+    {0x8734466f02a10, 0xeb177e0e075f8, 0xdcad0a2ac37d7, 0x47277d50f0522, 0x000d86c97a0c4},
+    {0xb94861e244fa0, 0x2047fb56a471a, 0x4f202fad28b56, 0xbbc760e4104cf, 0x02a97ba3bc637},
+    {0x9801d54fbf036, 0x414b0b818409f, 0x045e005eb5e82, 0xa1c615c9e7c4a, 0x02b54a53b33b0},
+    {0xe834c4406e296, 0x866b2b1bc5dab, 0x0d2ddd17491f4, 0x23b39da912ea7, 0x00fff06fd9d57},
+    {0x93497c74b9fb6, 0xbdbd18d8af5ac, 0x8bbd0776eca35, 0x91c3b5927880c, 0x003393b78b3e3},
+    {0x56f81c243597c, 0x88cbbca115f7d, 0x769910c5a705d, 0xd5c35a1ab0854, 0x01c8de6fd14d3},
+    {0xf23e832ad064d, 0x08177c138bf12, 0x26531ff384399, 0x64f2db6b3f5b4, 0x00a81822eca4d},
+    {0xe54b3c1a64836, 0xd3caa8c9faff7, 0xc7e6aeb2a9df7, 0x265acf760248e, 0x010f880acc4a4},
+    {0x53ec78d1353e7, 0x7f0500a1d2a73, 0xd14d5ea811dd1, 0xd4658c0d45628, 0x018144eff9abc},
+    {0xb40bc852153c1, 0x265e78a5c0230, 0xb9e4d4313057a, 0x40a14c9e765c6, 0x0131b05925868},
+    {0x902dfb5b408aa, 0x972b04d57dfde, 0x79b88cafe8d07, 0xce9e26181013e, 0x009d9efa01ace},
+    {0x33ade5b56e8dd, 0x4ae341e8c53ab, 0xa1e1b5bff27a8, 0x66284ec019735, 0x0085eb9da56a1},
+    {0xd489573491e26, 0xb63ea9085dbcd, 0x2c61cfea5b1a6, 0xc833865db4d19, 0x02fb69507e54d},
+    {0xbcf3aedd0edd9, 0x372b447da213a, 0x5511ff3767dd6, 0xfd69bc683bb83, 0x01f89263558c8},
+    {0xa189d19db178b, 0x66f93afd9c505, 0xb83dfac2933e9, 0xaa8e358cfabf9, 0x0203cebefbfb2},
+    {0x82a1b402b7727, 0xfa6795f1da5bf, 0xa62b50c3c10de, 0x0d98d934d1f5c, 0x00af9b617820c},
+    {0x410751865cfce, 0xfc36212b4b487, 0xa33c63b8edf4b, 0xc47fc0a309b74, 0x01c5e9b44247f},
+    {0xc3eac14dd8afe, 0x97ebf05f977c5, 0x6d377bdefc27e, 0x1d79a6b8f454f, 0x000962e3a5b64},
+    {0xeb5d688790062, 0x44f754b59c8ff, 0x14b7aef44507c, 0x546cedd0f86f8, 0x02298274220f4},
+    {0x4d8795672a2bf, 0x94a52b51a6aac, 0xea068648e50ea, 0xac11b92b84421, 0x017b589b72e06},
+    {0xa6e65a5a488ad, 0xec5ac7495282e, 0x18160a2cffca6, 0x4fcb21296e6a3, 0x012c6bccb3306},
+    {0xaf04148c9f5d7, 0xb9f5759d71aaf, 0x159bbabc4e86b, 0x8a4281c541daf, 0x01fff9223c719},
+    {0x86f9f8fe00aea, 0x90db1abbb8023, 0x12275161a7a3a, 0xef6a8a42fbacd, 0x00b7517babfe7},
+    {0x1c2e36bb6ad8e, 0x2650060fe254b, 0xf81bbc3d087f5, 0x0d69068430838, 0x02a616d4a5ea7},
+    {0x14273b21fa5ea, 0x15c9fdacbb9f2, 0x58ec65c50bb0c, 0x57e8d59b91387, 0x010a45ad58616},
+    {0x33671dbd56069, 0x2e86c0ba4dc44, 0x61309f6bb1642, 0x5ee1a67d94208, 0x00cf593e4e404},
+    {0x972ee9db8b9d8, 0x067cff04d3d80, 0x550c6c4d73426, 0x7a7741d3a18d3, 0x00599143adfca},
+    {0xbacaa581c8db0, 0x3fa868a02fd5a, 0x601e811b3b67a, 0x71b2c05da9ba2, 0x00a7342f5a1b2},
+    {0xbe09ad455b316, 0x6d0fe87935be8, 0xad7bdf40f23c3, 0x6e49915176aa3, 0x024823f1db086},
+    {0xa22b3b9247c1b, 0xb6efdc67337c2, 0xf6a6257b149a8, 0x90fe0032e5a7c, 0x008bc00e2b21b},
+    {0x334b4f233f3c5, 0xd022cc5e67c4f, 0x1379ce8be9359, 0xae532d238f7e2, 0x007b05e1de5f7},
+    {0xde32adb1d6fb0, 0x86a75f300bb88, 0x6ce558dbf8ab3, 0xbb255f23eff27, 0x0287e381d8f4e},
+    {0x02dddfcb47692, 0x7873c74d41104, 0x5fc1d5d2070cb, 0x198cbf3b00363, 0x024f1d2519616},
+    {0xfdb8f0e209807, 0x51fdae9e87232, 0x045bc2dc7af45, 0xf3200c68c8b61, 0x02d5d9065ce66},
+    {0x2141701b7ede9, 0x20b8f827ba68d, 0xf9d6b85a8d3f7, 0x46922b1e9dcbf, 0x005b4f98948c9},
+    {0xa7a19e95fc43d, 0x366d92673b5ba, 0xe527183d6e2ba, 0x4117a20b58492, 0x0253735141a83},
+    {0x3beb612f00db8, 0xebfdc94496e77, 0x0c756760a28eb, 0x62c303f9f1618, 0x02035eaead7fb},
+    {0xcbcc8a20ec508, 0xbab33902bee64, 0x0f11d734a7f9f, 0x4c87356829f2a, 0x028895d0a8447},
+    {0xe4631b9c297c3, 0x4c87a579d895e, 0x58f72f42404d9, 0x33080f6c92ec1, 0x00cd73a1fc475},
+    {0x71ebdde60d46f, 0x5eb7e1439bad3, 0xf242b079ee1e2, 0xdbf5716045f31, 0x01686f65d9979},
+    {0xb9b270422da3d, 0x067ca24d3ab39, 0x9208999c34cd3, 0x86b871ee6cf34, 0x0268ed0aab945},
+    {0x0c8262b347d4a, 0xc5358fa3c9e94, 0xca671aa605858, 0x48bf3d2547ce3, 0x01b3d09c3f7d4},
+    {0x12b912237052b, 0x455e6a3894ed4, 0xf96f9bbf150e7, 0xc2c48c7878ca4, 0x02fcb5aff4d82},
+    {0x1edc1a9e9e48c, 0x03cddfed6b3ad, 0x14983f0d747a7, 0xa13c559130b31, 0x01769e82e1834},
+    {0xcedd43f278606, 0xf7fef399d4255, 0x24cda977f76b9, 0x8a55d1c66f988, 0x01bd618c7e8b9},
+    {0x44339f4462649, 0x40bbe6feddac7, 0x3ddbfc3b4735b, 0x10a0302172dd6, 0x02e0b456e4d1b},
+    {0x231837ef47032, 0x9911a80fa4caa, 0xcf1bca06ea809, 0x574d0d94dc802, 0x015a613dfb40a},
+    {0x3e4f94bd37084, 0xeb0a0233e0ac0, 0xfc27b989b0ddc, 0x78f5226d51996, 0x01a440f739a50},
+    {0x54622e7388c38, 0x1660f4a6ecf49, 0x6e91150bd7106, 0xcd23818b57f12, 0x01479d522aa22},
+    {0x976785b9a6431, 0x8dba3f63031b0, 0x6aa311119ccc0, 0x70e6511347c13, 0x01e1ccbcf8cb3},
+    {0x5f4a776ae5368, 0x4dda5fd2fcc10, 0xc13ab3ad7d795, 0x05eceb63d73c4, 0x017afbc9c019f},
+    {0xe014e962140bd, 0x9a6bf2a94245c, 0x09750e8543085, 0xe8bab507b41ca, 0x01f9fbecade2d},
+    {0x77f4db4de2c62, 0x52899e754e32a, 0x227fbbbb987d7, 0x154030fa68a74, 0x020a1b9edb37f},
+    {0x58bc4c57b7438, 0x7625407b9345b, 0xa785da73f2874, 0x4430d091379ec, 0x00cda012f886f},
+    {0x16165f77c4774, 0xa4d09fe9ea4f7, 0x3314def924b3b, 0x5f63e9f229ec2, 0x009d770db7852},
+    {0xe2b32c652985b, 0x2690fac9310a1, 0xc0ba22d47de5a, 0xa69c3f4c0961c, 0x02a074367bc99},
+    {0xf083f06cce059, 0xcb2cd4a627f4f, 0x32f72f9ef0060, 0x929f4e549051b, 0x012cbd76e1eb4},
+    {0x952c7b2e94850, 0xab745a100efa2, 0xe767fdf2be9ad, 0xa10d98e60e917, 0x023343a4932e8},
+    {0xfacd256e66bd1, 0x4fb9efef17c8d, 0xcc2b50acacff9, 0x35174dc353aa9, 0x029be9e981960},
+    {0x6cf3cf1569e84, 0x9a19579f45db5, 0x6a6996c064a48, 0x4cdb2b45f1f16, 0x0022be5f5f43a},
+    {0xfab0131fd96a0, 0xba42fdf9ac1a0, 0x3192744efce97, 0x1eb235c8112b6, 0x02bc9aab83b2c},
+    {0x5f70930681584, 0xcb06c9e480c46, 0x12bbc52f3aa0d, 0x264aaf527f4fb, 0x026a696587373},
+    {0x9b4522cd22b67, 0xa61823e4fc816, 0x30049e490767b, 0xfef3f3a33aee3, 0x020d9a2d37506},
+    {0x5c1bf8b4e6c85, 0x7502a0a5f3c9e, 0x3f5da04e69def, 0xb106ea93bec78, 0x00137bc4b4d9d},
+    {0x1494c4470be24, 0xed8e1806c94c9, 0x1ed2c1c7a67bf, 0x98a5610834fa7, 0x0274b95d0dc6c},
+    {0xfa6c0326886fe, 0xaa4aa1714bc42, 0x7050b24c91909, 0x1e80b7d3e510b, 0x00390902e5d45},
+    {0x3d7763d0b0a0a, 0x0d7b56029e708, 0x5b78fcbbf1da2, 0x130aac7f1493a, 0x025b8bec4f987},
+    {0xd1e96a2f9a801, 0xa704f530b6cc3, 0x793254a07c8d3, 0x6a8e913b22c48, 0x00ff48699da52},
+    {0xd979bfe13855e, 0x31c2db6744602, 0xe54dd4f9d84a3, 0xa830dbd5d4546, 0x01dccc9a182ea},
+    {0xedab70bcde0c8, 0x51019d5dc32ce, 0xbacf3b1941231, 0xffe8eded35d37, 0x02b82f54a6d41},
+    {0xa7a3960b55686, 0x4e91e9482e99d, 0xb318183597359, 0xd7ed17879ca4f, 0x0126ad6010248},
+    {0x06f46b3ee7988, 0x5eaaa11d0fbc3, 0xd49ebf590c9cc, 0x29b225fa3b853, 0x02262ca82b00e},
+    {0xbf869f66a0588, 0x7b2eedb88e463, 0x96b973e0dde98, 0xf46dcd8d3b171, 0x02ceeac7e4e3f},
+    {0x74cf11930a4bc, 0x37db5e03b21d1, 0xf9e4ee09349a5, 0xda2ab1d7f026f, 0x01367a1ef17ec},
+    {0x55f8a87485219, 0x4e5d2c445453f, 0x564f184676927, 0x97fa715cc9c7f, 0x002a26eb06782},
+    {0x7a0422cde39b2, 0x09e1e0afdf310, 0xe7c01a6e5132e, 0x9f319c23bc191, 0x00813c0bc4647},
+    {0x5fabc5b9c99a4, 0x8298cad360a73, 0x9d1758cf40f0a, 0x9d6d2e0baeb0f, 0x017473ba70b5c},
+    {0xe7e1ef7d30dfe, 0xcdcc060c228de, 0x4d02a6cc97997, 0x176a866c67c65, 0x0034553b4c2f6},
+    {0x2e621e19a9aa3, 0x16894ff524636, 0xab2c8d59c0fe1, 0x993c67feabd20, 0x024dda30748e0},
+    {0xc6e7a6a127926, 0x83ce41cfd1640, 0x6a31b239ba1fe, 0x6bf981d1e9641, 0x01d7ff00f85d0},
+    {0xf5559e8b4e07e, 0x0efb35e96cff9, 0xb73b6314823da, 0xbad8b97e5fe77, 0x00b59562cda37},
+    {0xb43826d5f1ee3, 0x81b677d09bf03, 0xd99231a2e236c, 0xddee46f1a0c4e, 0x016a512575efc},
+    {0xb98112c55a491, 0xa4abbff054437, 0x39b31d9075473, 0xd3353881f9d40, 0x01f1b68c94b29},
+    {0xb3a1335186e90, 0x2555392119d09, 0xf4fd1cc93cf99, 0x2957bbe65cd21, 0x02120d948965f},
+    {0x74f69a2f3fde0, 0x7c956738d3525, 0x9a2aeb8945a9f, 0x64d93821fe528, 0x01eff27b20eca},
+    {0x56265ca2bb9e3, 0xf9b0d980941de, 0x80f11e70f2251, 0xb8a114d715cbe, 0x025b08f9c24e0},
+    {0x81cff2a7e3fd3, 0xd146112174e2d, 0x9515d39c9ea8a, 0x90030000ac77c, 0x003cbfadb4c03},
+    {0x2e0bfab7c3be5, 0xa823bed8e9a17, 0x6f3d0532e3bc8, 0xc2e72a585e264, 0x0268df06dbe5b},
+    {0x453a77f572f2e, 0x6bf0baae01686, 0x9c4c7b43a5327, 0xd231804498e1d, 0x018dd9f7a0e8d},
+    {0xf5d5f2962fcf9, 0x802478ce52116, 0xf24fc72388cb2, 0x7b5d31f2b53c3, 0x00fbac01362cb},
+    {0x5e756419b0e41, 0x94a24c2508a96, 0x62f2ee7f057b3, 0x1e2a12c288a23, 0x02553b5a2dcc7},
+    {0x87dcb1c33ea3e, 0x522339df3932e, 0x091f2b403fcad, 0x73f4d17ca269c, 0x0151345241754},
+    {0x9bddb4367e4d6, 0xdfcef756e11f8, 0x7d12730fd1fa4, 0x3ebebbdf42e41, 0x010156499fd69},
+    {0x016730bf78591, 0x13065cc9a7495, 0xfaf3a9a576627, 0x7592c9ff4efe4, 0x01e34f34f29b2},
+    {0xb2afb9da29192, 0x2ac665bf504bc, 0x641e617b8fc4a, 0x0aff90ed57963, 0x0119d46231209},
+    {0x4302568f19bcc, 0xc8ac54b47aa1a, 0xfe1bf2316ac09, 0x166870974d3b2, 0x025893d4fd9f0},
+    {0x1987a716cacc2, 0x5b905598dbfc9, 0xd7db64ad58005, 0x27fa89aeecd87, 0x007966163eabb},
+    {0xff6337a0c851a, 0xda3288d714870, 0x096b9e8bdf3d2, 0xee061a2c7f3bc, 0x00e89b4334e6d},
+    {0x0f8ddb5989ab1, 0x387f45964192e, 0x054a1220b6eae, 0x669c70b69b8d6, 0x00add9257f1cd},
+    {0x73a0f2d0085ee, 0x98f859f7dba64, 0x7f3bc39b635ce, 0xd319aa79ef4c6, 0x02e6fd6d40f2d},
+    {0xd451022c341f2, 0x5442b56b46f50, 0x03f76972b7359, 0x5f6504aed79f6, 0x00c88d54cdb75},
+    {0x4e1f978267ac6, 0xff918fc7fce84, 0xfe73d1358fab0, 0x122e94d83d4e3, 0x02743f30fa4b3},
+    {0x99cb5a84c4d0a, 0xab4c06102e1b7, 0x5426635a06e3c, 0x049084335f1e9, 0x005613ebccc10},
+    {0xb4aa30b184e9c, 0x49b8310df7571, 0x42015682b866b, 0xa7c49a2a70210, 0x015ea0cce60c9},
+    {0x0835e5548ae23, 0x616f966b3c105, 0x40287514567e2, 0x2ed80790592dd, 0x006643eee1998},
+    {0xa7434e3971e7a, 0xbed32df14a907, 0xb75273b1cc935, 0x25261865ec4f8, 0x018ce137b05d2},
+    {0x82a857db3bbe8, 0x663e6d93b9dbd, 0x765cff72faaa7, 0x6feb307637679, 0x002136cb16ddd},
+    {0x54964e153a555, 0x0683bb0e92ea6, 0xf52f036948ef6, 0x230c4a02c8965, 0x00dc83123db67},
+    {0xd1131fdc9f914, 0x72959ad05073a, 0x516e9d2d436ac, 0xff70cbcadf201, 0x02083c765fa13},
+    {0x01546bcc028e1, 0xc91001a2422ca, 0x94215810edd85, 0x210aa2bc620bb, 0x008e317927e75},
+    {0xd03443d90962d, 0xfea6359e492eb, 0x05046156e7d57, 0xa006e6475e925, 0x00ea204d38f01},
+    {0x78b60bf36bc9d, 0x726b596292943, 0x0d1ef9fcfa824, 0xdfe3e48f02407, 0x0260eb8c7c1cb},
+    {0x654fbef6368d1, 0xc8c5bc26c0ee7, 0xe5e3a918e3de5, 0x50a9819372f41, 0x000f1cd4bc574},
+    {0x2b13bd4c573af, 0x3f75c419ca0e5, 0x90dea836dd9f7, 0xadda51aefef37, 0x02a3cd2b83804},
+    {0x03d739354d84f, 0xb69f6cc7aa4ea, 0x3c88d1ec9dc81, 0xbf54b60a53146, 0x01c9d790ffe4c},
+    {0x7b0b448357629, 0x7139e9cbbd91f, 0x8499296c9a47e, 0x8d95ddd642b8a, 0x00b6db409e6ef},
+    {0x1b55c450ee34a, 0xbd0ff48205aaa, 0x5b33264067096, 0x86c7b72455da7, 0x02508e3b96615},
+    {0xb208498c06cca, 0x37806b91f30c7, 0xdee0ee21c646c, 0xb5f6b99929d9e, 0x005fdcae9b190},
+    {0x69814f660ebad, 0x39f56f5ffd4fa, 0xab1333e97c50c, 0x815c8c8a11e0a, 0x00de7b6579de8},
+    {0x80a1ab2dad1d4, 0x50819658811d8, 0xdf1f4ac17f90d, 0x7544c29d834ba, 0x0005014b2b6d8},
+    {0x2bd2a7fc9908f, 0x13dc6eb9c207f, 0x4d1916da5a013, 0x5203bd90817c7, 0x0171afa068f97},
+    {0xea54886c4aab9, 0xd04072af39094, 0x80d7fc6d926d8, 0x85425e104d009, 0x02dadffcef388},
+    {0xd692649420364, 0x4d8bfa4d52206, 0xf020e24c8c42d, 0x2dfe25e2c9329, 0x00e84b015db32},
+    {0x4b64929f7244d, 0x19d599bf2feb3, 0x1b775ae7acdb8, 0x89489a026dcae, 0x00124526a492c},
+    {0xbfa76639793c6, 0x81773f086e17c, 0x7bae1c27a0d4e, 0xeab5098014492, 0x02e45dfcd5052},
+    {0x26d0bd359976f, 0x5f376d695afbf, 0x6b9b2855fa118, 0xb9fcae663338d, 0x01715c0813a52},
+    {0x4532db31a0dfa, 0x5a7bf4fcd5d57, 0x826869d4e6d6d, 0x44aca417e6022, 0x01a7c03198576},
+    {0x3670770f40de0, 0x056d5cfe7eedb, 0xb044616050709, 0x3a6ccd4fecf79, 0x016adea364f0d},
+    {0x3f7c08b363688, 0x48096f48b650a, 0x031007a1cafa6, 0xd58db9af1220d, 0x011f60ec56910},
+    {0xe4381afb8ee98, 0xa96a1fbde435b, 0x8817da7566886, 0x7695651e09cb1, 0x0181eefa70c4d},
+    {0xb847fe7de80be, 0x15ab51ea616ae, 0xc9c116dfffd40, 0x5d644e29b34c1, 0x0192544b955d4},
+    {0x66a4d674d5ee2, 0x96319438144d0, 0x8839e6a75ed69, 0xacfda833f030a, 0x0209fa81b269e},
+    {0xbf8a17cac1be7, 0x042ec53e7d76a, 0x6b45456aac17f, 0xc8cd8cb2a043b, 0x00b218f043b0b},
+    {0x99d2a3ea77b69, 0xed91a203ced81, 0xd6ff735d33be7, 0x0254cdbe1982c, 0x00114113de13b},
+    {0x4789223b526c5, 0x81cfd6fe0d1db, 0x1b2182a786b8d, 0x151f394784f63, 0x015f43866f4dd},
+    {0xab02d15d07272, 0x937db859e895c, 0xe6930b25cc8b9, 0x175a3a6e65b34, 0x01d80a6261ec1},
+    {0x37646b8fe81b5, 0x474b8e1d8fa69, 0x028641ef199dc, 0x4f54d43d4a23d, 0x02d1fa0cf15e3},
+    {0x0b31a8984c904, 0x12149b756bc04, 0x6b6d48d5fae90, 0x1ea8efedf718d, 0x01ed67fb50c5c},
+    {0x84c74668877d5, 0x95aa3c0d2e492, 0x1845fb6f6e1c7, 0xdcf2a89f29beb, 0x00c9f6d62c930},
+    {0xe924fece4ca78, 0x120002c97db97, 0x92989375a47fa, 0xa887ba4a5a0f9, 0x015cd7ec7a230},
+    {0xd5ba99bed478f, 0x4f65fdbebdde1, 0x13b0444cff1b9, 0xb5e91be2099e7, 0x0131d2628a7f9},
+    {0x37311ef36e5a7, 0x1480e53e66f22, 0x575c0eb43ba53, 0x117ec7d44d4eb, 0x022770c31950a},
+    {0x8136e95f4f176, 0xdfae5cf30897e, 0x0eaf70a4ce03f, 0xa470b760cf1a1, 0x01788a378d08d},
+    {0xe00aeff54e458, 0x1f3b8bc406026, 0x6b9bdbba1d398, 0x88a26a579ce42, 0x001855601372d},
+    {0x74823cd6a31f4, 0xf408967d751ef, 0x6458fb31903f5, 0x63a74faebee23, 0x027ea4898afce},
+    {0x9c1ef684f1d59, 0x319fd659494b3, 0xd0b375ec8281d, 0xf5ec9c17b2504, 0x01037a189bea2},
+    {0x83cb3d74c6b39, 0xe58ffd5dd15fb, 0xf6d34ff14d109, 0x19aaa33a52f69, 0x0150c9fae6fa5},
+    {0x6ef97b7b3b4e7, 0xeee41ab814b92, 0x0ba737c219e61, 0x70501f9ca400c, 0x01e9812afc21a},
+    {0xb527846ffef9d, 0x8068f5a90cde5, 0x14d7dce7113fa, 0x22d4eb2d5fbd8, 0x00b12331843f4},
+    {0xab41499381fb7, 0x2c3f3aa433e55, 0x61026bd569872, 0x4b87b04f34276, 0x0085da8263f8d},
+    {0x63bbd845cc024, 0x98ff5a955a6dd, 0x0f9504e2ad3ba, 0xa4a251b49bc96, 0x02dca369c931f},
+    {0xe1a563f85da3c, 0x1cdddef147749, 0xf09013d7d5676, 0xcc1a943a02b8b, 0x0137ff0d3570a},
+    {0xa1f7c2519c3a3, 0x24f8a6db5ef78, 0xd57be811ef997, 0xf4e3d1575ef90, 0x00d30eddf4d5e},
+    {0x8227ec2b354d9, 0x6395d84269b55, 0xa9a865e3ff365, 0xf5ac3b442ee89, 0x01f9e7e9916f4},
+    {0x7c5f9cd1a5b90, 0x7bf1ab093b0e5, 0x6cc28d43fbcfd, 0x2c256fd5a3f3b, 0x014099695c609},
+    {0xca79742e35fd3, 0xfacb45a633e67, 0x36480003ccf4c, 0x14a111fd0479f, 0x00ddf17e910cb},
+    {0xbdeceeb0b3883, 0x271421eca5f67, 0x61c12de2a67f4, 0x3b1c22d8d8ead, 0x013e58d650785},
+    {0x41382def99d26, 0x3ce861d3ceddd, 0xcd2c257710d62, 0xf2edef7f12f19, 0x00d1f29bfa49a},
+    {0x6e93c9ac68299, 0x232141b52b8dd, 0x68402f0ce441e, 0xb9623f0186d92, 0x02246f11ec88c},
+    {0x4d4ea9bbefea0, 0x23bd072798962, 0x9024ad2cfee7c, 0x0427e5ca169ac, 0x028102bc360c9},
+    {0x1f223c48bfc0e, 0x5bae08d9a7c07, 0xa517436bd0ae5, 0xd9f4ef567245c, 0x02ddc6bea50ba},
+    {0x9763dd8dcb0e8, 0xc07969d914b5c, 0x48f8167d995a2, 0x73ba262501750, 0x00becd75b561e},
+    {0x96c47b857d457, 0xd259e360abff7, 0x6da8652eb12df, 0xb4a6c3961f1dc, 0x00f5cb5f0dab4},
+    {0x28d1df50224b5, 0xb5c6b539a30dd, 0x6809b81784908, 0x9bdd06fe2d00c, 0x00a1f6402b964},
+    {0x0a060a2800674, 0xe4e83db554f30, 0xf882764277fc1, 0x3bd695d4c4f51, 0x004351673b035},
+    {0x2284aa3b002b6, 0x8ff1203f5954b, 0x4ee05ea3596d4, 0x2792f82e8162c, 0x028a7d25e6c04},
+    {0x3ecc614c97bee, 0x8de52f9501dd2, 0xb22f76ecccbdf, 0x90deb8a143d45, 0x02da62c7ac950},
+    {0x0c35fc631baac, 0x091a1ab1cd8f9, 0x5b8b163041fa7, 0xc99d59b99e82f, 0x02f5401ef401e},
+    {0xe1fab3ec89404, 0x5c16040abcfa4, 0x44666170482c6, 0x4178fbee73aeb, 0x00a8c196694b2},
+    {0x4a2e2b09ef524, 0x55b502eda76e7, 0x00d52214c022d, 0xf0a15dfe0483a, 0x00c14e0014544},
+    {0xb833ba33676da, 0x559f55e80c759, 0x31c1dd723dfcc, 0xaebf216b5f6a5, 0x01fb27276ad20},
+    {0x70a504b6537dc, 0x2c2ab2e23cb1a, 0x45ee5ce314ede, 0x823ed27176b79, 0x00a2a29298efa},
+    {0xf5f39576c0803, 0xe6fdcd41fe40a, 0x155f6ec0879ef, 0x5cbdd41cc3491, 0x01a79241cab1c},
+    {0x64f5f302b9532, 0xb2dbd179cbca1, 0x404c86d182336, 0xefae65290654a, 0x02e81d0890fe5},
+    {0x3b5179ffd965b, 0xdcdd6507d3932, 0xb4224c6e3c22a, 0xb1c818cd6fd98, 0x00f9ca4273134},
+    {0x675d4331609a4, 0x2d4b2d8250d63, 0x71c23ca679bd1, 0x10a0aacc456b6, 0x029cce00e6892},
+    {0x7bc240b016cd0, 0xbd9cdb64449de, 0xc14db9993316c, 0x384bcdd6b8172, 0x007cb3c14425c},
+    {0xcc2fb12b8e114, 0x9a351f81721dd, 0xe09c9536f311b, 0x57465e3ae9086, 0x0227e5a2969aa},
+    {0xb9e9dc1eb0642, 0x7639c01b67d5a, 0x3f09c6fdccffd, 0x6621fd41d7e75, 0x006188232bb21},
+    {0x10d065806781f, 0xd17d37b99dd69, 0xbf706f3431625, 0x0b3de4359793c, 0x025fbc05242aa},
+    {0x000450286a653, 0x5f56022429665, 0xbf24da5e2103e, 0xa0938d34815fd, 0x006f379dc7457},
+    {0xfe5ce8f5d99b6, 0x5795117c5ef48, 0x33932bcf927eb, 0x6bce2f58f4719, 0x003649243029e},
+    {0x1843ed2d3ede5, 0x19bdfb87a3a0a, 0x66d8475e8e19a, 0xd61e7aa6ede14, 0x0210eed12dc7b},
+    {0xbbb0cb1fc5a60, 0x9f67d53f2efb1, 0x16f816a78c987, 0x31e201f31ad2a, 0x00ba0e74c0e4d},
+    {0xd2bbdd0f67272, 0xf1ae8bc465afc, 0x0c3bf6c68103b, 0x075fcee71d1cd, 0x009d4e184b629},
+    {0xe78e538da5912, 0xc61711b7256e9, 0x68e682807e673, 0xc210d500254fd, 0x0261496b76b6a},
+    {0xc9d134ab9f1cc, 0xd87ae09547cdf, 0x9e97bbdb16497, 0x91da54af465e9, 0x0300b656d2f0f},
+    {0xefb2e7abba3b6, 0xf9d540c512e7f, 0x87dc50e2f7ac7, 0xd87d3f6defc19, 0x02d26dca273e6},
+    {0x78bddbdd71c10, 0x7b8ec2454eb75, 0x1cdd775ad01fc, 0xf96e6f9fc9534, 0x019fc3b947c9e},
+    {0xbe4abb529cc42, 0xa5bc3557d96ae, 0xfe0e336661d1a, 0xef955ff8811e2, 0x019f531006fa6},
+    {0xbd4f689688b5a, 0x9e62a3a778b97, 0x23d880cd429ca, 0x9b9ba42ecf77d, 0x0114be0fef305},
+    {0xb1a1af02bd19c, 0x6eaadedf947a8, 0x3496e90e55afb, 0xd43cc50edfcba, 0x00083636b6ab0},
+    {0xe9cae5aa0bf07, 0x58ceea067161f, 0x93af900f58171, 0xca64f9460b2fe, 0x02df6b4861218},
+    {0xb1cd90382b3fd, 0x176644e4fe32c, 0x706fd4cd682e5, 0x75f225db2ccfa, 0x013403c6b13a3},
+    {0xbbcf174b16678, 0x3b6f121e83689, 0x0f2d2833570bd, 0xf0cc6861c33b5, 0x00396a857a3a5},
+    {0xb91c19753e74b, 0x9e05dedd17f3e, 0x15d9c5127b584, 0x441567ee46e69, 0x00e2759f87aaa},
+    {0x471653a893381, 0x1925f1f4a78ad, 0x7752ef4cfd143, 0xc2b11833109bf, 0x02f35a7de0a18},
+    {0x04af5f2ce7a1b, 0x1dcf97bf9a906, 0x621ed4f8781df, 0x6f63f4a3a101b, 0x005626b577ea3},
+    {0x00d0270d5930e, 0xb226b89f45f40, 0x743c0874963c4, 0x17272c38979d7, 0x0190544b0dbda},
+    {0xc6bbee2ed578f, 0x8f9cddd3e615a, 0xda59eac000803, 0xf512da2457366, 0x006a648450bc4},
+    {0xc1bb2480bbab7, 0x6f5881977d8ee, 0x578d9bf50128a, 0x68e26dbe67cec, 0x0038af9541483},
+    {0x18cfa2f978549, 0x91e8c9c84bf31, 0x473cb9c6a7dc1, 0x83f6aaa376f48, 0x01b71bdb99d2e},
+    {0x2a2d62f6c77c0, 0xe9879f04b7d71, 0x10061d4f83adb, 0x79dc471eaa5e1, 0x02b3d30a2ceef},
+    {0x4afc26a852040, 0x052c6a3ac9a65, 0x5d416f0fd22ae, 0x2c521f1d0b637, 0x027a6667c8ea5},
+    {0xd7d4f69ca0271, 0xb3cf64c3e5fd3, 0x5b029536eaae2, 0x9724b401068b9, 0x0268fff84e585},
+    {0x1754dc1f5db20, 0x75f0001f3383a, 0x4978b20ae6eb8, 0xd2f07912ea23d, 0x0140bb5e3ffd7},
+    {0xb8804ddd7dde4, 0x11cf06b2b814c, 0x716894cbcd001, 0xab2ee7704475e, 0x002eb5cbf3b01},
+    {0xf63fd178729a8, 0x8b4d676c0e848, 0x6f767b15c6528, 0x3124d3c69d842, 0x0244d833e8c90},
+    {0x8080fdb59aac4, 0xad8246d62c83d, 0xd87d93205d09a, 0xa3742065179c2, 0x015ded499a471},
+    {0x18de4689a7a28, 0x8906b505121e8, 0xdbfca32ab3813, 0x3e17b7b6236f2, 0x02bfaa33d5e93},
+    {0x8a4d3386dcc08, 0x8c25bc04c5d94, 0x8cc9465388a70, 0x5158f4419fa58, 0x0123ae41e3479},
+    {0x6abf2c16ae7ff, 0x4ccf28e8ddf76, 0xcf91773cae1f7, 0x291d4fcf7cbd7, 0x025708ad8100e},
+    {0xa55819707ec41, 0x095b9d82e70a7, 0x4362b25291ffe, 0xda33473d1e096, 0x011f3f268b4d3},
+    {0x8a2446c46ecf3, 0x2425e1bc0cf3e, 0x700b4cd296ca0, 0x7b678eda3c1bf, 0x01f775460be13},
+    {0xb2dac90396249, 0x043353e049dd3, 0xea2a8681f2c53, 0xd9af3bc17e901, 0x00dc6bba61434},
+    {0x1ab71881c8c5a, 0x6d3f93c885d70, 0x135d048461885, 0xbe111c0abebee, 0x02d7427b72414},
+    {0x461b209cde70a, 0x16a80b1e6a3b2, 0xe940a9000f1ab, 0xb85e267b71400, 0x025ccde69f4f7},
+    {0x0d0371769b15d, 0xaca86e3d9fa5c, 0xdbbaed33ab26e, 0xbf8a9a9adf269, 0x01099cf2cb731},
+    {0xa805a7713a7c5, 0x9375a28307d44, 0x1d33be7c6cf80, 0xa943563e65a81, 0x0276c7e6dc2c5},
+    {0x79a82ea5b27f4, 0xf924bc1038553, 0xefee54c7e00ca, 0xa7d8bbcb014e4, 0x02b402b13121a},
+    {0x930e1d3360bc1, 0xde8d7a4bd640c, 0x769cb2399bf45, 0xd7332ddc340fe, 0x0233db74c1dca},
+    {0x4e58b8e5a98e0, 0xe7ee66fe18da9, 0x4dc5a78b8a554, 0xab2b34c8a254c, 0x003c311be052b},
+    {0xd1871f9fb2666, 0xa5f27141afce9, 0xc65f03283420a, 0xd8cdf4879b002, 0x021c04921e19e},
+    {0x528a4db4b9207, 0x338d2d0be9623, 0x338d1a790a320, 0xc79fdf4cc996b, 0x02516a9529518},
+    {0xc631033dc9f08, 0x673afd29a171f, 0x06ff123098779, 0x3aa6fcef59cbb, 0x01f359082f571},
+    {0x87aa86648f705, 0xa89c1ee3104df, 0x639c55e5c19cd, 0xf7a7b6ca9700f, 0x01f619aa58241},
+    {0xf49393d2d250c, 0x56be98925ed34, 0x55e403ab4cd19, 0x66b89ed8d0d32, 0x00c4059be9f52},
+    {0xae650baae15c1, 0x81f4b3f552040, 0xb224adf03e615, 0xd210167e15cb5, 0x015e03dffe65b},
+    {0x4df23e56a9623, 0x072d9d688456a, 0x2ea265070af1c, 0x3535f4a54695b, 0x027c049fbba54},
+    {0x5a28c4da47ff5, 0x8f7c635aa5002, 0x8e2d87a69aa50, 0x9d34eab093d6b, 0x005ecfd934910},
+    {0xd877ea58d6c01, 0x47e6e06882be9, 0x426aa2912308f, 0x4faf930b53469, 0x009531df99275},
+    {0x2e03722d2c2da, 0x8f142ecd08466, 0x107473a13cf38, 0x989d09470ca5d, 0x00aa37d161297},
+    {0x41e8262a6c2f5, 0x7b5410e8b8dc9, 0x9043a38566b0e, 0x5df66c4c410b7, 0x013fe1e144e74},
+    {0x1f175b34095fd, 0x008ed23e89324, 0xdd1947fe22eaf, 0x76650d9d83eda, 0x0052e50f224ed},
+    {0xe56a5153028d3, 0x35ff2174a1345, 0x16b8a1a9ad223, 0x77244355508f7, 0x02b413bf3f010},
+    {0xc99294caf729a, 0x508450cbc339c, 0x431f6da3f8c3f, 0x066e450924335, 0x00c32363b84f7},
+    {0x88cd376f6c148, 0xf6b7417b9ca77, 0xd9979c9ad3809, 0x59bac8cd3705f, 0x01a5409082b23},
+    {0x38f0200472cd1, 0xb8916b9cbe16c, 0x79a69503e7fb8, 0xce7e043dc621a, 0x0299977775793},
+    {0xe52e57cb4662a, 0x290794bf8047b, 0x1c184b54f1861, 0x492b85af40a21, 0x02e5eb6aa3bbf},
+    {0xee4fe80bbdf88, 0x2e9fd774ec1f7, 0xa0f10000e2229, 0x5cce38811c39c, 0x00443033865aa},
+    {0xeac0a35b36f26, 0xeb437d2aa70ee, 0x141bc86aea81d, 0x1eadd47627923, 0x01202e06d0a79},
+    {0xf11c6a8e8717d, 0x7bfd9f9627354, 0x3c5b3f6853fcc, 0xf2791fc5e7224, 0x01f83a595603b},
+    {0x5ec47ab11f6ef, 0xfba649258ea19, 0x8040f524aeded, 0xce841d99f9363, 0x013f7daa0b360},
+    {0xb3e13d1998e12, 0x2aef50214985e, 0x4cf9aeb46a95b, 0x5c4dfa8c89f44, 0x0179b44717cb1},
+    {0xbfba16946b45c, 0x3aee9180abc86, 0x7806e8a98a988, 0xef69553ea3450, 0x02e7b61c93a30},
+    {0x93f0c540b870b, 0xd9a54cd1dcb90, 0x0d42a6828e2f4, 0x69f332395f6a0, 0x0156848e62022},
+    {0x805538a0621b1, 0x93679d9ef02ba, 0xb4f5afd1e5971, 0xfa31454b5f400, 0x0221818e3e3f8},
+    {0x27b8dbbaf89e9, 0x95948939abad0, 0x71ec586e61fb8, 0x7a2b2e8cf2888, 0x0078d3d1a09ba},
+    {0xbeb4b4a0e0ac6, 0x1f3222a99a00c, 0x990061c5af4fb, 0x4da574742b919, 0x029d5214ec0fa},
+    {0xadbe37a3f93f4, 0xff20e026de18c, 0x13f080ebb6b72, 0x70888dd7142e4, 0x026abe155deee},
+    {0x7641535a0217a, 0x825f59981b409, 0x2c6c9db0fd1b8, 0x2a43e6a5e5bda, 0x022baf2c1b6d2},
+    {0x39ab15d452dd1, 0x7a5a300cf69fe, 0xcfea1f19f6685, 0xba850b1d69a75, 0x0239b701a67ad},
+    {0xe282d2f2c922f, 0xf2e89682fea32, 0xd33d8f746732b, 0xb6afa1665d24d, 0x0258d3f1220db},
+    {0x38cb49aa86d0f, 0x3e00771daad6d, 0xb7496029cf228, 0x64b90de29ee45, 0x01dcd27c6f282},
+    {0x0281c625c9e0b, 0x7caa26a08de27, 0x9368716673cf6, 0x1516d20810794, 0x01cbd320965d0},
+    {0x55bdd13df5a13, 0xd53554b5371a5, 0x8d3683235cf4f, 0x14ebf76d4a3d8, 0x00a6295e91af8},
+    {0x1c7970a01629f, 0xc2379862fe416, 0xb1f4722cc3c78, 0xe3404d955e602, 0x008c6ba7c0df2},
+    {0x22ab397beab0a, 0x25f89b49fe034, 0x27c8a5fa927fa, 0x07f86310e25ba, 0x0261202cb7605},
+    {0xbca91bb885bb1, 0x6f0bc9a545eba, 0x2d227608faafa, 0x04277de969a70, 0x01956f63e842e},
+    {0x984d33bfed6c3, 0x7740b15520841, 0xe2bdd76cc5dc5, 0x4b42a78a6d6fc, 0x02ac20d99d285},
+    {0xec10ff6270302, 0x1653a4ea45586, 0x1e8eb5cf88411, 0xd3f1d61f13691, 0x02c568eb78943},
+    {0xae2d0e86f08c5, 0x5def80f2c7224, 0x98baaa66f504c, 0x2652c3241b8a1, 0x00fb999109b28},
+    {0x32cfbcf5dab35, 0xf5c986036a2ea, 0x1c4f25ed11d80, 0xdfadf28297ac7, 0x0245df8edea1d},
+    {0x59e922b72d241, 0x1eaf770518b65, 0x0cbc1d5a91e50, 0xd748c4d817318, 0x012e671444b4c},
+    {0xce5f02b44915f, 0xdb46962fe1794, 0x48bf3ddbab1e6, 0x46bb3725e76c9, 0x01699c4ee050f},
+    {0xbe8ef269e0dc2, 0xc041d53cbeb91, 0xba608c2f9e207, 0x5283a72156627, 0x016807ff30748},
+    {0x8b7eab1866d4a, 0x6ab50208bbabd, 0x9d053d4cf6169, 0x9ad734ef20c07, 0x011dc534bc7dc},
+    {0x41f75db66e31a, 0xa4fb48ec2f500, 0x8d2bb21ae09da, 0xb33eda4a29e59, 0x000e455664250},
+    {0x7feece5898f3f, 0xe99af4458d3a4, 0xe8859a2effdef, 0xd612362d0dcf6, 0x00a5fbd21b8fc},
+    {0x7c3793aa55c28, 0x8020ecc43f138, 0xe615fc1a857ac, 0xb4f1ebb03b61d, 0x01444bdf06df4},
+    {0xb7e596eeaec47, 0x198b528fe2ab0, 0x48ce95367bb3d, 0xb177e3db74239, 0x02a15d14db3a3},
+    {0x5c7a34922b2fc, 0x97910e7f04d29, 0x7250c800c5e15, 0x936dc47954a68, 0x006f5d69c92fc},
+    {0xec62a48396530, 0x9ca1c2ea9a73c, 0xa5c8f5c7f2e2b, 0x073bf1206ea39, 0x009437c2715d0},
+    {0x122c4e5f18f08, 0x4aed5385ec52a, 0xc493e8fef3114, 0xca373b2b3082f, 0x0202b8bfe0baa},
+    {0xedd11946887c7, 0x92c0dfa71eb0a, 0x7c3decee341b0, 0x88060db5da182, 0x00d8defc7f487},
+    {0x8cf4d6b6c5d9b, 0x0db87ff0e9b23, 0x8e7832fa96c40, 0x1c9d45d55732f, 0x00aa5a27a6c16},
+    {0x8234ae33f3f9b, 0x08bb27870f43b, 0x0033ca1c9cc83, 0x010fa052cb342, 0x01a673e2b0f29},
+    {0x2939c332f6a95, 0x548e96ff5905f, 0x714f881d6b29d, 0xb05b35abea5d7, 0x02f34c69baa03},
+    {0xc1fab604d05c0, 0x34a5b8bf561e7, 0x82afed39372e9, 0xc44981da39e1b, 0x0011f7adb14f8},
+    {0x8190e6701d3df, 0x3f9dd3b84b2ad, 0x98edd781f4900, 0x21487aeddddca, 0x0116c805d36fc},
+    {0xb4aab9d02cf01, 0xfdb5e4ff82ce7, 0x827d5222081f7, 0xd7a3b651dabf9, 0x02594b3cb09c5},
+    {0x050463747866b, 0xdb0557cf6f372, 0x8a37c9196a401, 0x18ce77ea01016, 0x006c42dd8dbca},
+    {0x60369af4b04df, 0xbefcdaddf2a10, 0x72abc8dc1ffed, 0x729b0a53aa8b3, 0x01d2cd813d866},
+    {0x554e0168bd084, 0x5aa819371576c, 0x652d12585aad4, 0x78bb3e7da0ff2, 0x01ebc5ee79aec},
+    {0x1310a50009fc6, 0xd15047440211e, 0x0c4e46af47bff, 0xaecc3d75ef1b8, 0x012139215233d},
+    {0x58e647d279006, 0x3b39623f6d6d1, 0x13537fe3be972, 0x848f79982ca87, 0x029b2b0511e0b},
+    {0xc31226467e9ce, 0x8be8559705c02, 0x17d62b0aad1b2, 0x55da25a9af9f6, 0x015a096f565eb},
+    {0x4f186f7956e62, 0x9369b79fcbf53, 0x4e26b981768cc, 0xa3b2c54160972, 0x01fbc99db1fbc},
+    {0xd7e0610539d41, 0x7c570b9db68d2, 0xcbdd759f9325c, 0xe987de9fdaf9d, 0x01a3bdbdd6e9a},
+    {0x2ffa625a32ad6, 0x69940a3675aad, 0xd4c212447ac7e, 0xbbd96ad8223b6, 0x0287cde9cd9ed},
+    {0xc8ad20337c25f, 0xe8726d210afd7, 0xa950b4e41baf9, 0x30d5f16e4b515, 0x027f843791fb0},
+    {0x8dc5299710358, 0x2fe3c19be6364, 0x115c4c20cdb81, 0x5bfb7a996d401, 0x022516066a947},
+    {0xc0dc545e4fe33, 0xcaab97b5074c0, 0xf2a73503d52a5, 0x1484827e98788, 0x026224e417b7d},
+    {0xb7385838c443d, 0x61ae6fc2b5bb8, 0x0739e4c868ee1, 0x15309ad3de403, 0x002ac30cd809c},
+    {0x3712a39a41606, 0x9c8b27169c51b, 0xc7a464cd52b4e, 0x1ee52470f359c, 0x015438776ff1b},
+    {0xb6752ee78bf6a, 0x08c19c2e104e1, 0xae9d3cbcf3d57, 0x365cdbc4327c2, 0x018933c1205fd},
+    {0x8f7b18e809061, 0x55ddd62876075, 0xcb8df1b25244d, 0x1732a346fcd7f, 0x00f227c5944f0},
+    {0x71eee922b4b88, 0x417b00290e475, 0xd39e738f7cea3, 0x1c76b1c8de23b, 0x02e9190f97a38},
+    {0xfe7bc54c3dd65, 0x76d76e7986526, 0xa7513e05715e2, 0x9777488ea9f80, 0x02f979152b16f},
+    {0xc056b86c554e7, 0xb6089f53a0f0a, 0x7314d1e27cc32, 0xef515a6c83c47, 0x012739f3029ed},
+    {0x94697570db8a8, 0xc5012c87497d6, 0xa02299b74d746, 0x51877551c4fb3, 0x0075081f8949b},
+    {0xc75c89147ee62, 0x457568f541ea2, 0x084944df53c74, 0x3285ab3cf3128, 0x00680894346ec},
+    {0x482047e96e615, 0xa7b279d0ccd40, 0x9138c02f15a41, 0x556ec95995082, 0x01a8791d40e09},
+    {0x345a21c00943b, 0xb9fe02c2aa91d, 0xad52828bd2a47, 0x7632798ae90c6, 0x0199d9ff52735},
+    {0xc1db24e6a1c74, 0xbaa27b4cf7e8a, 0xbbfd182ae32fc, 0x7624c5fae565a, 0x0189ca68254c0},
+    {0x6ca956f4c08b8, 0xaaecdf9d27102, 0xd4d620366bf75, 0xe22edac371fb7, 0x015d88b6c3faf},
+    {0x754c23b2c132f, 0x1b88692b42917, 0x753d974c9b2ad, 0x2132c0ea640a5, 0x02f677e142057},
+    {0xed0cd1fa55c14, 0x077b2a0034666, 0xc62a322dfa097, 0x81ef41c0b91c7, 0x02fd667624e12},
+    {0xa59977c8ca58f, 0x4df37f048fe4f, 0x89fd8b91687d1, 0x59ec19573c08b, 0x01c09d7c64ea4},
+    {0xd7d7fd465c52b, 0x42b32393f7611, 0x00822f00fd693, 0xb7bace3eab58c, 0x02eb12cf46e24},
+    {0xa76554b4d15ea, 0x5df3779d9f4bf, 0x43773cb30236d, 0x59a9c7841ff41, 0x02a14e651df3f},
+    {0x90cd78f09924f, 0x75867d21cca84, 0x2537dbc1f8999, 0xc3461685dd89e, 0x021ff73a29ae9},
+    {0x57bbacebe911f, 0xadc834a84b197, 0xb5861d0f8aa20, 0x84b90afead840, 0x0161ba6f284f5},
+    {0x2f820866d63c1, 0xc93e24a40661e, 0x8e3658c3aeb1d, 0xe88e54e32cd99, 0x015d722d09a51},
+    {0xc0b478de00df8, 0x9c6cd376b513b, 0x9932dcb89ffda, 0x3f44fad829499, 0x02c82dc51509a},
+    {0x2bccc95dae293, 0x3482d77dfdb32, 0xa2b6ec9b2ca74, 0xa504d9b97a7c7, 0x02b0482c4a06e},
+    {0xb79097ae6160f, 0xb685d1aa80bf5, 0xef9ddb013422c, 0xc40db5d31185c, 0x01c38dba0c2a9},
+    {0xcd352d0f268e2, 0x51c024ec9ecb7, 0x10eef23c5fc1f, 0xe74effa9292a3, 0x0156571cd91ff},
+    {0xc911481cf5acf, 0x1802729d7a7d8, 0x632771dbf1c9f, 0xe71782844ed98, 0x007b5bb143a49},
+    {0x95b4de8818685, 0xb0af6ceeefe6a, 0xf476fdb6b692a, 0x489dbe5cd47a2, 0x00fe8cddd03dd},
+    {0xa77e8c6ff2764, 0x8881fc4e7b699, 0x1c6ee93f55a33, 0x72f66aa30acf2, 0x021bba4cfb010},
+    {0x119aedd97cfa8, 0xc2ac36b7a0969, 0x0ea01c44d0b13, 0xb94faa03547c7, 0x02ad943b3df3d},
+    {0xcde747888ed6e, 0x861c30150e139, 0x274ee608ee073, 0xe7d10a838843f, 0x00f6c59280f18},
+    {0xdda0695b39242, 0xf418371f8d8b0, 0xd3565ad2a9fe9, 0xceee5e04a2349, 0x006fb6832d579},
+    {0xcd8500181bf32, 0x7c86361e5dc20, 0xb31653ddd68e1, 0xd463981c46c8b, 0x01020a2ebaff7},
+    {0x42de9872ec37a, 0x58f2efe2e47d3, 0xb351ce4600258, 0x97eb407052da1, 0x018b7b8158ab9},
+    {0xb0fdc8571e923, 0xa2de36778b7d1, 0xd7f640428c822, 0x6a46f8d2e1e3a, 0x02eecd0917bd6},
+    {0x4b179319d1305, 0xee3a529e46048, 0xc524d9f9ef001, 0xfb0046bdb5623, 0x00acaa8ba020e},
+    {0xb3b8960f3889b, 0x53a9305709730, 0x9cb2bd7acc8fb, 0xc00bb6f1ff3ca, 0x02704e4d712d1},
+    {0xcad4c833e045e, 0x5f391f0057680, 0x34142efa2154c, 0x0483ce08c9f26, 0x00d877a7975cb},
+    {0xc563d12edf8a4, 0x1a04391effa1d, 0xb7897bd3bbbc9, 0xa7685ef419eda, 0x02dac95ace708},
+    {0x06430dd5a3c56, 0x317384f1e9b07, 0x4393b1baa17c6, 0x7e1c8ab9c01a1, 0x02ad9e7b0a417},
+    {0xf639ff53eb47e, 0x299b8d5c6260c, 0x2865e0099ee51, 0x85281e8974ee1, 0x0303b9fec0b4d},
+    {0x75d03caeeafca, 0x00359a505e12d, 0xe471a0a812e29, 0xf709530a10b3b, 0x006d413e8685a},
+    {0xab2627359feaf, 0x3b84a25d0d294, 0xf61107e5e222e, 0x806ecaadf3ce1, 0x00b136fe87f00},
+    {0x626f842c6ead2, 0xd18e09bac7cf1, 0xb47406f0092a2, 0x2f030d91ecc75, 0x00c5800ca5f8d},
+    {0x81aadac946bd0, 0xf072c0561d86a, 0x48e903a445cdf, 0x31981f77db0cd, 0x01e375094ac6f},
+    {0x0a1e394836dd1, 0x22c9cb4e8416a, 0x30e3d606e635d, 0x6461863e365ea, 0x011a7602dea04},
+    {0x067ca1f7f8a04, 0x8a88db4b4c446, 0xe5e398c3133b8, 0xb953a34dff135, 0x02603b2a953e7},
+    {0x6a12cf4f9ce09, 0x1338219928a07, 0xfc7cf97f321d6, 0x1c19df3ee787e, 0x028dd842816ab},
+    {0x31fde20722a00, 0xca87121d8b5e7, 0x67f4a01d4405b, 0x20fea56134803, 0x0017e07c06c7e},
+    {0x6977acf38ed4e, 0x2754cf013f794, 0x05419a8d83e8e, 0x1c9edcbb3a860, 0x02050d94a1220},
+    {0x6babdc104b16b, 0xdb1cb5409e29a, 0x3c0deda7b4894, 0xd6d95d8087481, 0x01ac4ebaf24e0},
+    {0x55049df9a7457, 0x33c92b4f66244, 0x61f94dba528db, 0xfd4a48dd593c9, 0x01ebb02fc2f8c},
+    {0x285f016cb515a, 0x3109769eb5cd4, 0xfaa172eabddbe, 0xdce3df34b3fb2, 0x0181e87add29f},
+    {0x55536a9d092f5, 0x7ec0fb8959c25, 0xd8a912625f294, 0xbd72e72cd9a1d, 0x023baf950f47c},
+    {0xfd71ca91a7a26, 0x2057a8a8a8dcc, 0x3d8a5bb61e075, 0x4dcdea4dd1057, 0x01c162a717bb1},
+    {0x3a999228df12a, 0xcc34610b4b1d6, 0x008683ed674f3, 0xc3e5af1113baa, 0x029fd83a0524f},
+    {0x48f465c991226, 0x440b656f91a39, 0x4ac8fd8e456a7, 0x8355e740ae600, 0x00ef46b271daa},
+    {0x0927037f190b5, 0x998ad48ecbba7, 0x1749ecbaeccd6, 0x883b182abdce5, 0x02ad9584d273a},
+    {0x9fefa49e2f919, 0x7a4c45e1f79e0, 0xa3e97ed7f3d6a, 0xe7fed5c1f3b63, 0x01db295f1345e},
+    {0x7a295af25bbe4, 0x84d958c69f289, 0x025c7d8140e49, 0xadd45759a23fa, 0x01b6ae05f1847},
+    {0xf4c402b5e079f, 0xd81a8a70c6d20, 0x95e3c74eb6cbc, 0xdfeb16b0970b8, 0x00dedc0917bd7},
+    {0x6f0ed121dcb3c, 0x9105bcdf9fe60, 0x8ae0ca6dac0d3, 0x29e80278e8abb, 0x00a9669085802},
+    {0x9ba12a8f8bc72, 0x62a4dc2fee121, 0x7336ef70a9c80, 0x351d0e513a035, 0x014c61c1c647a},
+    {0x7787420cdcd02, 0x6026d066299bd, 0xe041f73cdd134, 0x8b9e3ad3608d0, 0x027a3fcb6aba7},
+    {0xe6a487b7e39f6, 0x138f4ab68dd2c, 0xfa39da724b38b, 0x49ebb1f371404, 0x0046565e967fd},
+    {0x84911dafa9730, 0xb3305a1372250, 0x0e6c7ae74264d, 0x14fb680af8862, 0x023eaf5caa784},
+    {0xc06e92d5fc225, 0x32f2538c05817, 0x1229618b949ee, 0x12a1fd3a07c85, 0x01d73e35da3a4},
+    {0x244da2298460b, 0x8943a9497fafc, 0x82d1f8c4f5e87, 0x8e69f25fa2c5e, 0x0077f42073a60},
+    {0xd00b1ffdb2995, 0x997d539d4ad13, 0x21d9997ad9c28, 0x83bd44447fdf9, 0x0057428547346},
+    {0x11a39ae8e3389, 0xfb29687acf1cb, 0x4bf5dc58389c2, 0xd5b427fcc2d68, 0x02cf5d2f5d114},
+    {0x6b9b0b42f46ff, 0x30e3ace96190a, 0xf1808b204781a, 0xbf99c800457db, 0x008f973dcb5b0},
+    {0xa38569c3a91f9, 0x57711ba69feb6, 0x16dd3c11d733d, 0x80d66b4655ee7, 0x007bbd2b18805},
+    {0xc1f098a2f7803, 0x614390f7c1d76, 0x50b248ebf28b9, 0x164c91f68107b, 0x00893d52658dd},
+    {0xf2f1c4f4d5498, 0xf1dafb1949a20, 0xead3f839c67b1, 0x8099c853055be, 0x024a045acd700},
+    {0x4f28eb966b3a1, 0x90c3269810b65, 0xced1e6f6d8663, 0xcfae2c967c9e7, 0x00ed7992763d2},
+    {0x0e13f9aad775f, 0x6e9a37d96f398, 0xac5d33fb510d0, 0x47b6d1ad1fb13, 0x00ba0d060b670},
+    {0xdddb59264c7ea, 0x065355d2a688b, 0x17c8e6f3c27f3, 0x4f5eb14f2ac25, 0x022f7961a4046},
+    {0x0a3aa02d0eaab, 0xa6780ce8c9ce3, 0x5bce92d632cfc, 0xd99aa753f4b7a, 0x00c4e118b3520},
+    {0x70d587c2a4c11, 0xa96f88003b3fb, 0xfcd6c8c5ae952, 0xbc03b9969e757, 0x030114e76b5f7},
+    {0xa19698a310650, 0xca7860f16e5ab, 0x9a8fa708f72a6, 0x44a06f5621830, 0x01170aedfae00},
+    {0x97e565aa37731, 0x4b8c9972ec62e, 0x1e06d89d9109f, 0xbaf8be45bec58, 0x00d494bdfca92},
+    {0x91e9108564777, 0x3ec66f5d8c726, 0xf1933aad2c297, 0x8fe4358382c81, 0x01f73aabdde2c},
+    {0x0d9159fbd5540, 0x03f20b98d53d8, 0x0fd987276f994, 0x1915bf42b53ae, 0x0188e9dc9605c},
+    {0xf4443c24de9fe, 0x39ae9b9c9e4b9, 0xa65500f249bae, 0x68b731b161921, 0x0143d4a0c4c99},
+    {0x9c552467c3432, 0xf8c8995d9ea02, 0x1a0fde403460e, 0x462f203745d4a, 0x00379757079e3},
+    {0x9edcdd5051bf6, 0x3914725ddcd51, 0x2cdddf61a90f4, 0xd4f0d9668a0dc, 0x010d2dc2170ee},
+    {0xe313cc74770c6, 0x63dddf5025b27, 0x2d8458fd0a11b, 0x880c43551b21b, 0x02f2f7816c39c},
+    {0xa5a6216425f81, 0xc05b19bd10e0e, 0x527cbec523fed, 0x61324f633768c, 0x0069f6628d9f3},
+    {0x8221b3b735a48, 0x1826821379d4e, 0xb90898869b700, 0x3cd64ba795857, 0x02d4893fe0df5},
+    {0x2315790ab47ab, 0xcf7d5e7a5bc30, 0x2aed1645d73cd, 0x39bf38c05f310, 0x010f16765a4ff},
+    {0x5d387d78b097a, 0xde6d09eb07c39, 0x8870262c6be86, 0x370d248d94bb2, 0x00ea0b4642a20},
+    {0x725aeb44d271e, 0x0269ffdc3a059, 0x5528143c1fc4d, 0x91af8ef6510cb, 0x0166b19f5fede},
+    {0x8630325f007c2, 0x2d417642a3c09, 0xfd42e6c1931d8, 0xc93fd7dfc6a51, 0x012305221fc67},
+    {0x2f3e3495cf6a4, 0x701337a7bd7ae, 0x37e22956da0f1, 0x37c398142c755, 0x00feae6dc7261},
+    {0x518f326b922f8, 0xd89cdb7458625, 0x97d864d520bbf, 0x315c3a9a6bd40, 0x023a33d38d291},
+};
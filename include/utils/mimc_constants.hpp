@@ -0,0 +1,817 @@
+// Generated by utils/mimc_constants.py, do not edit
+#pragma once
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+
+/*
+MiMC round constants c_i mod r (BN254 scalar field) in Montgomery form:
+- MIMC_ROUND_MONT[i] = c_i * 2^256 mod r, 4 little-endian limbs of 64 bits (libff::alt_bn128_Fr)
+- MIMC_ROUND_IFMA[i] = c_i * 2^260 mod r, 5 little-endian limbs of 52 bits (FieldIfma)
+*/
+static constexpr size_t MIMC_CONSTANTS_N = 399;
+
+alignas(64) inline constexpr uint64_t MIMC_ROUND_MONT[MIMC_CONSTANTS_N][4] = {
+    {0xfaebcce77a7766d0, 0xafdc300c0f2e4687, 0x9986d77f1095b092, 0x268ab589bbff28fe},
+    {0xb954395d2efd1dd0, 0x8999b749b4309d53, 0xa10da9717f8a36f1, 0x1893fab7b0e116ce},
+    {0x82cd86892689b182, 0xcff24598b579f678, 0xd3b44c6834e88455, 0x12a062ee5782b73f},
+    {0x386499d9fe12a304, 0x1381bf214110afbf, 0x37f6107902b7ae54, 0x0f8135be0cbed281},
+    {0x5e9e6c7b9c04b82c, 0x2d6f7bc6c8a63de4, 0x048d0d41ce753564, 0x1e98bb36fd2c27b4},
+    {0x28e1a257e2ef2d5c, 0xce27cb6d75ff6525, 0x94d3c8d16a2cc889, 0x074726c170990866},
+    {0xb56ffa66fb85e1d2, 0xba47e3f32333e331, 0xf69e6b9cbcf6ed50, 0x0120e1a0b15e36ce},
+    {0xf7c7848d0faabdc6, 0x921265124fbce65d, 0x6912a5d0a30b84c3, 0x1a5adcf68716c5d4},
+    {0xdd035c64ddaaed0e, 0x7e89687f5b474074, 0x37c09ceee39b6d51, 0x108cdf08fc3fb78e},
+    {0x11c6a5ceb9fb2aae, 0x533e823306b8b353, 0x954269021e6c3cdd, 0x025f12c99a0bc401},
+    {0x66277b7f281df3cc, 0x5b4d0f1b5781a7d5, 0xdd6657e333b336f7, 0x002502deeea54f18},
+    {0xc7abccc008d1942b, 0xb2f9197a39ce7b04, 0x9bb382e20d6e9349, 0x303f4931b2edc2d5},
+    {0x3612f22c2a3ac930, 0xe778b3bdcec07133, 0xa6f091e1e70593a9, 0x2df535c4883aa9de},
+    {0x3201861b060558d3, 0x388cfb468bcff888, 0x00ad59336ca49616, 0x18f73b085c7837a7},
+    {0xb5054a0bdcfd3a33, 0x596183a660a22c19, 0x1ebb75e5e89022ca, 0x13e5df3445f0fdd1},
+    {0xc2f4abeb719cef02, 0x9d9e8577f5385e08, 0x0284fa96c5c64d29, 0x07cd17836a80dea2},
+    {0x47b8f86acb602b9c, 0x3fc2d168b99f129d, 0x41db5ab6744f8c65, 0x1e6e25aab772ee0f},
+    {0xb01fa5fe04447b0d, 0x350b74f4a9755abb, 0x6f796ae0d911f4e7, 0x073ad45d82513ce8},
+    {0x1b3ceb6ffc59296e, 0xd3885be558d3e83f, 0x2b8c7f3f12a5bbc9, 0x07244772a7497380},
+    {0xedd9212d9250746c, 0x58452d9dab0e720a, 0x81e0e71dcb01edea, 0x255a91ca22d00773},
+    {0x2fc3ca1cc400aa21, 0x4f637e2179591d9e, 0xb8245998e969364c, 0x29c62bd78946305b},
+    {0xfe13c9375efdefca, 0x70aa39470d0e5d27, 0x8077b462777a1cb5, 0x28312630d3996c0a},
+    {0x07218fc5e0c3dd09, 0x08ba8a5d62fd7f5e, 0x09a0ee6d3e99e1bc, 0x1c9552888911f8f4},
+    {0x14874e0f6a0fa496, 0xb3f6661133ce79e8, 0xe14ea53253b27732, 0x14221f4ed3b430b1},
+    {0xb8ec6b042866724d, 0x6ceb410c0f01b3ec, 0xcd0e1941b593db47, 0x0f9d1af55c396705},
+    {0xbe55ce4e6052b94b, 0x4f8015827ef36583, 0xf46479118350e0b2, 0x00db5c492ba6a7d0},
+    {0x2d7aa70abc37872c, 0x8b0d56c4e8a0b203, 0x3f36c69e8afb3218, 0x01a470e6d28b3d06},
+    {0xbe5f5ca50e989aa8, 0x2efcc95472cc677a, 0x244844edb0f16188, 0x206d655c6f2805e9},
+    {0x9cacaa7d79b9f7a3, 0xb5e125db01d7aeb9, 0x50fcd0a80b7e6643, 0x0512a1d348f3c1ab},
+    {0x62a6ef048540f0c2, 0x636c04f91f466e72, 0x8a2126ace4dd6a44, 0x2ee4c43d5e60bd14},
+    {0x687bf75aae223fd4, 0x085339e4ba510cce, 0xe2a19d53eff0c0ee, 0x0c4368c6589b929e},
+    {0xbb448ebacb2332df, 0xc3df4b7694796832, 0x10db01b94399d07c, 0x1838de88c4fb0ca7},
+    {0xa55e1abc40115d61, 0xf6bbcb6713f3af2d, 0x77d789a935e7a4b7, 0x1835b569d9f7900d},
+    {0x00661bec75dbf7c5, 0xb71023abfc3d4d43, 0x912d942168946892, 0x18d556a182c95960},
+    {0x7660257acbabfb74, 0x8001a966f2322cf0, 0x5d2e35ad89663b5b, 0x1e14e1d2d7cc9c70},
+    {0x17823599cff5e5b1, 0x4e3626a87ee190d8, 0x57a65e465f77909f, 0x137ea64e64801944},
+    {0xb9db4cb8a43ce939, 0x205262fa38295271, 0xf349c2a91101dbcd, 0x022174038e5fc52d},
+    {0xfde121974e3320e1, 0xd67577ccba30ae12, 0xb28b0c06dd8f6687, 0x26105da2f2074e6f},
+    {0x9bd002b7bdde9350, 0x952f263e8d54cc7f, 0xf6308da3af5615bd, 0x0a56fcbaac1db14e},
+    {0x87c77f088b0e5f64, 0x95d0c2cc2d6c856a, 0x485a0872630bb7e6, 0x0d78d8b56b34fd13},
+    {0x94def0e6f35995dc, 0x387f1e1e4625f795, 0xf8ad9ff03db9126d, 0x1333187962e04fc4},
+    {0x2022c2d0b6e7bfba, 0xa864d412da004337, 0x15387234115a2370, 0x274e8807aaab3879},
+    {0x893b886a6687c43f, 0x15fc5217f429fb00, 0xdd44e5f20f23e5a6, 0x21a71fc0e28d36bb},
+    {0x89fe26622998a2e4, 0x20c76f5a3f5185c6, 0xcf09c1b75fe8b298, 0x20955d5be4bcdb5e},
+    {0xf24473d0a0821153, 0x48764e7ef46cb1d4, 0x1619b66642c3388f, 0x294273b704ce1e6a},
+    {0x38c4c5566ef887ee, 0x73a9e61d0de04237, 0x66ed903fd20a092d, 0x00a904fc0d7158ab},
+    {0x852748d14846a9b5, 0x55a3d7ae7b226c72, 0xef1385ac02658daf, 0x2796656f18f7efde},
+    {0x5f0c0f63339aed87, 0x9df87a6834f90c2d, 0x2448f5b1c3d6b1ce, 0x14e2606e816bfdfc},
+    {0x1fc5a8215bfd1b62, 0xff766326c5e52689, 0x0aac87967e3cc88d, 0x25e60c0fc7549850},
+    {0x1675d45d77d428d4, 0x90405e5a2fd176dd, 0xdcc33e355223e8dc, 0x1ad09931c3c8786c},
+    {0xcbc8065a95b28b90, 0x4293ef2f3b2dee88, 0x986959fd84e89d43, 0x2233a0da92bac753},
+    {0x4f513751bc48809d, 0x35a1a8dbced91af2, 0xd4731a0870adde63, 0x283dd157b511e66d},
+    {0xa0a9b5604a9aef96, 0x02e95d10e047313a, 0x9063f4df77acbbf3, 0x16d4156989161d02},
+    {0x38d419987c17a537, 0xb860f16b88d08b2d, 0x35fa814b4c6a08a8, 0x11d5e3db3298e047},
+    {0xc929e5383adc0537, 0xae89e443768bed6a, 0x123167059ca2607e, 0x2a270f979791daf7},
+    {0x1307bbe61dbbdf25, 0x8dfece1614ab0069, 0xf2845d6e5ff79a48, 0x1bd5c83fdc1f4453},
+    {0x4c42321ee96f8984, 0xe646a34446709e27, 0xab9148e56644a22a, 0x2e291e7d52df3ba1},
+    {0x3f94450a845351ae, 0x3850851144112339, 0xd43aadec51d4ee9b, 0x0ef1c83052a2f46e},
+    {0x6b5a6635ffd7fa9b, 0x33f11663c9a187a7, 0x93771f94780245ca, 0x0e5b6f040a454b07},
+    {0x32fbd74d42fa37a4, 0x23783dbd973efa3c, 0x0156bf48679baf6d, 0x0a2a830c27ce2d15},
+    {0xbb7af7022e039e98, 0x461b9f557a32f572, 0x456dfd149e2bcee4, 0x24e967db31091cdd},
+    {0xeb5561cd01cadebe, 0xcf29629ccd09335d, 0x6ae0309de6ad70f0, 0x0964cdec4787d24d},
+    {0x59958a2e5b77c69e, 0x6e1551df2cb7f5fc, 0xcb6788bc0d8d0605, 0x099284846b036a19},
+    {0x3963d2e9583fa59b, 0x78ebd63cb8e6a0d8, 0xfd9f4ffab1638aca, 0x239a522ab8c94b25},
+    {0xfad4e66cf640a91f, 0xe9d0929da93a2e58, 0x87586489f6ebb8e8, 0x01e081048ae75a12},
+    {0x89c116d95a61d575, 0xed2e7b7ec1a7c68b, 0xc1ab90c90e4b147c, 0x0826106455403266},
+    {0x45645cf36492a559, 0xb45c9c6133dea873, 0xa7b46ce81c1fbbed, 0x0531284908d57bbc},
+    {0xd92efe89bf0e1798, 0x3a284e495efe2158, 0x42a2cb66de2eeec7, 0x1c36b4e2411f40f3},
+    {0x7286572705020f7e, 0x00fb7185fb04e667, 0x388369d71c4f33c3, 0x244ce88bdeda3fea},
+    {0x4ff489e993716ea3, 0x1b7507466db5f218, 0xfb5c0edf5ab37c39, 0x1fc79456341033a9},
+    {0xbd4c427565feb586, 0x6666e6113a6a9d8d, 0xbd0c58e7892d631b, 0x0ecd949a44212bbf},
+    {0xc7fd6d0aa455e0ea, 0x37887600fa111ee8, 0x024aa29ddf5acac0, 0x0e03c2c4e40e1e7d},
+    {0xbed7d0ec13953b25, 0x2320fe4c66bbbb4e, 0x0ecb6da328f4f1db, 0x140d91ed675e9bff},
+    {0x0088eef8b8aa767e, 0x32088e7f371f547e, 0xeea485e258540657, 0x058d03a2537955db},
+    {0x79648f414d94bcfc, 0x206a7f79c06e4b75, 0xb8c1cb7b6d4537f3, 0x06f243e9a9a7cf20},
+    {0x292a034946eba075, 0x95a72eab699eb782, 0xe700b7c0ba90d39b, 0x0614bedcced4f6e4},
+    {0xe9bef9d41e28e660, 0xf52fa8fd0295358c, 0x550ec60004991fc4, 0x050f76e4d5e28f64},
+    {0xcada58b07a9962b1, 0x6acbae85d22948fc, 0xfd8a46954c7682db, 0x01b5e06c2bbe098d},
+    {0x687505c72f0a52af, 0xdff4518e7f64a8a3, 0xa7141210705f0210, 0x0cde984009f3815e},
+    {0xfd82515f7a47129f, 0x83485b76676e1fc1, 0xbee88c01a9cbd9b9, 0x2c6ac46686a418cd},
+    {0x3c9ddc2f93aeea83, 0x0d5fc19894f66c26, 0xf84d6dcc2f5e1e89, 0x1cc2831cb83c794e},
+    {0x3b45039f37385cb0, 0x8cdc32c49a90da6b, 0x181e807883290bdb, 0x18d802f0edffd5be},
+    {0xb07dbecf24326b3c, 0xe1e6b1b4b6a29802, 0x9a709c42ce030017, 0x1ee274132f02f7b7},
+    {0x2d290e95cc10dc90, 0xfc88893adab98e50, 0xd42baad66046c675, 0x2c40781ef30ddd90},
+    {0xf40d2087fc8f2f65, 0x3c73e6679a458a9b, 0xe2234aaded7d1db5, 0x2d8a02b62ef3eefc},
+    {0xda7199764535ca0e, 0x92eacff2d774c014, 0x9a68896707225d03, 0x1775bc2ed414c11d},
+    {0x9ec2b337d51531be, 0x650b3319b135522d, 0xa4d2cd532dd5c5ca, 0x07324016e9ea9563},
+    {0x86b7155ee5f41de0, 0xf7c3ce1f0dfbb1f9, 0x992853423de4cab4, 0x008efe1677db7165},
+    {0x6e4208b3b0bee374, 0x9e781998d43a067d, 0x33145877a309bfca, 0x0aad2802be0f8659},
+    {0xa2a1d98e0aa07464, 0x923f330521065c2d, 0xc6432999bf30a4f3, 0x2e7b7e9aa046de11},
+    {0xbf065dbd6f714252, 0xe981eac177f5308d, 0x138a08d78297174f, 0x00fd0b70a0140808},
+    {0x7b753f7a10cab988, 0x0198269009622973, 0xbcd08965434ab6bc, 0x1fb031bc8ee98a08},
+    {0xa4bd6eb796f0aa3c, 0xf31dd778cf1f05ae, 0x52f10985f258ac90, 0x06197def59c441d8},
+    {0x50e8ed623ca54141, 0x7802493d48d0a41d, 0x438facbbeb4d490e, 0x04f6a3b4ec17f95c},
+    {0x8a35d3eaee21d5c5, 0xe1027b99c1e0e34e, 0x0452a43dcaf39008, 0x2890817fdee9a07c},
+    {0xa4cfde4bf06a608f, 0xe30d7d9855e31235, 0xc3801adab840b31e, 0x1552462f58d95692},
+    {0xd7b97fe7ddc4c4b2, 0xe12e25eb61cf72e1, 0xade568ec5f2d2792, 0x25b9759e1b13bef1},
+    {0xf47bfb1a729aee83, 0x6e0ce69ce772e2cd, 0xfd10003e7737077f, 0x028d62dbd3a075e1},
+    {0xd1fcacc34cfe55f1, 0xc9890314d19df199, 0x851bb66cb202372e, 0x04703292d0781a75},
+    {0x40edc78507a4506f, 0xdd981b799b0a1568, 0x4256645cd2f4cf85, 0x1315d9cc6737a246},
+    {0x4b91d03b16cdb8ba, 0x83d22f0df5d8ff28, 0xc4a365c39e0fff20, 0x0eda868083e431cb},
+    {0xce261b789191ec66, 0x8fe5eb98afa228aa, 0xbb147d4ef11ae1a9, 0x1f94c9915ad619c1},
+    {0x49b56acbc481cee7, 0xb58a41bd8d38c8fa, 0x1eb20c9e1504b139, 0x2d9716f0cff8a4a5},
+    {0xf4d486efdc989a92, 0x8d50bc288da07f18, 0x594c2b0c41007f80, 0x076be8aaac85ed57},
+    {0x118995a8ad18317a, 0x0c704a9d6acd5b6c, 0x3495511595a47df5, 0x06508e0a2e0c880a},
+    {0x09acc9e06dadedec, 0x9653d9694188c353, 0x4a71cf1f0cbce392, 0x05fc68ff02fb56ce},
+    {0x306ed504856a5e9b, 0x47d3cec3f6a214d7, 0x12f37172a2a50baf, 0x1a9be131f9f8b44d},
+    {0x1609c82b9f039bf0, 0xa88fb92da3b37772, 0xab87c09a90700f18, 0x1ee9cfa0d38970a7},
+    {0x25106cc0bd7fd148, 0xa80a9636c458db58, 0x64f7c8fdef0e9d44, 0x12a39147b5c57040},
+    {0xc3fb37d129ca82d2, 0xcd934f1a85021cac, 0x4a781068c9133da0, 0x209fdd19db79aa78},
+    {0xeacb8636ac765d17, 0x9bd1c144bbde7d7f, 0x85b3cde2d6edf3a1, 0x02cca690bb904610},
+    {0x90bc7f54576ff45e, 0x47cfd6d3d533680a, 0xfd87223c3fa4dea8, 0x2b7ffaff5c80ce00},
+    {0x725014b84be83834, 0x1e3b33bc473a2614, 0x7de528eb38ea3beb, 0x20e2aef4561980bf},
+    {0xef9c294cda7070a6, 0x4f067bb0e45a7b60, 0x8d91e1133667d7f7, 0x2e992e4c3526d3fb},
+    {0xbdf661c5b042ac7f, 0xe030815d7b015a97, 0x0d8f9da0547a3be2, 0x047805204223a203},
+    {0x12db020ea24762de, 0x0c7e058bf1c78ab7, 0x2b5f7855acacc973, 0x2311da3f6a371315},
+    {0x03ec8bb0a80c1506, 0xaeb506ada9d99e13, 0xea59c54ec0a92d16, 0x2e94d00d9781c23e},
+    {0x5021a37f44e3ca65, 0xad9781697dbd2b5c, 0x1f3ebe5f16fc7d06, 0x2cafb0e5eabc9aee},
+    {0x534929511d8160a4, 0x2f0ac2922d5f163c, 0xd79a33cade850911, 0x1f6ca88741a9eb88},
+    {0x0c589b46f35bcba6, 0xa363eb5dbfc78100, 0x27e495faa53aeb31, 0x2631e58dcb6b1b3c},
+    {0x565b16a96f4b543d, 0x2c63d4e51cc6c7a7, 0xb75ece11a37eff78, 0x23f8c0dbe898b578},
+    {0x41fe767c8e2f274c, 0x4599de2b11c58b87, 0xe2211a53a7329349, 0x251c4b88dddbe0ac},
+    {0xa53c5482b9cae96b, 0x795ce0449d4db1a5, 0x4e713fb1c192dcdc, 0x2d5024f72f4abca3},
+    {0x245b50c33ba78577, 0xa6b8628d4e83a759, 0xca1931a6267494cb, 0x12fefb0f04d9cdd1},
+    {0xf0560679b391037e, 0x8e883ce760134a3b, 0x8805556efade85da, 0x136b45da42807d21},
+    {0x045ab8646e59c6ef, 0x6bd3b7618a212086, 0xc84a8200ae2e4004, 0x18b57b9524421bd7},
+    {0x9c540ed617a8d49c, 0x0da6331d7efe5219, 0xb230926fa5f502fb, 0x1e273c128603c272},
+    {0x507d8d84a5b3d471, 0x01acfffbe6fca619, 0xf3fd875e0c6cc9e0, 0x19db857fba7c0752},
+    {0x8cdd02929a2966a5, 0x054c6e5afb9a540b, 0xff8b22b9b9baddac, 0x108a4b648612e368},
+    {0x0f20b99583d5dbed, 0x1dab4599834522ae, 0xf96226f3f282fcac, 0x17bf8351017323c0},
+    {0xcf37ef9393c1bdf3, 0xcd798d827ebf9cae, 0x8426c0205b551579, 0x30358259bb31fae2},
+    {0x8d656dfd9a8f2ace, 0xabd83de0b88b7ce0, 0x398f5599fe13a395, 0x00c93908335f3976},
+    {0xaa7e1407d8c0622f, 0xf99fb39d72971f9e, 0x704eebc03ba451b1, 0x12c782c03c0d0276},
+    {0x6be9f8503fdf528e, 0xe73bce483fea3e58, 0xecd048732841f056, 0x1d953b41b52160ff},
+    {0xa3a5b14e06b88628, 0x10a760a8f333f556, 0x2fc9d9de2776cc45, 0x1e7c541dfda3df5a},
+    {0x7cac8100687b9ec3, 0x95809ded91786636, 0x4cfea1128416492a, 0x0360a7b70422027f},
+    {0xe39c09bfcb0a7629, 0x9fc1c01792fe8a58, 0x97c466f59811bdc8, 0x2877182905c8aa99},
+    {0x4eef61d0266fede7, 0x1e88decb62c242b1, 0x29c3b15cd9ef455c, 0x22dd25d2cf61010f},
+    {0xab84e197b5e9ac53, 0xa80c0beba4b8f510, 0xca3548272acb77db, 0x2896a981bb75ed1d},
+    {0x5e1f2910b3361e85, 0xeb707509bc7bbd46, 0x720eff1eebc10e24, 0x016d9b77d2318e9c},
+    {0xbcc430f46b67f8e1, 0x253afc2fe8688625, 0x49e4227fabf81c48, 0x22fee7d92ed411d5},
+    {0xfa85f5a758e8d560, 0xafc3f63b0b20c294, 0x68d36e179c4711da, 0x0ba5b323f70cfa9c},
+    {0x89c74beee49cdd39, 0xfee7350e771eeb56, 0xd697120d3a0c14e4, 0x2301cf286172cbd0},
+    {0x8596597ae4604936, 0x987e621fd6679192, 0xe2796d616d11cffc, 0x0c5c900ca82d4598},
+    {0xe3a159f8bedb1def, 0xa1713ad22ac5d6ed, 0x9bbc053cb23bee52, 0x29e7e08bb26b284e},
+    {0x09e4fc6a22576b08, 0xe6ce0869e4d026bf, 0x4ffd17f7fdeece92, 0x2a4236b38fcaf921},
+    {0x66af9707929f5118, 0x457e3d78507055d8, 0xd564c577d0512d6c, 0x1d8da30582b129ea},
+    {0x5565bf38d06f773e, 0xdaef3a97aef4454d, 0x5aebef92d8cb8317, 0x08a02bde09a80ba4},
+    {0xd8ff048e31d972f3, 0xfb6651290da89808, 0x70abb36d2bbc58a3, 0x16d296599fde9c4a},
+    {0xc5f56b50af7db3a0, 0xd03f07a06cc4a1b9, 0xd04c3dd312dfbf96, 0x0f91e57bea942fdf},
+    {0x1bfac20e09f83154, 0x4f2ce411020b2260, 0x80618f7af7cac209, 0x28f9e2586464577f},
+    {0xf915c4111889bea2, 0x5a2312649f218d88, 0xbbf7d328491636eb, 0x2d9ad47b77ef74e2},
+    {0x4ee61bd911a4e0cd, 0xd14e63b0ebda0349, 0x9eb8b8ba517c55d8, 0x2237ec26c1cb66fd},
+    {0x5a2edbb16c6293bd, 0xdbbd4d47f4205b10, 0x87ba550f0379dac5, 0x10e9cc8ed4bb47db},
+    {0x7b1741cecdbd0191, 0x53d36c2b1a4b9e3b, 0x33d124f752af27ee, 0x06713bbc2fe504d7},
+    {0xab5d414af0638090, 0xfc07d9fb4be7e846, 0x83d1c63fe63dc3c9, 0x012a8bc977b40891},
+    {0xac8f134a013645d3, 0x3d539355bc788fcf, 0xcdb3944ddc12a29f, 0x1163e42ad7c4aa1f},
+    {0x461cc5ac661e5fb3, 0x585212d1af6b57bf, 0xc59b6dccea303fcc, 0x1011b3658c6dd6ad},
+    {0xf0eae390d45452ae, 0x351af41a4acde551, 0xdd6735d5c1ab0c53, 0x0d568acc2e59387e},
+    {0xa40853ebcfefeb0e, 0x9bffb137fd369688, 0x0d1c4cb7cbacf7c0, 0x17757f55c51b99de},
+    {0x82990a6cf6955e40, 0xbf4209ab829c035d, 0xd23458cadbc5098f, 0x032c3c5cfbb6f500},
+    {0x073f4d56c781d46d, 0x1a14f8cfe4f4b0d4, 0xaeeddee79eaa8b7b, 0x1278a98ef2c149f6},
+    {0xbfbf0da80bbde8fc, 0x4b38c3eaa8122352, 0xfe0f60bc73585b4b, 0x2046021352aea7c7},
+    {0xc9a50c33596178cd, 0xa9f5c8ae67de0a46, 0x43b7bd4b00f12ef2, 0x2f11598b263d13fd},
+    {0x2329a6247ab8bba0, 0xd85cdd3858b8a06a, 0xa837927b2fe76e87, 0x27f6bb41825e43d9},
+    {0xc124a13d71ea6bce, 0x9fed3a15c3cef1a3, 0xef9801c9ea5cb0c8, 0x2c6c72c94d1f1847},
+    {0x8db8ea8548d243dc, 0x2b19947354e8b81c, 0x0107271b49a25841, 0x0e1c5676be870bab},
+    {0x7fedf1c8bd949156, 0x7503e7edd59a8cc2, 0x1ef9bd2b7dda7bd3, 0x0b39b4c196c61cee},
+    {0xb79c5804550b4874, 0x9b35c10d51a14bfc, 0x3d9c4a804f0c2088, 0x082a08dbe8759566},
+    {0x6659b6b5f2642f31, 0x62c520c14b713a4a, 0xf84358f7a0131f51, 0x24a4a78055c2e987},
+    {0xae4920c7e5b72671, 0x693d432f827eacce, 0xc334550537fbb402, 0x005ed49a060552ef},
+    {0xd829f505475ba002, 0xb4b756ea20356273, 0xde4ceee36e781d14, 0x089e79c8f69d6a4c},
+    {0x61ac315ca71a367e, 0xed4c5fb19ec07909, 0xb2a292a2a6af72b0, 0x0d53fde875cb9bfd},
+    {0x51de589cd0f54644, 0xe4f1642baa240b24, 0xb594e3dabda4d001, 0x1efa7d9f6c1b3c37},
+    {0xb773a2d5fd56800e, 0x6fb13552c13aa13f, 0x5f2ac7f72f156666, 0x2b546d2c5c6f6c26},
+    {0xdde4fbd2de720453, 0x6a74db8a70182043, 0x113890ab98589e17, 0x0d5565ddf9dbdece},
+    {0x7fc787a20f836f10, 0x0b62b779cc63fbe2, 0x8c80e66d33317a5f, 0x1cae6d0d1bb13222},
+    {0x26db0546f8ba14c9, 0xde8c3db45f592f73, 0xf15a71f7d7bc252f, 0x290d919e3c1a37d3},
+    {0x51b776be789cf124, 0xade4db4943798922, 0x36188013d13ab160, 0x2c30c479db392ac6},
+    {0x5a46a783258dc780, 0x9365272dbd78d0d6, 0x877c6133dd232215, 0x1734b944cd3ff62e},
+    {0x211e8b3d61ec68ec, 0xc399a4dddd463d1c, 0xde992ee698a71e6d, 0x23e759d266e0ad11},
+    {0xa897a1e1fc638678, 0xf809ecea77bcc3e6, 0xa6ea9f8c6cab1394, 0x155dfc68e69095ba},
+    {0x21d480cb380ab5a0, 0xf8bd1f864e70a9f5, 0xcd77ed9d26c1ccd7, 0x2778069b051d0662},
+    {0xc864fdfc552c25c9, 0x07c98b9296c39378, 0x0803d88efd368e26, 0x23908a9c544a67e9},
+    {0xf6ce6227507ac976, 0x6fd5b2c85a39c5d5, 0x99c03eb83ae958eb, 0x2092684b32ad5bbd},
+    {0x4ea9364289830c6f, 0xdb252c878635bb13, 0x69abff2332a37517, 0x05e53c748e09d75a},
+    {0xe44bad1c60456a70, 0x35eb1a4a5e2c0961, 0x40d6fb05d5661932, 0x26e63bec16d34f0a},
+    {0xf3c538b0e1b720b7, 0x48d14babcf1ff24d, 0x5ba3586852d4b198, 0x05452d7e8a1a7385},
+    {0x40033398aa3f2d44, 0x84d92155dd1f4e28, 0x5c51a008f9a18751, 0x2acc54f5ea47cb3f},
+    {0xcda606dee9a5debf, 0xd21c6fa37c6b078b, 0xa620fff0bf2c1d1c, 0x02a5f1e55ca55ee2},
+    {0x83cc4c4f9ccb4bf6, 0x63c4f2af75aba797, 0x8dad38e3bd7e47f5, 0x218a69c8f457e34a},
+    {0xbadb6c1947688d5c, 0x9c667c0a473bb3ba, 0x4442a9a758cc4898, 0x0795f1c8532dc644},
+    {0xcc1072218cd1b5f7, 0xdcea3baf91045ed9, 0x057b494152c9574c, 0x2a64e5527fb2409d},
+    {0xa54e16978cbd2e1f, 0xc705673aa195fbbd, 0x37446aca3c24963b, 0x1a9b57c6540deb46},
+    {0x2956ccc338ae2372, 0xaa2f174a1eae2ea1, 0xade51223905a2f86, 0x184db96e5eb9b086},
+    {0xb293e7a6a741c34c, 0x3626a026088b04cf, 0x14d4fecd245d2daa, 0x23dab962f76daa46},
+    {0x44f95ac85a954464, 0xda605605850385e2, 0xfac19af4434c401a, 0x2c3997ed956262e4},
+    {0x0e387bd72acc291f, 0x97f8e70690cbbd1f, 0xf9398b1796c1b1fc, 0x27e8d2b897e3c5b8},
+    {0xa450857762932132, 0x1fb11e6ae7cbe9ed, 0x258c732ade7ace3e, 0x0f1e94a375559feb},
+    {0x6efa6ac10cd63698, 0x55b0892c3b9d022c, 0x674dc0ae09a11c7a, 0x1c49f465a770c4ce},
+    {0x2bb4224223a2a5b4, 0x8a0cdce81e4e8445, 0xeec9093125871530, 0x006896aeff6e5b9a},
+    {0x88fe6d633bf6d090, 0x0c9e5bccc61049ff, 0x47c231a70e500fae, 0x0ff8ce1fa4f24b87},
+    {0xa04b1bd3a634787d, 0x26587cc482be090a, 0x60e7b31a155b28b1, 0x28945f4f6a3a150c},
+    {0xd31b40b43d621aa3, 0x6e5c99be45fe7799, 0x398b079f0344307f, 0x2a95322256bdca6d},
+    {0x07f857d0005e5c91, 0x41b129603da89eba, 0xd1a1b25c17272d76, 0x1703d144540c6742},
+    {0xcacf7523bb17a3e2, 0xebd7c4e51008d074, 0xc33da9d734c8aa2d, 0x1147dd7703303107},
+    {0x021e60366901dc92, 0x636a89e49b3b3eac, 0x1f97cae2d17f509a, 0x2ecf0108fae1f823},
+    {0x0aac30fdc98ca15a, 0x9181f6bf0cd25c76, 0x8b80a26eda06330f, 0x045380182f09364d},
+    {0xb868570c825038f7, 0x0c2ec989148547b2, 0x092a951ad864195a, 0x2aca399ece123041},
+    {0xe023afaa95e8f960, 0xbdf267c0b89d3a57, 0x78f76c4153797a46, 0x0f22409cbd5b1283},
+    {0x236218bee3ead882, 0x01d0e10618e82751, 0x6f05a33ad573387b, 0x05fa92f20515c28c},
+    {0xc14743c6749a4315, 0x3733721da50cfa8c, 0x0f461b01817832f7, 0x0bd2c8356d87c97d},
+    {0xb00f5c18623dbebf, 0xc44edc0a9c24dabb, 0xe74e081bb7537960, 0x185011f72c3aca7d},
+    {0x4252958ce2368dfd, 0x147a462cd14feb83, 0xf258cd131aa848ce, 0x083edf6ff7887e90},
+    {0xb1b6069eef93f61c, 0x3f841caa0069f260, 0x3c4e81220d2731df, 0x2de2d416568fd5f3},
+    {0xbfcfe7abf8665e5c, 0x1f3cb8c29a97e8af, 0x38a120a0c88995cd, 0x2ddafae97cc30efb},
+    {0x66024853af9d32b8, 0xf3af7fd7630c9673, 0xcaf079f5d792d6a3, 0x0540e417538cb595},
+    {0x7fbd6dc34c985fb7, 0xb64ebaace06c3e4b, 0xf8658dbc7283aa55, 0x183e57939d1cc9ed},
+    {0x3566405dd80482d0, 0xfbbaad4169415dbc, 0x1d36d3b323b2f84a, 0x133068698cdf1dc4},
+    {0x391ba8910b26ded3, 0x64e4029151afdc24, 0xaf3f50b27d2518ba, 0x0bffb829f665556f},
+    {0x1234b9e49fe7f16f, 0xcb88c9a2c87e849d, 0x26bdfd820e4e0608, 0x2133d014298fff64},
+    {0xb12fe4b240e5ef28, 0xfea1a3ac5a43ef16, 0x468eedfd7102d01c, 0x0af9e1d4f26df18b},
+    {0x26ba85d5c3e793d4, 0xf23a1742ad95ec22, 0x18542fc7f0aaf6e1, 0x24975d7ab2d46db9},
+    {0x4aae8e40644d104d, 0xed938730315270d4, 0xbdf59e5e60f29e11, 0x000d1dba2e340539},
+    {0xa5a34356d791089e, 0x3b163c3777c44cff, 0x9ab8923dd760266c, 0x0089badbbcf9ea21},
+    {0x4db093e1338ef5ce, 0x92b65de21aee41ac, 0x97a3e29e05a468d8, 0x2721c704427808a7},
+    {0x6f5416d4d3a4a0ce, 0x83d26fb89e0b5ec6, 0x8c4ccb12f93a0c10, 0x070bf184a38692fa},
+    {0x6c216d6756344448, 0x4744747426b605c4, 0x24d3f2a8b24262f2, 0x0621eabf50a4c445},
+    {0x764e6fb6458a6dbf, 0x9745b03db8c6eec8, 0x2baa168625a3f71f, 0x2049c7d5e886c3f0},
+    {0x5904fee2a2a3f1fb, 0x60e521bfc0df2d6f, 0x4c114de199a609f2, 0x1c517956eb43eab9},
+    {0x87ce6d7c50a3c1db, 0x52ffc95d07a9bf7e, 0x4c30b8c70497433e, 0x1ed52d374d28c395},
+    {0xa9001aa33f19c5da, 0x7815a699f92c72a9, 0x7216abd05be34a99, 0x0f34eaf6528c9eb0},
+    {0x5195bd53854ed329, 0x39f6ece74b7d61dd, 0xe0ee1daa8512e54a, 0x0f402a10b3ecbf27},
+    {0x083dfd6422975f6a, 0xf100cc985e5acd75, 0x706386d03f1b0f63, 0x2527c8e147d8c6a1},
+    {0x28753bd0bfedd04d, 0x6d264335c95d8a3a, 0x9785c0ab7a772102, 0x213a13e9c8d28ba8},
+    {0x55f5fc4d5990c823, 0x075697fe8fa7b37c, 0xd397e3d784baa476, 0x28b340b3470477ba},
+    {0x8bafc3212f719cfe, 0x3b4c739f94d2df40, 0xf8691e0ec02adefb, 0x0e3a6da321fd586a},
+    {0xdcb472a71cb889ad, 0xa733f1e87e749496, 0xa3665479894f264b, 0x20e8e5558020171d},
+    {0x7cc0f234466b20fe, 0x9ba06baad69aa180, 0x0dee2329add77b22, 0x2ad5b2f17ce948c1},
+    {0x434141c4a717baaf, 0x5db965580e1c6925, 0x4cb920cfd75bfa0a, 0x23aef329d3f30645},
+    {0x43778180bf8a995f, 0x50ef38759b40249e, 0xeaa70dc501bc0594, 0x2650331ba416642c},
+    {0x7d361dee6c96fbe0, 0x740c2a9108b25f8f, 0xe6e7de559d8269f9, 0x082f9cfb15710561},
+    {0xeee87dd91e847bc6, 0xe89015848813a74e, 0xd47d91feb85c0b4b, 0x0d8f1f22f0c9d3a5},
+    {0x01f377c97a5eb975, 0x6d8bd617cd9777ec, 0x6ea2dc81cfd2b28d, 0x16768b787df5f60f},
+    {0x83db8463b7f5f411, 0x6ca4051f195d4ef8, 0x8d45d39d1567b9a2, 0x006471a81a9427a6},
+    {0xe43ec27dafd2fc25, 0xc7d1b0af6db56c1b, 0x1494aa37fdea9094, 0x00f5d3765d424d1a},
+    {0xa6c0465e5632f655, 0xdc8d2af82bc80858, 0x20dea8761b2d43b8, 0x07dcb0b32643d5f4},
+    {0x895c6a5b576348b6, 0x9b60b8f3d81cb6c8, 0xcd3c9c91bf887bfe, 0x179fc81f620d5025},
+    {0x6640b5feecfe3cef, 0x6a7de9abd371bd9a, 0xaa22d24583e91904, 0x19be1dfffb3da654},
+    {0x2ab077ed3d781ff3, 0x9842a07236cdf30e, 0xd9cb998fdc02b382, 0x13e829a4408da005},
+    {0xc8f05664a497d1ce, 0xdbae26a3a3dbde68, 0x0ad8b9c2af789b60, 0x2092e35b2b415b40},
+    {0x9d542ec62ab856dc, 0x2f89fc99e24c9ada, 0x67aa7b78d42dd77b, 0x01d217da5b3d9324},
+    {0x48db68811637d675, 0x1b402d531b2e2a4b, 0x804f6c7ecab77efe, 0x0cfc1ae49f00f019},
+    {0xcc0262a9569e984f, 0xc71664da0aca577b, 0x0553a089697be86b, 0x11d1d01dc8b8646d},
+    {0xd2157300d58723dd, 0xfaf7a4d93372c2be, 0x27581fec3dbd5949, 0x233a3789ab3ab099},
+    {0x166ff248e098b7c2, 0x4a4ce41b90d4cb57, 0xecfaf67bfda98211, 0x01bd0d0bb500a0ae},
+    {0xa9b53561dc0329eb, 0xf5fe0e708f78b783, 0x8233daba195fca47, 0x1d77b2163bc80604},
+    {0x533c10c81301284d, 0xd227543179568304, 0x9e36eb91c07b4423, 0x122cfde3ec143151},
+    {0x6dba1ac95b3ef65d, 0x0cde46e2c08c9c68, 0x09dfa74fa637036e, 0x1181d7acfcdb78f2},
+    {0xf73a9e99802f2990, 0x9b68671c7e42fbe5, 0x288790fbb4d1f366, 0x053cfbc6ee8a8284},
+    {0xba303401949cd130, 0x7fe050ce490a361e, 0xfb61b8e221a6b1a5, 0x1e7a9969f620da71},
+    {0xf5f8e34573605cce, 0xe0c224725bedf8cb, 0xee74ba5ef961a5c6, 0x0c3a7dccc610adce},
+    {0x24ab7369b1fba32f, 0x1fcb3157fd16b90e, 0x18fabdc5be921a16, 0x04fe46458ec66839},
+    {0xa66cffa65f930edc, 0xf8cb8797a1922f11, 0x097a6c82d450c9ab, 0x2744ca391b50b7c3},
+    {0x670b3ea029749e4b, 0x28b00e67362548a2, 0x60ed886ffeee29c9, 0x024fcdcb760f47d3},
+    {0x8ee98f2b3c36362f, 0xc05c8f34711b255c, 0xae87d7723dc8c32c, 0x18b40f9a50053127},
+    {0x5a51852437d76f0c, 0xe94c7799300e4149, 0xfaff35a0a5be199c, 0x02a7bb13a5678114},
+    {0xb1bc12826e1327f0, 0x797d70133a9e586b, 0x0231b8977819ada0, 0x01c7eddf798a42e2},
+    {0x8876fe76eac5f9ba, 0xf5d9b4fe1b841728, 0xd900f441173bcba3, 0x0a3d0348cf9ed271},
+    {0xaf49e7372f86bda6, 0xf0d93f4cd51485d4, 0xed0b13dcccf14f5f, 0x2cc3a258f2836ff2},
+    {0x76ba1b84a844521a, 0x536e7d8e24860896, 0x46f2e81451f8fdaf, 0x0846c831eda8fa18},
+    {0x6ac54ba654486b9b, 0xfd472aba6b9dbd1b, 0x9c384097791b4b1e, 0x26a8d0e9bb86259d},
+    {0x0ea91e1a8d0b5b1b, 0xeb87aefef9aee62c, 0x6896799ce1e8082d, 0x10f1abd4f68d71c3},
+    {0x12670a3e2dbbbb9e, 0xf70f0b7e47b3778e, 0x6e4527b8b972fd95, 0x0c8e69d9f2b4f1da},
+    {0xe3776bfb992b02c1, 0x02763d0a1517e853, 0x81f35908e775f057, 0x28103625887b7083},
+    {0x344dfdd807f53e66, 0x3884ad93f99a0dbd, 0x96d5cc8da53aa3b8, 0x0c3e6b57dd21d465},
+    {0xdcf10983d520a9b5, 0xe2ca4586b517ebba, 0x02ee3b189844e4ab, 0x13bac33574c1a549},
+    {0xf0fdf577f54d7641, 0x6dce46b998ff7cbb, 0x91b5ed74a1b5a932, 0x0a873ec72bcd74b3},
+    {0x65f2c2f3c2271c5b, 0xcdcd4540af74e1be, 0xae799a2f0efc76b9, 0x23f40aaa69d2958e},
+    {0xac370e2d1d1da315, 0xaf76369560d49c54, 0xbc7c39b90b0103fe, 0x12c2bb5def7f8ffa},
+    {0xdd06085f263c62d7, 0x6f04c543f0669cc2, 0x74b8c063e66a3667, 0x0d3f26f696d0d9cd},
+    {0xe6927de0ab3d8386, 0xe0035d11b6208eca, 0xc9ba81e644d72ac7, 0x1d0d64ea14c8626b},
+    {0x068ff353c18f20c2, 0xc760b8916e3178dc, 0x576c68a34bb5c801, 0x250c40006f5aa86b},
+    {0x9a877bd527a84cd5, 0x52b2c27834d8cf1a, 0xe0883dd210e54ffc, 0x2f6ccc6c61985000},
+    {0x90f9c7137417dd63, 0x1baa10b1c8016a97, 0x5a68756012162649, 0x0a3d6db96b7517b7},
+    {0x6e723aee2e5dee20, 0x4c5a55cbc9d8b60e, 0x8299ef18f1f818c5, 0x19027391e3d1d150},
+    {0xd64aa676b40675be, 0x2c5766a12a58f4ce, 0xe62934c9d7ade057, 0x062f928b2b05310d},
+    {0xcf7bb0185ab6c727, 0x98ce71d0d09fec3b, 0x30e575f8cec20f34, 0x07efdd90321ac930},
+    {0x8d891cfdc79560eb, 0x9bb723cb9ba63bb3, 0x8374a769931067ce, 0x04add9be970834a2},
+    {0x2f4b9fe259a4c5e9, 0x05ca1c5fc055d9ba, 0xaafb1d33edfd6584, 0x10b7f7a77d520b6f},
+    {0x5b9c4278c4332ec4, 0xddb08f35ca767bd7, 0xd27a7d3ae3dc610e, 0x18e1326114f24d5b},
+    {0xcf6a07a75b82adab, 0x186b1a0a29cb8b0d, 0x40a639bfefe151ea, 0x1b8b7bd5a11b286b},
+    {0x359fa5d397ea90b8, 0x30ec7b99dc919255, 0x38ff9cc1b8745e05, 0x0b6c949639e94522},
+    {0xc37d7b855325975d, 0xcf29d1f762928ac3, 0x1f455e2b97c7ebef, 0x2fbba2b9bc4e9bbc},
+    {0x761812eeebb6f68d, 0x719f04a83416b6b0, 0x160dcef61602ea72, 0x0e7231a78602f4d7},
+    {0x5d968f7a37d1cd19, 0xe2e2ae6bdef31d3e, 0xb395914529f99bc8, 0x260a6724dffa7f6c},
+    {0x7940515866039b10, 0x2e9018c3680cbe55, 0x198af225fd3a1182, 0x1d1724ad17f032cf},
+    {0x296dc9547ab1bf54, 0x01c2859d7c733f39, 0x174006d21e03f968, 0x26847ffe37467739},
+    {0x507acc1c6a1d94a6, 0xf609e6e98849b77c, 0x01f2f7002002f67a, 0x2d1158d603e44c13},
+    {0x397cb18143e6003f, 0x8649491c508d26d6, 0xd574a51ffab68efd, 0x0fe10d3f8c9c7980},
+    {0xec06057bf820bf8a, 0x30699df36d4c936c, 0x858392e3c9b096fc, 0x27fb1a287bfbb299},
+    {0x51e81bf3c2d49494, 0xf8ac341d93808fcf, 0x015a4b111d4c10dd, 0x05311fc5d23a9e31},
+    {0x3064a6088bb570c5, 0xb80d79b2269a4bc1, 0x5f9ffdf9af1edd42, 0x1292beb229bcf8bd},
+    {0xcc69c3eb034f9dfb, 0xc0b93ddbbea46228, 0x870135e97842634e, 0x21b5da8ce6bd7463},
+    {0x3ae9d76b7f950cab, 0x9e49ddc3c717cdad, 0xac6f609ec9b59539, 0x27eaebafc3f90dcc},
+    {0x89b01c755fe9b792, 0xc1371e1895f761c2, 0xbe53e13bd4c87729, 0x25f6573314a043cf},
+    {0x00b18cd06815b7fb, 0x1bff43e0cccfe088, 0x1677731d300e55a9, 0x2296f02d3327d36e},
+    {0x64643d9f32675caa, 0x0bb500fad32888ea, 0x6449c30615287ab9, 0x0f455e07636b4578},
+    {0x0834bacb432cdd50, 0x6e445faf158e5656, 0x049b0359a4abfbb4, 0x01477b28ddd5e3b1},
+    {0x9ac34068eca816fe, 0xe341bcd6dd43f844, 0xbafa8f047b2a7314, 0x1312466336413c10},
+    {0xe6d2b1394a7903a4, 0xd58ac3ab8973e076, 0x591a26d1ca3b1515, 0x12c0bebada5be15a},
+    {0xe722291e63474480, 0xc31d2b11d1cfa492, 0xfae280a5263102a1, 0x28f8bb099d15e0fb},
+    {0xf8fccf74c10be69a, 0x68587246e778ecbd, 0xaea374d4e4d2b233, 0x22cf2095aa0a2be8},
+    {0x8d33b801bd30523a, 0x4a369ab81cefe410, 0x1f35e9bff2503f62, 0x1c44cae1811fc055},
+    {0xb41343bb861885ff, 0x9b251f2aea0cc2a7, 0x636d066b3a84cc43, 0x05075d35356d60b5},
+    {0xfff147f60560da50, 0x65fc586d0a2ddfd8, 0x7ddbc0831532c912, 0x0ca097957535605c},
+    {0x2514736808b2f1ef, 0x8a051e736b6ecb48, 0xdf7a2febca4bca45, 0x2fd3856d538b0e48},
+    {0x910e6a46421fefef, 0x6cd8b68e036f9a0f, 0x895dc267c0af55e1, 0x26eabb7418e9d0b1},
+    {0xfbd294a8e974f56d, 0x14a7361a3e99cf03, 0xa5261b06438a8320, 0x182847d1f344bbb8},
+    {0x0b3da49a6afec744, 0xb3f74690a6e27a8a, 0x1570577ec87bdf3c, 0x22ad14bdb174ede0},
+    {0x5d2e35ca9f26f295, 0xb15a1248c22a56d9, 0x268c9bc57c12e829, 0x0c70513dfda9348b},
+    {0x0ca26f3a0482c28d, 0x9977cb82f5339ea3, 0xc0b32c4d5b68325c, 0x188ccd3bd5883255},
+    {0x08d5369d890ee7b8, 0x62d9237bf26218c2, 0x02d56c2ffe353f8b, 0x14554b4297d9e87e},
+    {0x9d0e452bc0dfff52, 0x27b368169a80c627, 0x6eaa6f4629f22299, 0x1efd5e02bb9c74ce},
+    {0xa32f4579adf725de, 0x5fc857f28b158d5b, 0x57509565e012561d, 0x011acc94a3114f53},
+    {0xd8104f7d65da57b6, 0x7e5ffb64649cc5ee, 0x0acc6119d36a336b, 0x210057888f5d617d},
+    {0xb7dfea9cc1c399d6, 0xd5c392506592dbd3, 0xc22e313a5d3367f7, 0x23420b1af7b54203},
+    {0xf8a048795c31c03b, 0xffdf378c054a63fb, 0xd557e70e00f06698, 0x11243ec411df9995},
+    {0x97b7ff7c590bb075, 0xe4c9e57202ea04c4, 0x4901282212544a43, 0x2c87e0b99f40dc10},
+    {0x7eeb5c1db47a329f, 0xf22911dde9501f31, 0x55c65d4264d1a28a, 0x18c8432d5e824ae5},
+    {0x19e054fb4aacb2a7, 0x7b7b2926656faf6f, 0xf938092db05d5c2f, 0x1fc8ebbc94d57483},
+    {0x489d3b0892e96238, 0x1e85fd9c38bd35ac, 0xbac5d0a0207716e8, 0x02ca8f7a237a094d},
+    {0xbbf85743bfd3babf, 0x890e4004babb9e6c, 0x2e705989c5c769ee, 0x27781625504d604e},
+    {0x05e485a767e58ea1, 0xfe88246ee63aa2ed, 0x84ff3e273f6f6f67, 0x21e7e3ddf1c30fe2},
+    {0x31763cf76d59654b, 0xf8d523c7fd685382, 0xbbf7b2ada3fa3320, 0x27b66126758e10eb},
+    {0xcdb893a9412bdee6, 0x6cfeefcea8090441, 0x60e223d8c06a4b33, 0x0b8cd778fdb7ba34},
+    {0x87f063cd1f348863, 0x218aec8599cdccd8, 0x5c9161587b1921e8, 0x007e22d262418dc7},
+    {0x731a5967268c0f13, 0x78035517d0503e68, 0x73541d0bbe1dbf07, 0x2de850709935d3ea},
+    {0x79c4dad119d37919, 0x0a9d40b4676bf451, 0xc0c2d4233115b8d8, 0x113a62f4c1c353ba},
+    {0x42a0ac5c6c591aa3, 0x1360c9fe53a9ec60, 0x748f5ca8d1a91b54, 0x1a3f53f63ff67590},
+    {0xbf39458521715b10, 0xbb793da906f3844d, 0xc035402255fc2031, 0x023baa223a7ca3ea},
+    {0xcbc89b726005b104, 0x4797824a8098f1d4, 0xab60de63ccf5a000, 0x0e7040fa819813c0},
+    {0xc6dc48db89778d5f, 0xd3cf539f761f26d8, 0xa639782874defdee, 0x22f2b51e1689048f},
+    {0x7edeed8d7bda2fe3, 0x01ce0977e0b03f45, 0xbb05bdfa5e1eebd8, 0x07f7e9f0a4d1774a},
+    {0x58d76e99fc178ad8, 0xaeac814c410f5432, 0x3254ae30a0c25ae9, 0x14142f77a6a25f63},
+    {0x2cc8cbc30c95ba6d, 0x540cf067bb6b56cc, 0x23f3f9f0a187b1eb, 0x2ba2a5b952181557},
+    {0xe60db127ae5e2351, 0xa1f95ef2d43b841f, 0x3e4a6165cf21d4e5, 0x088ed0cfaebd3cf0},
+    {0xcfcc02622da1b566, 0xdd420e7d33f2f36f, 0xd0fdffcd6b17e3d4, 0x0757dca674e39549},
+    {0xb1a6943ac5268a1a, 0x0274162c36492937, 0x9edf502c073eadd1, 0x01a8f0d3eee4a135},
+    {0xf2bcea91566341f5, 0x3acbf4b18432b6ea, 0x8d80243f79be4528, 0x2e9c30278fd505a3},
+    {0xc79d1fcae2fcc593, 0xd278b57a99118885, 0xacaf7978f3375b57, 0x08c73b0a60607290},
+    {0xf5ee42ac2e0b37ff, 0xb351d9343a0f3113, 0xab72873c13134189, 0x2284820f5fb8366d},
+    {0x28cc084494297a4b, 0x56efd17ff21c7c2e, 0x57a4ee5f00400468, 0x07cc6bdc88bf2afb},
+    {0xb4c5e4403497d44a, 0x96bd4c08aed41783, 0x7087f1f1b9fd7402, 0x03fec04d193947f0},
+    {0x0cc6be5a16bc283d, 0x9c8ecb3f6a8ae1ed, 0x7c203610d0fe69c3, 0x1007c99a73bee914},
+    {0x3eb5cb980c1f4f1b, 0xe90dc795df972ab2, 0xa14a9dd36d784a99, 0x2de452635b87d6af},
+    {0xd411123bd4e7f031, 0xf9892cfec0c661d2, 0x1209941eef307ebf, 0x1f8c54960c97f6a9},
+    {0xac569bda9678a698, 0xb5796f17f3199fe6, 0x4eeda1e7e89762d3, 0x0f454ec32ef43f53},
+    {0x91c75619b2ec4ade, 0xa59a714bcd40317e, 0xdbd1e57310e04ce4, 0x06a1789beff75b5d},
+    {0x93523db2b4b8a5c2, 0x84e3262e20c889b2, 0x7e8af4edbe0b4c4e, 0x03e6518ae4d0d851},
+    {0xdbff1139e825d7a7, 0x6ddc89e319e8702d, 0xe937dd44bb73ab1f, 0x13a1bfb05c9c5589},
+    {0x41874765f710144e, 0xdefb4a16eff6f3f2, 0x93d8ef3c2fcc4136, 0x299ea868b078275b},
+    {0x52b52eb5220f4031, 0x87b7cd4b1abf131f, 0xeadb62d973051c1b, 0x0029fd1a1de7b6b9},
+    {0x08822c34e68c752c, 0xea8f1debe4b1e541, 0xb419ec840298eef0, 0x1e170e1238c6b7a0},
+    {0x78940176f57ae45e, 0xcc41fcdc65af47ef, 0x1b3765a0dbae4071, 0x211047a4e7c68b86},
+    {0xb68308f39f717614, 0xdb4a1cda66308e25, 0xf66c131bd9f6b475, 0x2a5bedf2372f1b6e},
+    {0x639c9ba7de9d8708, 0x8c8ec868efefd68d, 0x393a898a01d9e8ad, 0x063e9f9751d95768},
+    {0xc7ab6a7f39d4f193, 0x40be09b1a83794f1, 0x3cdf12575a38496a, 0x29d4e54dbe54ef1e},
+    {0xe7e1d02576c020cb, 0xdb3620b6d16717c5, 0xf599b903b03d0086, 0x14521d1e87a0728b},
+    {0xeade4723d83fd064, 0xf5d99d8ffbad9668, 0x22f57eed4530998d, 0x273ae0bae9e197fb},
+    {0x295f35b19f941ef0, 0x62bd6b0db4d5406e, 0x774e393f0a1fa74a, 0x1d86d5dab28e51d7},
+    {0xacdf68d961358afa, 0x242798875d32345b, 0xded7feaf85887d9c, 0x2a71998bb8ac0baa},
+    {0x2f2e06bb9cbd4708, 0x7b5712030b6cd166, 0x097537c97b5065e7, 0x0cb28dd65b8fa6ff},
+    {0x301e72e1b37297c6, 0x318bd86123a57a05, 0x14f74c2b0cb945db, 0x250632e79683ab20},
+    {0x22885327578a235f, 0x6bac5f6ef0606373, 0xdfb38390500716b7, 0x0e3266d675f6dfec},
+    {0x8ae5c686d44727c0, 0x6558a0ade224400c, 0xa6a566ec3e3328fa, 0x2e2d91daa25eb071},
+    {0x34efe1387f469c09, 0xb4da396e4c3a783c, 0xa34fed66301bc271, 0x0a1672ae74f6abd1},
+    {0x16d991b0a15fde09, 0x082c9e34e0739a8e, 0xcfb5709a1d6444ba, 0x0210b70869e3348e},
+    {0x78372cf5dafdbc6e, 0xceeb972b4a7ea19e, 0x88bfa25e844d011c, 0x150a5dc91f14b357},
+    {0x9201edbf644230cb, 0xbcb64bc6e5cbf62e, 0xc0a3b04f3b2c2b8a, 0x0782107cc5623d78},
+    {0x689c2e563f9b9708, 0xc6d03225480618ac, 0x65c545907673769d, 0x2b3e1b9e9f0e86ce},
+    {0x8ff09c3d622ee484, 0x6d3d99362508bb62, 0x5422502871bab0c7, 0x18644461bc63a064},
+    {0x86acb62ab8d98da4, 0xdeb5cb19ed141df0, 0x30cc67297913647f, 0x259616c84d6abbc9},
+    {0xd53e540b570a953e, 0x4bba9e3d69c281b1, 0x0f9dc927cf756b2d, 0x0baa1abe81bffb73},
+    {0x45f81f91730393dd, 0x1c25fae14e6c98d3, 0xe0bc849285e07134, 0x07b813595839aaff},
+    {0x6926d35ad64d13c0, 0xfa446f2b4009b190, 0xc9b276f68c14c49e, 0x2e768a82cfcd763d},
+    {0xb9598debe119e474, 0x92f3add30618fd2d, 0x8aeb5024106e87e2, 0x0fb453203c71c13e},
+    {0xe8494c835acb967e, 0x52075eada1dc0a82, 0xdb4a2454faa808d3, 0x0f14cb7d4db3202c},
+    {0xf0d830bdb8fb05a9, 0xbf7fee7560b95d72, 0x6a6acf03d642488d, 0x1a6ee14a159f441d},
+    {0xc18a04bc54bf0ce4, 0x84f68c193bb06054, 0x39128543811702f5, 0x0c1075295027a61b},
+    {0xf254132e3b155fb9, 0x7eaeb7734f83c406, 0xe18512ea4851aa1d, 0x2d2e0d82b833f576},
+    {0xda7d4f903cf353a6, 0xad399eb09b17cc11, 0x0b5180f449597757, 0x1cdbf1878557918d},
+    {0xbe4c4fc71f36db31, 0xdbc7bdc3b5805d0b, 0xfaeebba1c7321a20, 0x0869386836f43c18},
+    {0x2b1b4ccb96b6dfb1, 0xebb77d3f3ecb4131, 0xc977ff4074f1fb61, 0x0852be4dd7d3c534},
+    {0x484ee68c391458de, 0x3e4e5efbc18987b8, 0xee0f913c29d49f70, 0x234c13e3368a82a4},
+    {0x62d57b32b15b6c53, 0x9e2f00226052d70f, 0x063167c95155c409, 0x11c9c4cf31a4a0bb},
+    {0x6b6fe73d0d3fe372, 0x3720a334d697a731, 0xc386108b2a977c8a, 0x270fa6b43da72fb8},
+    {0x0bf2e3689475feae, 0xe46192065d766468, 0x97563cb28b8c5e38, 0x25d40e5b6d77720b},
+    {0xe647f5638b0007a5, 0x656ed215fad279a1, 0x7209bb8fb84128af, 0x0520d7bf2463f0d2},
+};
+
+alignas(64) inline constexpr std::array<uint64_t, 5> MIMC_ROUND_IFMA[MIMC_CONSTANTS_N] = {
+    {0x54b8867766cf4, 0x5b3e3321b0802, 0x74ae4cd1b541d, 0x0df4f4aa3362f, 0x023f7ab39319f},
+    {0x3e9336fd1dcf8, 0x57753e50b1763, 0xc98ac2f57fc32, 0x6b9c4e586963e, 0x0061d37e40484},
+    {0xca71ac89b181a, 0xd87d46c420958, 0x580332e0dece7, 0xb302e963243c4, 0x007ac58343101},
+    {0xfd1bc312a303b, 0xa9b06bc91d32d, 0x3f42b6f6f1868, 0x0742e5cfaaffa, 0x0061dd3a265f5},
+    {0x32ff2604b82b6, 0x97c9257899431, 0x845e29f44f0a9, 0x399f15ae1afbd, 0x005a0a2f306d2},
+    {0x63a564ef2d5be, 0x466c837130065, 0xfc9d7e29214e6, 0x4615dc9c01a99, 0x013a9cf31472d},
+    {0xfa66fb85e1d20, 0x32333e331b56f, 0xf6ed50ba47e3f, 0x6cef69e6b9cbc, 0x0120e1a0b15e3},
+    {0x89c317aabdc58, 0xe12e02e1555d6, 0x4ad894fdf870e, 0x5bf8cea82f562, 0x0228b5bd167df},
+    {0xbfa6a2aaed0db, 0x8b53d4d4777cc, 0x2301b461f92fe, 0x5812e278725db, 0x016d868515e03},
+    {0xa5ceb9fb2aae0, 0x306b8b35311c6, 0x6c3cdd533e823, 0x401954269021e, 0x025f12c99a0bc},
+    {0x7b7f281df3cc0, 0xb5781a7d56627, 0xb336f75b4d0f1, 0xf18dd6657e333, 0x002502deeea54},
+    {0xf68557d1942a1, 0x647b0a17c9807, 0x0550725d486fb, 0xcae7ee84186f4, 0x02e13fa5ffcf3},
+    {0x1bf1793ac92f1, 0x9dca297ab066f, 0x9c50d291c809f, 0x3b78a255086cd, 0x00972c38d51c2},
+    {0x8b510e0558d28, 0x24ef3403f9010, 0xe3e9e7a473072, 0x792248536582b, 0x00c513ceebdf6},
+    {0x8df462fd3a32a, 0xb32fca1e33b90, 0xffa1a76a4e0c8, 0x1c1799d5bc177, 0x01c041c9317e6},
+    {0x6d38f39cef01e, 0xee6012ff69a78, 0x96221df898086, 0xa9ccb7af1dff5, 0x01c08db50e5aa},
+    {0xbeee55602b9b6, 0xb6d8b2c427d4b, 0x5eb52b06a2603, 0x9f52ea92f2463, 0x002f74a2eab3e},
+    {0x674b86447b0ce, 0xb9a3e2ca987a3, 0xe1c9db9004f7e, 0x8e3386f622a08, 0x012e4a8f262b0},
+    {0xacbd7e59296de, 0xc499cba2cf2c0, 0x7590be2e81ded, 0xf7af482768842, 0x0117bda44b233},
+    {0xa8fe9e50746b4, 0x74fc35d9dfaef, 0xe0eba47a1e3f6, 0xf5437a4b2d4e9, 0x010f56f3f9eac},
+    {0x32949100aa203, 0x696727228289c, 0x301e809eb9516, 0xe39d26320f4a0, 0x0274ac1a324dd},
+    {0x31af2bfdefc93, 0xc2a27b1b1f6ec, 0x4104e9c0000c8, 0x9e89ab67bbe2e, 0x00dfa6737ca11},
+    {0x75a2a9c3dd087, 0x49e85300c50f2, 0xc12007a21d57b, 0xedc91f3c73695, 0x015ce667ea660},
+    {0x91f7f00fa495a, 0x60628efb19b12, 0x21f60fc4e2eef, 0x4a23c308b0de3, 0x01fc81e3bf419},
+    {0xce45ed66724cb, 0x568f7c0bf53b5, 0x1b6faa505b087, 0x4f8c3750378ad, 0x007dc27175d9e},
+    {0xce4e6052b94b0, 0x27ef36583be55, 0x50e0b24f80158, 0x7d0f464791183, 0x00db5c492ba6a},
+    {0xa70abc37872c0, 0x4e8a0b2032d7a, 0xfb32188b0d56c, 0xd063f36c69e8a, 0x01a470e6d28b3},
+    {0x232898989aa76, 0x726b8811ff3f2, 0x008a4df5dc582, 0x1cf1116195ba0, 0x022eb454a2690},
+    {0x8b243ab9f7a2f, 0x67a3c17b0886e, 0x6650bde35de75, 0x7a8b577cc4ca3, 0x020c5cec1ae0a},
+    {0x18c9d440f0c11, 0x52d2894ea3303, 0x74276d0dbb5b3, 0x6ed6d55e551cb, 0x0186bab1ab423},
+    {0x79f5b2223fd3c, 0x29be2b0aa1783, 0x906ad6be463fd, 0xa94748d8be64f, 0x002a5529a04f2},
+    {0x93f0d32332de8, 0x2579cafea1953, 0xd9244e2fc5575, 0xc9234b2dede02, 0x0006b74f54623},
+    {0x1ff248115d608, 0x2d716f6e5036d, 0x26f88962a1d74, 0xff89baf66cdf5, 0x00038e30695eb},
+    {0x21227ddbf7c48, 0x7bf6094fa5e75, 0xd3bc6422f62f8, 0x94bb505714627, 0x00a32f6812308},
+    {0x0b5794abfb737, 0xe2db9dd9ec031, 0x8d79a7196476b, 0x258e5810e76e0, 0x02dc75b23920b},
+    {0x798255f5e5b0a, 0xd513c06a19e0d, 0xe70f7c5f22af8, 0xd34b2884421ee, 0x015908e3500d7},
+    {0x4cb8a43ce9390, 0xa38295271b9db, 0x01dbcd205262f, 0x52df349c2a911, 0x022174038e5fc},
+    {0xa9685a3320e04, 0x65ee599a60af7, 0x6e6441f84e899, 0x650684ed7bdfc, 0x01c522ccc9221},
+    {0xa4ac00de934fd, 0x0f68207645f15, 0x0dd52c1da56ab, 0x34723a1809177, 0x01442e0521e46},
+    {0x01a38f0e5f63c, 0xa0efe294636cf, 0xab61cf4bc3c8b, 0x508da45f704c2, 0x015fc518b2e89},
+    {0x34cf795995dba, 0x318806d5f1b6a, 0x28914a496ba70, 0x3b5538f85cbcd, 0x010d7b0e4e6db},
+    {0x4aa1c2e7bfb94, 0xc7eb52eca2d39, 0x39212aca3de5d, 0x059cafc3deb30, 0x03034d3181c60},
+    {0x2f94b187c43e5, 0x6207a7d9caa90, 0x1af8e60a58a26, 0x89f2e8db60496, 0x006229d1e7bb1},
+    {0xece5b398a2e36, 0xcf33d9f6bbf90, 0xf7db5de7a6fe2, 0x744bbd796254e, 0x0256ac5417fdd},
+    {0xdc486d8211523, 0x41186065eeb1c, 0x8a20c397cc21c, 0xc4830587dc1f9, 0x01f0f3f9add5c},
+    {0xc5566ef887ee0, 0xd0de0423738c4, 0x0a092d73a9e61, 0x8ab66ed903fd2, 0x00a904fc0d715},
+    {0xb1491546a9b43, 0x3983bc0fc7dff, 0x2c75e3a4f9aaf, 0xdbd09524d07b9, 0x0044e5b1c1ff9},
+    {0x534bb99aed86a, 0xd075381f6e597, 0x4630abaee5034, 0x1ec7f2adb8d53, 0x02bcc3036cf96},
+    {0x2ff267fd1b614, 0x06a9a121c2cdc, 0x1bc648214f74f, 0x030c070534d9d, 0x019ad1399e6f6},
+    {0xd9937fd428d38, 0x5f2f4be947484, 0x633cadfc266a3, 0x858009b1b5a11, 0x029e71f8532fa},
+    {0xad84e0b28b8f5, 0xd677e7124ed1c, 0xdfb08336f03f7, 0x936e9b22a100b, 0x00eeaaeb97e8a},
+    {0x9fc98948809c3, 0x0ebf26f7c4829, 0x74c69784f77c2, 0x44beeb1e16427, 0x00ec519a5e199},
+    {0xd9ef919aef959, 0x12b060ffb12f6, 0x04254a4152a77, 0x6f04fc0d65f9f, 0x01a8331746906},
+    {0x7cda4117a536b, 0x4e2c697ffd39d, 0xf19d0b9bd0b8d, 0xe3a2c616b8243, 0x02b68b574c395},
+    {0x4db007dc05363, 0x893a541f4c202, 0x6948b2fddfb78, 0x8d52c702e6153, 0x02d58fda40998},
+    {0xa1c2e6bbdf247, 0xd5032b1175cd8, 0x1ed89427619b6, 0xa3c7ad73637b7, 0x009d5c1f3d735},
+    {0x5be4386f89831, 0x05452c49f1c9e, 0xdb5f539095f98, 0x57a8ec6078a4c, 0x00cb14f19fc0b},
+    {0xc7a5885351adc, 0xf25a2c714ee9b, 0x749883ee438af, 0xc6466269c7eb1, 0x02d8b4939a568},
+    {0xe8d103d7fa9ac, 0x1ab332b831a61, 0xa1efb2e9e41c5, 0x2fd25630e26d7, 0x02425b6751f8e},
+    {0x794185fa37a3d, 0x0006c3520f641, 0x536edbabee823, 0xf0d2ec7b2362f, 0x0117b4569d94d},
+    {0x7ed33a039e974, 0xf1ee7e105c891, 0x0acc9e67f4b11, 0x4bdfb31c8cbbd, 0x009e2d050823e},
+    {0x03c144cadebdd, 0xf36366e42ae9b, 0x65305f579fa70, 0x4459851238bae, 0x0051ff36bd4e8},
+    {0x2c229e77c69dd, 0x195e530e11cdb, 0x44c573f68b965, 0xc11f8d87ba9d5, 0x007fb5cee0ca1},
+    {0x7a13a33fa59a5, 0xae53723745ab8, 0x5a9e0a6d48268, 0xd094ee8200d38, 0x02555c3bbdf72},
+    {0xe66cf640a91f0, 0xda93a2e58fad4, 0xebb8e8e9d0929, 0xa1287586489f6, 0x01e081048ae75},
+    {0xd826dc61d574e, 0x5b27098796144, 0x1ae9714827fe7, 0xe618aa188123e, 0x02198695f919f},
+    {0x3d9a2592a558f, 0xcac43116a3126, 0x07a667e1d95dd, 0x1ba0c2f688cb4, 0x022ae361dac26},
+    {0xe466880e17977, 0x09a85d20722ff, 0x562d12d38b1ba, 0x6dbcaf5a43035, 0x00fe48c1a2735},
+    {0xdef811020f7d4, 0xf9fb9d1fa7f9c, 0x2e317d22d4834, 0x7caee47358e3b, 0x0001adb5b5f50},
+    {0x506d1d716ea26, 0x921a20bbd8587, 0xc2a4fee254961, 0xf8fe829e34d49, 0x0188e34e67512},
+    {0xc51069feb585c, 0xf1bfc41696c53, 0xcd0d041c59ebf, 0x3b54ef84779e8, 0x02b480fd8bd4c},
+    {0xefa5a855e0e9c, 0xedba2c2c47704, 0xfa74a8ed7b7be, 0x672943691303e, 0x01eaaf282bc1b},
+    {0x14d499953b24a, 0x1391631184563, 0x6470b8340d873, 0xfef69ad537eb8, 0x01e7f48252ebf},
+    {0xcf9f79aa767df, 0xaaf83bd74ec4a, 0x3bf0d15f854ff, 0xbd9531f8186f0, 0x0286bebb25663},
+    {0x508ecf94bcfbe, 0x0b1371d6350e8, 0x150ce77b64027, 0xb1b81b7c2c49d, 0x00e5ba1b4d819},
+    {0xc496c8eba074e, 0x25a67897000ad, 0x60a88ff0a0b1a, 0x2dfaff6af09ea, 0x0008350e72aec},
+    {0xda7adf28e65ff, 0x87af99e83d580, 0x810a3f22ac6a7, 0x561b989c1a49c, 0x020931fda7cf7},
+    {0x58b07a9962b10, 0x5d22948fccada, 0x7682db6acbae8, 0x98dfd8a46954c, 0x01b5e06c2bbe0},
+    {0x8862330a52aec, 0xc60f64c7f177c, 0xfeabf995e7577, 0x954390000a2cf, 0x00c584a351a71},
+    {0x9a7e0847129e2, 0x6fcebdd42e21c, 0x7aac68001af03, 0xca93da24f01f8, 0x0212ffc20198a},
+    {0xc20c5caeea827, 0xfd07e1cd4866e, 0x855cd4a6c28ee, 0xf3780a0469586, 0x018a16fc19908},
+    {0x08d53f385caf8, 0x05db422229954, 0x685facf8c23ea, 0x5a93bf65d9d42, 0x00a5dbb77d670},
+    {0x8552ae326b3b6, 0x76a8eb1a7e610, 0x1228dda8c6408, 0x39d873e70b0bd, 0x00a3c30b6243f},
+    {0x57b45a10dc8f2, 0xb70374bd111c3, 0xf59924795b1df, 0x16c52e56dd6ae, 0x01e8b37a6e027},
+    {0x4a4d4b8f2f641, 0x3a827b113c469, 0x13dadde6c33ca, 0x8d5c5580952d4, 0x002bf92a7bd56},
+    {0xbe058c35ca0d9, 0x322339ed54cbe, 0x79c65ad1541a5, 0xb0b59c56ae72e, 0x0249d9dc918f0},
+    {0x7485571531bde, 0x0a1fe241b7646, 0xa59abec004b61, 0x15e6dc8c49c5d, 0x0125b6488dc46},
+    {0x155ee5f41de00, 0xf0dfbb1f986b7, 0xe4cab4f7c3ce1, 0x165992853423d, 0x008efe1677db7},
+    {0xaaa7f3bee373d, 0xb3d6741623187, 0xc17f3926ee5e0, 0x85160854b656a, 0x019a594d33d63},
+    {0x035359a074631, 0x12ee882a572fe, 0xc7621c3c8e894, 0x7eaa977e83ea5, 0x011d750eed285},
+    {0x5dbd6f7142520, 0x177f5308dbf06, 0x97174fe981eac, 0x808138a08d782, 0x00fd0b70a0140},
+    {0x05fd9acab9876, 0x2bd4e4318b108, 0x59df81c877b56, 0x5eea99e5dd332, 0x017180b4c22a8},
+    {0x300518f0aa3be, 0xfbfe7d79c7c41, 0x2881854e175a6, 0xdd31be700cf22, 0x000cf420fd9e0},
+    {0xce08fda54140f, 0x8c1350d143caa, 0x353388a57f0ab, 0xf59a80aa86083, 0x01f05ecdbe04d},
+    {0x3c62bb21d5c43, 0xedefa37d8830e, 0xba783d30584ed, 0xe5a1e916b9981, 0x013f01c287f14},
+    {0x02db376a608e9, 0x8a0a1f0f6171d, 0x981c762176c7f, 0x08082dcfc5adf, 0x002663dd1653a},
+    {0x07b8e9c4c4b14, 0x506845e74e4d0, 0x0c254d030737b, 0x6d263a934a37e, 0x016e3ac7f22e8},
+    {0xfb1a729aee830, 0xce772e2cdf47b, 0x37077f6e0ce69, 0x5e1fd10003e77, 0x028d62dbd3a07},
+    {0x8d6a0dfe55f0f, 0x04a025a90bdbe, 0xea21a8f705c49, 0x072e996b21149, 0x0169edaba2650},
+    {0x0b6d8da4506ea, 0xe6d648b31c779, 0x644e62ee84a45, 0x6369d384a3862, 0x00f03c6152c50},
+    {0x52d61acdb8b9c, 0xbd76aa303fa99, 0xafa90939c534f, 0x9c1568f5455fd, 0x02c172e3cb97c},
+    {0xe1fc1b91ec656, 0xb638e425003b8, 0x2a0a6f56c57a6, 0x5a7a7e251bce0, 0x015618898e171},
+    {0x94911381cee61, 0x99b1aef721a11, 0x9b6e625fd997f, 0xe7e01e6cb42fb, 0x00390d651cda1},
+    {0x483d5e989a91e, 0xf7e695106cc58, 0xd05474e84a3f1, 0x9522242225570, 0x015f5edc505fb},
+    {0x56f62f183179e, 0x45b962d59e90d, 0x7452e96769cd9, 0x404fd8b485ec5, 0x0044043bd1e65},
+    {0xaa872eadedebf, 0x4b9ed2c49f56e, 0xa4ce0cc3d09ae, 0xccbaeeccac3a4, 0x02f62417d4e83},
+    {0xda3a8d6a5e9a8, 0xfb9c55c8e8e7d, 0xe45f80b3b9da9, 0x43836cb4e9761, 0x0269b9f8895fe},
+    {0x8eaf29039bef6, 0x0579f91174b9c, 0x7f37de6f6f480, 0xc8d985595087f, 0x00ab1e9906ca6},
+    {0xb0a9437fd147a, 0xb96b35121ab9b, 0x7e1c21b8f71f1, 0x430bfd9aed97e, 0x007df3dca152d},
+    {0xfe54b3ca82d16, 0xd38ee3651f98d, 0x2266669472dde, 0x65e3745e4d6b8, 0x02612c120ebaa},
+    {0x8636ac765d170, 0x4bbde7d7feacb, 0xedf3a19bd1c14, 0x61085b3cde2d6, 0x02cca690bb904},
+    {0xc872e56ff45d2, 0x46ab1258b7556, 0x53b156c4a26b9, 0x1dc7c40e53c8e, 0x0128365ad7756},
+    {0xdb3bd5e838336, 0xefb263fb9a7e2, 0xf964b0e51ac28, 0xca56ab2fd5927, 0x02a3fdec895a7},
+    {0x5312297070a51, 0xcf23ca1d8bff8, 0xfe951ff955d1e, 0xdd470c69fb81c, 0x013b24c082084},
+    {0x426c7142ac7ef, 0x8f365c38ea9b8, 0x62265d0dad42d, 0x800720a9944ec, 0x0171c03914108},
+    {0xa938ed4762dd5, 0xa1e180d53342f, 0xa3dcb300da55d, 0x4f87ca8486833, 0x01cce4506f64f},
+    {0xb575f70c15051, 0x9b7bbc48ad448, 0x3fea3f59045ce, 0xc17cd8e83f3a7, 0x0136c681e4633},
+    {0xec9dd2e3ca642, 0xa133ae8dd34bb, 0xab4fb52a6a162, 0xec99df8815f65, 0x0257ec4165b12},
+    {0xefd4a78160a36, 0x4e14b2fe188db, 0x9431d6f5ea516, 0x76ec4680838cd, 0x012df77f74eae},
+    {0x2317ff5bcba54, 0x7647c6c93196f, 0x19e8ebc53cfd2, 0x31cdda861b1c4, 0x01e6aab7a285e},
+    {0xbdd3ba4b543c5, 0x349174a4377af, 0x7612b820c0253, 0x75c08a79e242a, 0x02b3caecedc69},
+    {0xfe4d9a2f274b4, 0x4b67a771a4f14, 0x1191036772eff, 0x88d97e4e60ac6, 0x00d110b2b4f6a},
+    {0x9da147cae96a2, 0x532cb6f2689d6, 0x41af8af62f750, 0x07ecd2b02b210, 0x02f86052aa3f5},
+    {0x94abc1a78576a, 0x220de1d22aae6, 0xe413a8b7a4eb7, 0x1c224fb1781b5, 0x00d95da3f0673},
+    {0x4a623991037da, 0xc326dc00576e1, 0x4e04b79f74c5c, 0x111e2e73b4a8a, 0x0145a86f2e0de},
+    {0xbd9a7659c6ee8, 0xd4d44683d6269, 0x6d93d5d7b9c33, 0xbc2ec225f256d, 0x0083545bb3a94},
+    {0xf4b2e0a8d49b7, 0x4ba8602c7e624, 0x1c4146a709007, 0x85b3a836b38fd, 0x02eecff1e757d},
+    {0x92baadb3d4708, 0x7aa1fedd0ae8c, 0xac1db16d930bd, 0x73e17d56482cb, 0x01a95e4649e33},
+    {0x65d45f2966a4b, 0x4559060de27a6, 0x42720ee8bc35c, 0x15bf5f20cf0b1, 0x016af2e09fb36},
+    {0xde24cad5dbec9, 0x9ce04016e816d, 0xda66035c148ff, 0xdaeb8bf087419, 0x0293a0febeed6},
+    {0x1958e2c1bdf21, 0xe8ca1c3269f94, 0xebd2a277c8e3b, 0x4bb675b7ec541, 0x02d778ce08137},
+    {0x6dfd9a8f2ace0, 0x0b88b7ce08d65, 0x13a395abd83de, 0x976398f5599fe, 0x00c93908335f3},
+    {0x57f05ec0622ea, 0x244f195683109, 0x13d08f0a8c3c8, 0x666cb30d19bcb, 0x00a1e555279a6},
+    {0xde2d08df528d7, 0xf7b71ef06b5ba, 0x692ea2809e9b9, 0x6e87523213c7f, 0x025ccf2116757},
+    {0x77d190b886276, 0xba7200efbd938, 0x85f50ad786ef7, 0xb401c97ae4c16, 0x003da31630e4d},
+    {0x61a7297b9ec2f, 0x909dccf2d686e, 0xfe33a4c2fd5f6, 0x87cb1799cb71b, 0x005a62cfd60ee},
+    {0x7237980a76283, 0xcb017dee2dc74, 0xd8a5fcef17935, 0x877b2032e514e, 0x0125986baed05},
+    {0x08fa716fede65, 0x98f12c54d7044, 0xe6589c12e52f1, 0x2f27b0c816f60, 0x01982fe3d48ee},
+    {0x4a0f82e9ac523, 0x0c1d2499aa45d, 0x92600ff761df3, 0xafbe4740f82e1, 0x014529c4647d9},
+    {0x2910b3361e850, 0x9bc7bbd465e1f, 0xc10e24eb70750, 0xe9c720eff1eeb, 0x016d9b77d2318},
+    {0xd81eb667f8e05, 0xe14b908c1de18, 0xef2f8819974c7, 0x3b89b2cf29232, 0x01b9f1ea3401f},
+    {0x979b9be8d55fd, 0xd744dfd79bdcb, 0xfed149383a3aa, 0xc949644610563, 0x0292e46e6cd3a},
+    {0xf3192f9cdd385, 0xca36f6df2ab1b, 0x032824f343855, 0xdb427dfe21fc1, 0x01bcd93966a0a},
+    {0xdc15e8604935c, 0xdb7f9356e349d, 0xb179e54e71680, 0xd8e74655bf3cc, 0x00437c6fefe0d},
+    {0xc2708bdb1dee3, 0x747df2b77dc79, 0x02d686f0c70e1, 0x62cb5facc9869, 0x029660ce5b72d},
+    {0x64e1ef576b073, 0xf01e97b4902bd, 0xb5b6c73623dba, 0x6ff6a3bdf53b4, 0x02f0b6f638d2a},
+    {0x7ce45b9f51177, 0xf8bf80686b080, 0x786bb7dee10ac, 0xfd35db79e4127, 0x025536e4e4053},
+    {0x8086526f773de, 0xe9fbd173b2ce9, 0x9b580c35e8bd8, 0x79f23e1e6dc08, 0x0293a20fad81d},
+    {0x291d78d972f29, 0x9586776c94b4c, 0x13c1fb39cf9b8, 0x638300894ed53, 0x01a6b4075d58e},
+    {0xce92747db39fb, 0x9c6baae8c60be, 0x6753f9b3aecf0, 0xdd2c6b3280a0a, 0x00728cf80434a},
+    {0x2a85d6f831533, 0x61f2476ea14d3, 0x91aa3d9e82b75, 0x55d9aa056d6ae, 0x01a8629b0d6c0},
+    {0xedd66789bea11, 0x0ad03b400c971, 0xacf414047268a, 0xebb9f2c91cd2f, 0x003ccaefc4d0e},
+    {0xc3035ca4e0cc5, 0xf182a85e5703a, 0x736918c5aab3f, 0x8e0f00188ccd8, 0x00f2f637c6f94},
+    {0x3ef3316293bcb, 0x14e1667e2f4f8, 0x016f28bf2d14b, 0x5ce7e213f45fb, 0x01ca740aee5bc},
+    {0x031c4fbd0190e, 0x20b147029529b, 0x7efce2aeccef2, 0x0d1fcc71c4082, 0x0064b1edd3bed},
+    {0x414af06380900, 0xb4be7e846ab5d, 0x3dc3c9fc07d9f, 0x89183d1c63fe6, 0x012a8bc977b40},
+    {0x768bc63645d2b, 0xf166e9ca24758, 0x9a370220c35ab, 0x812c41a7e84d3, 0x02448ba6f1652},
+    {0x28ee2b1e5fb2b, 0xb09616491e0e6, 0xb7d42f3bc1da3, 0x4a0bc025803e1, 0x00f25ae1a60e5},
+    {0x662bd85452adc, 0x82c5f892d9ff2, 0x4ab63beb0dfa0, 0x0746f53246821, 0x013d772f760cd},
+    {0x787b16efeb0d9, 0x847f575491655, 0x046117da68fb9, 0x3cbcc792e37f3, 0x02499d038295e},
+    {0xeb13b7955e3ff, 0x6fb006c546e5a, 0xacf409ecbecb2, 0xafe36af546f73, 0x0025f775cda3d},
+    {0x913f4d81d46ca, 0x4b74f269d8dca, 0x1a0a582b0181b, 0xde709cfc4c32e, 0x00530c23de4ea},
+    {0xd42b95bde8fb6, 0xd5bfe3cf7f551, 0x678411121852b, 0x3adeadd352a62, 0x0207510b85efa},
+    {0x35f8a86178cc1, 0xa75c030be9a01, 0x87ec1b54451ee, 0xdd626ec7befe7, 0x01b34fff731e8},
+    {0x0e9c47b8bb9f3, 0xd75d1f4f41c02, 0xae56bc27b2b07, 0x1b7c27659d6e6, 0x00a53b842b65f},
+    {0xea5bffea6bcd2, 0x6594caf24a5be, 0x0b83771cbfced, 0xc236e51c4ca39, 0x0214ae24c813a},
+    {0x6d204cd243dbc, 0x1367a5bf83cc0, 0x420229e10c9a6, 0x3a092f315ada9, 0x020342da063aa},
+    {0x93bd00949155d, 0x03ec7c7a74333, 0x923b41fd7a2c6, 0xee64c6ab01945, 0x0226e60c0c8cc},
+    {0x1951d70b4873e, 0x4426a1dea8f20, 0xdbf57cf62f440, 0x161069241c97e, 0x021d7f0d8c4f6},
+    {0x3e86fe642f304, 0xaf02625dd7370, 0xf21d0b849e328, 0x168ae0724aebe, 0x00596caa2cddb},
+    {0x20c7e5b726710, 0xf827eacceae49, 0xfbb402693d432, 0x2efc334550537, 0x005ed49a06055},
+    {0xb652c95ba001e, 0x110fe3461afad, 0x47f2090fb0d9e, 0x647a742e62c9e, 0x0291effa9a773},
+    {0xb3f7ab1a367dc, 0xf80521ce510b3, 0x4f1c99a33f659, 0x3f3448e813506, 0x013aea4bbd7f3},
+    {0x1f205af546436, 0xe5e1024c98771, 0xb3f8c7abd0f2f, 0x81da262b848ac, 0x00bbcc979f5c3},
+    {0xebf48b56800d2, 0x356b85ec09c0d, 0xc43914ec83ca1, 0x001dde48af77d, 0x00fca887d7640},
+    {0x7e6de2720452c, 0x851a9c41f8cec, 0xf848002067e17, 0x6c3a3247f3df7, 0x013c5241418f7},
+    {0x6d7ed8836f0f7, 0x107ebac90c998, 0x58b8aaa4c584d, 0x80b14d3bf368a, 0x017600ec7d054},
+    {0x6dbec5ba14c83, 0x97c7283fd1fb3, 0x830d642de210f, 0x5b20b9939538e, 0x01bc11e0e521e},
+    {0xbfdd069cf1232, 0x9d8f746a33651, 0xe9840f2ab7700, 0xea1b4d243141f, 0x01d8ffd5562db},
+    {0xcc126c8dc77f9, 0xe0837af96cc93, 0x7a8b6cd1ce718, 0x01c46d942b404, 0x0208d6f28aba4},
+    {0x3267acec68eb5, 0xc0996bfb84273, 0x9e31adb7f5f52, 0xef52fe1fef91f, 0x02a263e36c0e8},
+    {0xc671436386779, 0xac27ba2a71ae4, 0x027cec3673374, 0xfa86647810c94, 0x00321a16a40ad},
+    {0xe943050ab59f3, 0xb6b89fe7f1aac, 0x88b50c4812f2c, 0x440e7b6b4f8dd, 0x002686ddae24b},
+    {0xa526a02c25c85, 0x0c3141614e9b9, 0x2da165fc25dbe, 0x9cc594ca8a184, 0x024b94ad59784},
+    {0x28aada7ac9756, 0xb0e25df7b2c61, 0xf881b136b5419, 0x7a3868e132629, 0x0253b74365ee5},
+    {0x16e94a830c6ef, 0x2fe9a240a3a6b, 0x8b5f9208a1ee0, 0xd57ce26fac7ca, 0x02def78d5ff6b},
+    {0x34ed6c456a6f4, 0x402e0f4f4f162, 0x4516ec57c42c1, 0x6eaf69ac6bcf4, 0x029b0115edee1},
+    {0x1957a2b720b6f, 0x747845b44df87, 0xbc9c12764e0d2, 0x982c01e540cea, 0x023ee8975c075},
+    {0x7cb7383f2d432, 0x6729d0ba9249d, 0x505a0001abb61, 0xf1adb0b630948, 0x00749051653c5},
+    {0x06dee9a5debf0, 0x37c6b078bcda6, 0x2c1d1cd21c6fa, 0xee2a620fff0bf, 0x02a5f1e55ca55},
+    {0xf379e7cb4bf55, 0xda1fc2a33a520, 0x755b35582142f, 0x52ddef608f644, 0x004573d9f985c},
+    {0x2d66c9688d5be, 0x1380485a8925f, 0x9c1d8cf75fff0, 0x23f0d38a0f088, 0x018967f9f7079},
+    {0xbb401ad1b5f62, 0x026821c5ab0aa, 0x7829fb59bcd07, 0x47884350c41a1, 0x000d20adfaa6d},
+    {0x1bcd94bd2e1e8, 0x664b94375035d, 0x63ea0d32eb731, 0xb315b1c47eefb, 0x0269308ce3751},
+    {0xd1f940ae23718, 0x5e1d176588765, 0x9983581615232, 0x071d1bcef484f, 0x001b9234ee20e},
+    {0x8ed0f241c34b5, 0x434db876bd3e8, 0x5440ea2a82f07, 0xc29661dcedfab, 0x0295c373fc9b8},
+    {0xa3e6e89544632, 0x61a8143632993, 0xfb12c95732eac, 0x6c0797b5df491, 0x01e1d3491056f},
+    {0xe44ef7cc291e3, 0xbade511a90710, 0x889a30e74eba4, 0x397137852734d, 0x009752fb40eb7},
+    {0x081266932131c, 0x8c95d8dc95358, 0x1a7826d5a4245, 0x7e0b77861bd3e, 0x03058106bd093},
+    {0x509dd5d636977, 0x37724b2dab8cb, 0xc85ac5ef13568, 0xab6efa0997760, 0x0111884508c4d},
+    {0x224223a2a5b40, 0x81e4e84452bb4, 0x8715308a0cdce, 0xb9aeec9093125, 0x006896aeff6e5},
+    {0xd0a500f6d08fb, 0x6200656d223c7, 0xd7a410f00e233, 0x97a3e291bde05, 0x00d9759bbe92c},
+    {0x844b7334787c3, 0x99fd75d949923, 0x2210e575ae500, 0x2ea7b267a75cc, 0x0142df921341c},
+    {0x89d2cb621aa22, 0xedb7c351ab7b5, 0xf3032deb2f2e7, 0xe48b844ca9f51, 0x003d6d7dd1b25},
+    {0x7c5f475e5c909, 0x088677d7a7a45, 0x7e96cd801a73c, 0x13090fe93dc3e, 0x01d7eef21186b},
+    {0xd8658017a3e1b, 0xe69fedd476598, 0x503e90cf478c4, 0xefab9a4940e2c, 0x022884f31cd0a},
+    {0x89fbb801dc911, 0x0a91d6523d27a, 0x160dc30db9e02, 0x1fc02cc8987b8, 0x0170f77d47c37},
+    {0x11a48a8ca159f, 0xa8536c56cf66e, 0xee1d89befeb83, 0xc4aeffb9e1371, 0x014d3b3100f61},
+    {0xa02b105038f62, 0x9aa0305339d02, 0x12ec0889015e4, 0x41c87e4581b27, 0x007274fa4906c},
+    {0x12ec5ae8f95fb, 0xa1293472a7aed, 0x010ea9a1622f2, 0x0766f5e56784b, 0x0002e818d6fb9},
+    {0xf965a4ead881f, 0x1914c90480f23, 0x5b22f52f4da28, 0x889d3809edf6d, 0x02f44e0ad702a},
+    {0xe5bab79a4314d, 0x00e3a3571848c, 0x2ff265bfa9b69, 0xb753cb70def49, 0x02bff97fe34e7},
+    {0x614e6a3dbebe8, 0x65f4822730e1e, 0x92cd323034e7e, 0xa690b25e54076, 0x001deabdbba1f},
+    {0x56da64368dfce, 0x3c218bd7119d6, 0x781dc26f73c92, 0xa8bbb4ec45c4a, 0x023255a19b624},
+    {0x30643e93f61b1, 0x60e4c18d88212, 0xbdef07e9d372e, 0xfcc1f833fc6f3, 0x0084ca8aa3714},
+    {0x117147665e5b1, 0xea87a0f27902c, 0x2052f5c98c0ef, 0x8d41bd5df45af, 0x007cf15dc9a48},
+    {0x28fa709d32b7f, 0x2db70ff6a51c4, 0x7ac11e212c415, 0xb932f6b759a6f, 0x023a9f3025799},
+    {0x72f954985fb68, 0x8a38f8602ddcc, 0xc2fe272234c68, 0x9d91c3d6ae131, 0x000c305a2c83f},
+    {0x84465e0482cfa, 0x63b9bd385bbf1, 0x2277280ca7362, 0x1b47818b98eb3, 0x010acafe786c8},
+    {0x4a854e26ded2d, 0x3badd1708fc61, 0xdcd828ed5a470, 0x767dcb043a044, 0x02ece9746c2c0},
+    {0x806829e7f16e6, 0x57c6a9e4247c7, 0x5d2ece9268587, 0xb4a138bd1effd, 0x02f51f0c5cd0f},
+    {0x86a683e5ef27d, 0xec37129fb7475, 0xba8f8b8717e81, 0x38373ffe0eb38, 0x01e7131f6834a},
+    {0x0da6cfe793d34, 0xc524ad7b533d1, 0x89f49c1413290, 0x599ce17fb7f0f, 0x004c22a489ef3},
+    {0x8e40644d104d0, 0x0315270d44aae, 0xf29e11ed93873, 0x539bdf59e5e60, 0x000d1dba2e340},
+    {0x4356d791089e0, 0x777c44cffa5a3, 0x60266c3b163c3, 0xa219ab8923dd7, 0x0089badbbcf9e},
+    {0x1bb23f8ef5cd4, 0xbbfa32d3f5ac7, 0x836692b48f6fa, 0x0884d67ae5524, 0x02d68c2e1992d},
+    {0xd82255a4a0cde, 0xf8ed430b446d7, 0x09e104decbf2a, 0xef55542c25c29, 0x00ff67b647605},
+    {0x2eb4d8344447e, 0xb177ed7b243a5, 0x1237e6a23df76, 0x03fedc9e9f1e2, 0x001560f0f47e9},
+    {0x3639cf8a6dbe6, 0x06cb3086dabe1, 0xb31fe55e253f1, 0xfd61877eaf414, 0x020b16ce1bc7b},
+    {0xe4bf6ba3f1fa7, 0x6fc66de1da2d5, 0xcd483dfa47ef1, 0x0a1d46426aaf0, 0x01190d364c980},
+    {0x33ffdaa3c1da6, 0xfbb95d923bd61, 0xa66c0419df582, 0xf7b38fe8d34f3, 0x00967c2f8069b},
+    {0x7de50419c5d9b, 0x353227f7c43c9, 0x6adefc5b856e0, 0xca3687d960753, 0x001592726c2d1},
+    {0x20954a4ed328b, 0x0a5736eafec5f, 0x9a79ad1d66b45, 0xd1ad75507e17c, 0x0020d18ccd8d3},
+    {0x85352e975f694, 0x2030fb9081554, 0xfa0d1e12d9de6, 0xe82262752875d, 0x00dc8e0b1ef38},
+    {0x025449edd04c6, 0x87d49a3df5e08, 0x8649c83405d20, 0x78e8453951969, 0x02fb62e1fc138},
+    {0x64c52690c8223, 0x3acc108064ece, 0x818caa56ac6b4, 0x598edd6ab333b, 0x0161c0f5f00c2},
+    {0x45bc33719cfdc, 0xd7664831c3ab7, 0xca88e3f13f798, 0x0608a550ca11f, 0x02215a0669b0f},
+    {0x392aa6b889ac6, 0xb3260ae3c1247, 0x5e4f116e1380b, 0x303903428e778, 0x02aa344db3611},
+    {0x3b52d46b20fd2, 0xb6c185f01615b, 0x864dd11873006, 0xc9c8ca7e629fc, 0x007dee4cf7ddd},
+    {0xe8eef217baae5, 0x63a6cebc16495, 0x530d4a5215b5a, 0x8289e01f0e25e, 0x0269fd3ad920e},
+    {0x0951cb8a995e4, 0xf3ff51031508e, 0x9b034e72c84a3, 0xc0da06ad97c20, 0x0204f8457b312},
+    {0xdf3bee96fbdfe, 0x7f97b317d54b9, 0x523eedcf05ad8, 0x15cafddd59ecd, 0x0223132cb94ad},
+    {0x007422847bc5c, 0x269a54b2a9df0, 0xfbb5349e831b7, 0xb9b6669809117, 0x01760b86387d6},
+    {0x9c58c15eb9749, 0x8185656ac7440, 0x2a1be4abf5207, 0xffd2dffbe01f7, 0x014aa9263b703},
+    {0x8463b7f5f4110, 0xf195d4ef883db, 0x67b9a26ca4051, 0x7a68d45d39d15, 0x006471a81a942},
+    {0xc27dafd2fc250, 0xf6db56c1be43e, 0xea9094c7d1b0a, 0xd1a1494aa37fd, 0x00f5d3765d424},
+    {0x07abd832f654e, 0xf1c90da467e44, 0xfd18ad3786ade, 0x1eee9d49fbf4a, 0x01d026e4ca1da},
+    {0x8eea9e6348b59, 0x422db9588fba9, 0xdfe555d9ca035, 0xa138c997e11e6, 0x0273e5cd1f879},
+    {0xbb34f4fe3cee8, 0x796950551c44f, 0x286cd5d663f58, 0x63fcdfaaf6a43, 0x018bf6c68aa4d},
+    {0xbbd5c3781ff2a, 0x7092868d7b13b, 0x72325fa92f295, 0x3f634ad7f6b6b, 0x01c28c392c1b0},
+    {0x1ce82e97d1cd6, 0x657c7f80dfe83, 0x87c426a28db57, 0x725f7a68e309e, 0x025432535e825},
+    {0x2ec62ab856dc0, 0x9e24c9ada9d54, 0x2dd77b2f89fc9, 0x32467aa7b78d4, 0x01d217da5b3d9},
+    {0xeb1c1a37d674c, 0x0fcbfce26f7e2, 0x5728e6d133334, 0x80f123b5b112a, 0x00e30747e6b48},
+    {0xc5eb1b9e984eb, 0x364c0644e66cb, 0x037cceaa862c4, 0x25ffbba8ac061, 0x02b27799e258e},
+    {0x1a2b208723dc5, 0x75fc3455af36a, 0xb46c89ef53f52, 0x27c78a0effec4, 0x01f5419ab0689},
+    {0xf248e098b7c20, 0xb90d4cb57166f, 0xa982114a4ce41, 0x0aeecfaf67bfd, 0x01bd0d0bb500a},
+    {0x1b3ea50329ea7, 0x7cb006831f386, 0x8708938f60dbc, 0xbed0a86b38370, 0x023f45f59d1c1},
+    {0x54b09901284ca, 0x64bb0f8cdd9c7, 0xeac300e313dd1, 0x541f918d16d4f, 0x00076078d7a19},
+    {0x7e0b203ef65cb, 0xc1a82a93b0883, 0xbe97d0f04e0e4, 0x6e5004691869d, 0x02627f29167bf},
+    {0x7f40412f298ff, 0x7f6a764dce2fc, 0xb9dde0c8e5289, 0x8818d028ca04c, 0x0236b6dfc0776},
+    {0xfa851e9cd12f6, 0x0fcf64fc3efc2, 0xb5da6b46bfdfa, 0x657e82f8d5010, 0x003be8622961d},
+    {0x65e077605ccdc, 0x03d7f9ca7a500, 0x014faf96b52a6, 0x5c48060a8f159, 0x00216a300dc44},
+    {0x541072fba32ef, 0x3757b2205106d, 0x7a04904d47f2d, 0xe367d75b96a56, 0x01f8015e60b34},
+    {0x87776b930edb4, 0x146471aa4b383, 0x2fc7661aa4996, 0xfa3bf3e3839f3, 0x02f98f62f26b7},
+    {0x3ea029749e4b0, 0x7362548a2670b, 0xee29c928b00e6, 0x7d360ed886ffe, 0x024fcdcb760f4},
+    {0x94614436362e8, 0x0343e6d13ecf8, 0x0816fe2c429b1, 0x112d25fb496fd, 0x0081e860df6c6},
+    {0x852437d76f0c0, 0x9300e41495a51, 0xbe199ce94c779, 0x114faff35a0a5, 0x02a7bb13a5678},
+    {0x12826e1327f00, 0x33a9e586bb1bc, 0x19ada0797d701, 0x2e20231b89778, 0x01c7eddf798a4},
+    {0xa06b2dc5f9b9d, 0x084b1520d4bbc, 0xf38b127e4ff97, 0x46a0671e72ede, 0x012a349345658},
+    {0x3055bd86bda52, 0xd6a92435593e4, 0xa0220e6dabd40, 0x3ce6bc4d6dd1b, 0x026bddb46d780},
+    {0xdcd22a445219e, 0x5154eda844e3d, 0xc8d2a3ae68008, 0x6130fe8df5d81, 0x023a3e639182c},
+    {0xd37760486b9a4, 0x41052a8ae77db, 0xfa48d91f203c8, 0xd7e51fc0c4e97, 0x025d961392a0e},
+    {0x815c520b5b1ab, 0x853a4f2fea972, 0x6f9c90cef7766, 0xfb65efd63d3d9, 0x01d25351102de},
+    {0x8cd931bbbb9dc, 0xc29451b69c16e, 0x12a77ead02116, 0x9d00031164b19, 0x0075563d3a688},
+    {0xd473662b02c03, 0xf32313cdddc4f, 0x3cd88b51cc104, 0xe619c3220649e, 0x00beb66831831},
+    {0x80730bf53e65c, 0x1db2bb198e355, 0xda4da0ee77b38, 0xc5b28c1bb2004, 0x002557bb24d56},
+    {0x4d6c5b20a9b4a, 0xb87726184637c, 0xb46388f3b6ce6, 0x9395dd020f427, 0x019525ca604f0},
+    {0x976c384d7640d, 0xc022cb7a0b443, 0x6d68a0f6448b2, 0x6abbf26e06269, 0x01747011a1942},
+    {0x6a1e0d271c5a5, 0xedbc5645a8747, 0xf389f9c229958, 0x771ffc26a4195, 0x02af14bb6f007},
+    {0x5215a31da314a, 0xa332f121e32c2, 0x7082dbc062bf7, 0x3eb175e1f949a, 0x009d1df2db0cf},
+    {0x8afa2a3c62d6c, 0x1d1f8409e8c0d, 0x09e05024f7cb3, 0x1c306a4aef646, 0x01261359de847},
+    {0x63bd743d83857, 0x8f1a83f793063, 0xfe691379662a6, 0x854520d5aaf9b, 0x01d4f8c9761c7},
+    {0x7b24cd8f20c14, 0xb12e6646f13a6, 0x94c5bbe939ca5, 0x04c0d30345a6a, 0x00c1052a46757},
+    {0xa59a76a84cd41, 0x442baf5926ae3, 0x7c0d24fd0218b, 0x9d9c3bcfc76f7, 0x020ec2e0ae79c},
+    {0x6907b717dd62d, 0x4312ea57c543f, 0xcde5b7a420552, 0x9af87d9684dd9, 0x012a9f03e13bc},
+    {0x4024365dee1f8, 0x78cfbfdc5cc81, 0x376c96b84061a, 0x13ba671cc3db1, 0x00d04c5873390},
+    {0x67c4360675bde, 0x81b21c6bcadce, 0x7db54b8750e99, 0xd08af1f2c1307, 0x002308bccedef},
+    {0x7165dcb6c726e, 0x7c168be29a6ff, 0x91e428f3c7f4c, 0x52af9db6d41fe, 0x01e353c1d5f49},
+    {0xfda4889560eaf, 0x7140aa4aa794a, 0xf85248c933e54, 0xa9fe7efa30e2a, 0x01a794d768f51},
+    {0x03241ea4c5e8b, 0x91a4be68cca15, 0x84f9e6e939e3c, 0x962a162076ae5, 0x01989f2396f28},
+    {0x47aecc332ec38, 0x18d99c38eb9ab, 0x1bb4e049969b1, 0xd46f6525a5fa3, 0x00af0b27a4597},
+    {0xed842482adaa7, 0x165533bbc193a, 0x089035b1cde76, 0xe53c8f9128947, 0x00530fb5026f3},
+    {0x47c7daea90b7d, 0xc45becd39f8e5, 0x2c1d73b962c00, 0x71a66708faf80, 0x0259c5e0afaff},
+    {0xa54aa225975c1, 0x37074b13b93d9, 0x5ea9187979283, 0x595027a1cd07e, 0x025d992e09301},
+    {0x9589efb6f68cc, 0x615a85a8c251f, 0xa2945b27920a9, 0xccca7f9bd8875, 0x02591e0acdb68},
+    {0x174b43d1cd184, 0x583a808d16aad, 0xd8998304bbc03, 0x74d69595cfc48, 0x01bf2c4eb7154},
+    {0x37352f039b0f7, 0xaa3946f03c311, 0x614fcdc7f2e61, 0x8b7a1ddcaef54, 0x01deb88c79444},
+    {0x512586b1bf534, 0x721282acc3684, 0xe2f722239b976, 0xf19cd03d2893c, 0x023945280e613},
+    {0x153af81d94a52, 0xa1dc774fd3515, 0xb1c92972dc7ba, 0xfee80acba006e, 0x02b994317ed8d},
+    {0x14c308e6003eb, 0x5aa8333a8d446, 0x3e236069b9108, 0x773cbdb8f56f2, 0x00c1b4bba63cf},
+    {0x6df3c520bf893, 0x88a65e7f6e4de, 0x777f307fbf713, 0x0779fc25a3f80, 0x00a99a6b25036},
+    {0xfc9a83d49493f, 0x90be4f8c63da9, 0x33fb582628f59, 0x42e65d546b5b5, 0x022adadea4278},
+    {0xe9f111b570c4a, 0x6f8f4c18ab6ef, 0x8e5c1fc8fa029, 0xcadba81e3d53e, 0x006d2147154a5},
+    {0x6b154e4f9dfa5, 0x9eaf4e4c4edbe, 0x39768eb5158e2, 0x646d84a05fbff, 0x0070e49debeb5},
+    {0x3fe34c950caa3, 0x8e431223733c2, 0x7c7d6ded9fb10, 0xbaac6ae27fa80, 0x00996bf26d00b},
+    {0xa4466be9b7914, 0x23aac4d5596c6, 0xa774e3e3102fe, 0xbb07417acf2f3, 0x01ab1c5cebbb0},
+    {0x33fab315b7fa5, 0xef92063242206, 0x0568e9105b942, 0x55167c0432fb7, 0x0151fa3e3855b},
+    {0xa0e0f7675ca9b, 0x42d1e95bcff2d, 0xb00f1bef24c86, 0x36b5ab0ad3d0c, 0x002605837d0bc},
+    {0xbacb432cdd500, 0xf158e56560834, 0xabfbb46e445fa, 0x3b1049b0359a4, 0x01477b28ddd5e},
+    {0x845172a816fda, 0xbaf9e6e0e214e, 0x99f1f1f42e45b, 0x00115dc74e00a, 0x00eca8f821cea},
+    {0xf521d07903a3a, 0x05bce56406d5d, 0xaa93f2e6774c9, 0x54ab3fc0cad59, 0x009b214fc5e94},
+    {0x91963047447f3, 0x6eee8f91cdffa, 0xf7ead61272fe5, 0xeda15214800dc, 0x01a73b4c461d8},
+    {0x769f0c0be6995, 0x513c96f5a1a51, 0xc9c5735cb4c29, 0xdcbffec44e76b, 0x018a2aa6af380},
+    {0x9dde863052397, 0xf587794bed704, 0x777dade399680, 0x63da788c28949, 0x010c5ec0e273d},
+    {0x2462471885fef, 0x662712b9e9fd5, 0x6cb6bdc8a1e0a, 0x6b2c7e8020fd2, 0x0201184e075a4},
+    {0xca910960da4fc, 0xaebbf83b4aef8, 0xd272fb1bef5e5, 0x8520fc7af1574, 0x008783f8bce8f},
+    {0x9d2d57b2f1ee1, 0xf7950f1bff570, 0xe2876e345474a, 0x821c2aeee90b0, 0x02757be1a06c8},
+    {0xf2174e1fefee4, 0x7a82485a29e24, 0x8e539b8eb1c85, 0x8923f218e1edf, 0x029f809df0049},
+    {0xb9383074f56c9, 0xa8958adc46e1f, 0xe1ec775310807, 0x5a66482fc866a, 0x02fc657fb0bf0},
+    {0x4bc4b5fec7435, 0xed332fd262c92, 0x72f27ca85396d, 0xfc366b927914f, 0x01681eceb6a2c},
+    {0xb865a326f294c, 0x6a3bbfab50c35, 0xb29212674d183, 0xc80b8788a57db, 0x00573da1455cc},
+    {0x74700c82c28c8, 0xeb856e65a6ab1, 0xa7862e055dd75, 0x240e48b09721a, 0x005aa60264ef6},
+    {0x7a860f0ee7b7a, 0x0c4bc8e8b8f60, 0xa4be6873c5ac6, 0xc6e5db7520b8d, 0x022fadd783674},
+    {0x0baf4adfff516, 0x94e6cdfccd2a1, 0x014b5eee92f6e, 0x0b45b7843b419, 0x00beacfaeedd7},
+    {0x4579adf725de0, 0x28b158d5ba32f, 0x12561d5fc857f, 0xf5357509565e0, 0x011acc94a3114},
+    {0x1600efda57b56, 0x71888df940da3, 0x795c31453f8a3, 0xd62f79a3587c2, 0x02c1a680c29e5},
+    {0x91c70cc399d55, 0xe91e35e6fd934, 0x2a7b37ca1fe29, 0x3e71377014ce4, 0x01fd152bfce32},
+    {0xabbb2131c03ab, 0x55f4070ce9369, 0x77fafbe34efef, 0x788cbbed144f8, 0x0204e6402b801},
+    {0x489ae70bb0742, 0x29867c2457c52, 0x031cf2619c7a3, 0xfebc7baeb2261, 0x02301c151a356},
+    {0x6153bc7a329e8, 0x9ac7366e8dcfa, 0x10f65c5e0f1db, 0xad0799e3a6724, 0x00961bf3ede97},
+    {0x1b7ed4acb2a66, 0x9195bc9144f73, 0x6c84f5425ab7f, 0x069e605dd9b9f, 0x018a3ab4c8167},
+    {0x3b0892e962380, 0xc38bd35ac489d, 0x7716e81e85fd9, 0x94dbac5d0a020, 0x02ca8f7a237a0},
+    {0xbfbb8cd3babe3, 0x9d7d4f2f6b4d0, 0x8e5222d864134, 0xe2c48af20e57c, 0x00269667f9550},
+    {0x2cd1b2e58ea05, 0xd128b25892739, 0x6682a7f2e474b, 0x1c5d6480e39c6, 0x00a2edeef6f0f},
+    {0xa56f3a59654a3, 0xd1a81a80c2a4e, 0xc11b55482af70, 0xec9d6367a095a, 0x0064e1691e95b},
+    {0x359d842bdee5d, 0x111363f2690fe, 0x220aa1f575344, 0xc2c8e5316c688, 0x027a08c3737e6},
+    {0x63cd1f3488630, 0x599cdccd887f0, 0x1921e8218aec8, 0xdc75c9161587b, 0x007e22d262418},
+    {0x832c758c0f121, 0x3de3264e04376, 0xb47c302252ab5, 0xdc35688dbb0a4, 0x008a46e4e6174},
+    {0x3e12ded37918b, 0xdc1620124148e, 0x9d4d3aee0d081, 0x1adb729be5a28, 0x021b0a70db63d},
+    {0xb19274591aa28, 0xa16cd3417a0af, 0xe86f257f46d5d, 0x57b986739cd90, 0x020d2cbccf5da},
+    {0x458521715b100, 0x906f3844dbf39, 0xfc2031bb793da, 0x3eac035402255, 0x023baa223a7ca},
+    {0x1e0d6405b103c, 0x8622a95b07ad0, 0x9549e8fd8a883, 0xbb63d4cccf62c, 0x02572d5dc94ba},
+    {0xf005d4778d5e5, 0xda26fa974e830, 0xd6112ec82ba3e, 0x672f782483afb, 0x01adbf2f1bb6e},
+    {0xaedafdda2fe2e, 0xed17911335662, 0xeec0cc5cc78c6, 0x34583fbb5438d, 0x01eb602248ab4},
+    {0xb28282178ad7a, 0x11369c9fbdf62, 0x31d9c6bf990a3, 0x3538d36940c30, 0x01ee920c922fc},
+    {0x14e19a95ba6c2, 0x850e9144d1163, 0x368499d0df852, 0x932a2adbcf0f0, 0x014ae114cd0ca},
+    {0x7275305e2350e, 0x9c504560dbd91, 0xf1a9d9fcf2e1e, 0x8eb074058aefe, 0x0282470152970},
+    {0xc3afafa1b565e, 0x424bbc55da74f, 0xe7b8c9383b917, 0x14499f3f7169a, 0x014b52d818bd6},
+    {0x943ac5268a1a0, 0xc36492937b1a6, 0x3eadd10274162, 0x1359edf502c07, 0x01a8f0d3eee4a},
+    {0x1456a56341f41, 0xd9214dd62c319, 0x550250e51b4ae, 0xf7c70b4e2e460, 0x013e269bdcb67},
+    {0xe11864fcc592e, 0x189da5a739f20, 0x07304c2d72387, 0xe8b75a570c223, 0x02bab13c043a3},
+    {0xe9d6790b37fe5, 0x2665fb3b01742, 0x0a54c9a7ae298, 0x850fcbb574e9a, 0x013f8c2064e61},
+    {0xc99216297a4ae, 0x6e2e54e1c004f, 0x0fd95cb1e9547, 0x6f6209ae5a830, 0x01bfe20e2c98f},
+    {0xc4e6f597d449f, 0x42738807aa087, 0xe55e7cc43a0d8, 0xdedd502ed9651, 0x00f87b65eb262},
+    {0x219bdbbc283cb, 0x8c480eebfa790, 0x85fe267ffe92a, 0x70772872047c8, 0x00e871168d5f6},
+    {0xf55d5b1f4f1a1, 0x1ed79512a0f11, 0x0f07c2935d1dd, 0x088847f5c7854, 0x008648d7a8695},
+    {0xd8bf5ee7f0306, 0x174b27b7809a3, 0x3fa785c068bbd, 0x28efed7688cde, 0x014da38e3fd8f},
+    {0xff1c5b78a697b, 0x14d0facb9471f, 0x1ef73698e9368, 0xd4645548c1ee0, 0x0025f63f4894b},
+    {0x176734ec4adde, 0x2be09036c694b, 0xb021d90093f44, 0x758a4c7dcbc40, 0x0094eecd93d12},
+    {0x1e5975b8a5c1f, 0x9992cf2a97f14, 0xf336c8b25fe7a, 0xe4ee305f09255, 0x00e00ca3b6bdb},
+    {0x55226e25d7a6a, 0x7ec42e5f7628a, 0xe329fc7ec912c, 0x97a4419c3204a, 0x017c22454829b},
+    {0xafddc410144d3, 0xc0d10487c3a5f, 0x93296b2e511d5, 0x539ae17b697e6, 0x024d28ab597fd},
+    {0x2eb5220f40310, 0xb1abf131f52b5, 0x051c1b87b7cd4, 0x6b9eadb62d973, 0x0029fd1a1de7b},
+    {0x1211af8c752b7, 0x3203995ef5253, 0xc02d3c83f1eb4, 0xd893c6cc54d59, 0x02dea1f19a1ac},
+    {0xc7fa7f7ae45d6, 0xf199b6194ae26, 0xbd693793218ba, 0x76c08053a0eca, 0x02d1969d1b078},
+    {0x52122d7176132, 0xafbae4ba69b1d, 0xa58724581cb19, 0xf4a7525d61c28, 0x0004294db223a},
+    {0x5cf5609d8707e, 0xfe0b8a87b3b20, 0xa9bda1e7884b5, 0x363023080d331, 0x003215c8f5b32},
+    {0xd2f706d4f1923, 0x6c550e97bc083, 0xff319e9013dcf, 0xcfc571dd9b310, 0x02836590675c9},
+    {0x140dfcc020caa, 0xba3c18d8f6e6d, 0xac7f63ec22a99, 0x67c507b9edf3f, 0x022c7fb3732dd},
+    {0xcef4e43fd0634, 0x9a06281fbf7f4, 0x0f974817b2af5, 0xfdbd8b94aa464, 0x02efa5e4c0fc5},
+    {0x1b8e68941eef7, 0x4f05cf11c7330, 0x46e595fc20386, 0x7bfffa1120861, 0x024e69ba13e26},
+    {0xb1f7ef358af92, 0x7f2aff1dc9179, 0x37504aa0fa2d4, 0xf865d91c1afd4, 0x0019d4e733a09},
+    {0x8956a0bd4707c, 0x0ecfe7541de35, 0xf00fd0314a17f, 0xef49b61265bda, 0x00997a39a3433},
+    {0xfab2bf7297c54, 0xac85a65983d34, 0x9843955364ea2, 0x300cabb17e22b, 0x00baf8116d9e7},
+    {0xd5c25b8a235ec, 0xcd1f2074ed18f, 0xa6c0a0219f655, 0x7e2719f7222af, 0x02195339bdaa7},
+    {0xf04c234727bf1, 0x9f00666845b41, 0xc9e6230fa7f6e, 0xa4a89da259124, 0x00cf884eef402},
+    {0x832cc2469c08d, 0x0b567b320f835, 0xd381e03d507de, 0xdc9d0c0e053f7, 0x0103a3f8eabd5},
+    {0x91b0a15fde090, 0x4e0739a8e16d9, 0x6444ba082c9e3, 0x48ecfb5709a1d, 0x0210b70869e33},
+    {0x70de60fdbc6da, 0x01cd91767fec2, 0xbc7ff9dfd8201, 0x747e3a1883a13, 0x02e4c05e0aa21},
+    {0xaf0ce64230cae, 0xdd694c81c6985, 0xfc007f17afceb, 0x9738999a7986a, 0x017586ae693c0},
+    {0x7774cd9b97072, 0x5dd83d62d4d36, 0x22494c43a2c6e, 0xaa9e47f0890c5, 0x00e656fa1a031},
+    {0xa1736a2ee4838, 0x1e82c0319edff, 0xfa0498d923a51, 0x04f77fa2d4d30, 0x00321d284bcad},
+    {0x3dfbc4d98da34, 0x391c9098393c3, 0xf2623a008edce, 0x3a9e69032e097, 0x014adbf224858},
+    {0xf5ff9a0a953dd, 0xfd2efbc969883, 0x2d2a9bd430e2a, 0xd6b3d0ebc1597, 0x02974c08f786a},
+    {0xe0def50393dce, 0x83f356ac11d7b, 0xb04628771f7dd, 0x6faa9b27bdbb5, 0x01ab898afc137},
+    {0xfd20254d13bf1, 0x74debd8083982, 0xab81c7a493c56, 0x016ace7359b72, 0x011880f71caef},
+    {0xf12da619e473b, 0xc600f0a005422, 0xf61c457663753, 0xf3181523a5b07, 0x0094fa9c56123},
+    {0xcf1e5ecb967dc, 0xb836dae5e9750, 0x47b2bc07fa649, 0x8226d3612e75a, 0x02fbb7e09566b},
+    {0x35f3c0fb05a88, 0x123dca52a4ee7, 0x819c5f2b65fa5, 0x4088e42ac2895, 0x023cba10a5067},
+    {0xa6b097bf0ce3d, 0xba4dd9b3984cf, 0xcec2640d6cd08, 0x8136683783148, 0x02fda673c5ee5},
+    {0x5c4cc9155fb82, 0x3e5018187d6ee, 0x007ccbfb814c3, 0x952603ed5ea97, 0x02d648de33288},
+    {0x356d05f353a57, 0x7d69f7cc0244e, 0x80b5a3469c6c0, 0x77593a459bda0, 0x01a38566e6aba},
+    {0x1114a136db30e, 0xaa6492ef995d0, 0x01ef1536c140b, 0x813c3e4b2eaf7, 0x025cae99dace0},
+    {0x0e1918b6dfb0e, 0x62f94131f029f, 0xc1d05646b1003, 0x12f926df689a4, 0x0246347f7bad9},
+    {0x8db6841458dd5, 0x9edda0a5469a3, 0xcbb2b032aaaf4, 0x4883f58614eb0, 0x02071df43bb86},
+    {0xde74765b6c52b, 0xbba48e3e1fd9e, 0xdd586c819ec78, 0xeadfc98520048, 0x02aa6c4b4b451},
+    {0x6f0e193fe3714, 0xe7b4c92c47886, 0x767a4458f9b4f, 0x7997949dc4249, 0x02c46bde14c1f},
+    {0x6b39a075fead4, 0x0022b4ffb1909, 0x6b5bf3063aa3d, 0x9ec4d1a0869aa, 0x0188d38544923},
+    {0xd60a4c0007a4f, 0x17336e298d209, 0x29132992eb939, 0x6cfd684b73450, 0x021a92d7f650d},
+};
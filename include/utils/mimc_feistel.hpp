@@ -0,0 +1,276 @@
+#pragma once
+
+#ifndef CURVE_ALT_BN128
+    #define CURVE_ALT_BN128
+#endif
+
+#include "utils/ec_params.hpp"
+#include "utils/field_bytes.hpp"
+#include "utils/field_ifma.hpp"
+#include "utils/hash_batch.hpp"
+#include "utils/mimc_constants.hpp"
+
+#include <array>
+#include <libff/algebra/curves/public_params.hpp>
+#include <libff/common/default_types/ec_pp.hpp>
+
+// Key schedule of a pass of n keys: round r is keyed by key (r + n - 1) % n, round 0 by the last
+struct MimcRotateKeys
+{
+    static constexpr size_t key(size_t round, size_t n) { return (round + n - 1) % n; }
+};
+
+/*
+libff parameters for the field of every MimcFeistel variant, ready before main(). A static member
+of the class template would only be initialized by the translation units that use it. The hash
+functions also initialize them on first use, for static initializers of other translation units.
+*/
+struct MimcFeistelParams
+{
+    static inline const bool params_init = init_ec_params();
+};
+
+/*
+MiMC-Feistel family over the scalar field of BN254. The state has BRANCHES field elements
+s_0 .. s_{B-1}, all 0 at start, and a round keyed by k with the constant c is
+    (s_0, s_1, .., s_{B-1}) <- ((s_0 + k + c)^3 + s_{B-1}, s_0, .., s_{B-2})
+(the usual Feistel network for B = 2). A block is 2 * BRANCHES field elements (two digests),
+absorbed PASS_KEYS at a time: each pass runs ROUNDS_N rounds on the state, round r keyed by the
+element KeySchedule::key(r, PASS_KEYS) of the pass, with the constants 0, MIMC_ROUND[0], ..,
+MIMC_ROUND[ROUNDS_N - 2]. The digest is the final state.
+The schedules are resolved at compile time: every variant gets the same scalar, interleaved and
+AVX-512 IFMA kernels, and the same gadget (gadget/mimc_feistel/mimc_feistel_gadget.hpp).
+*/
+template<size_t BRANCHES, size_t ROUNDS, size_t PASS_KEYS, typename KeySchedule = MimcRotateKeys>
+class MimcFeistel : public MimcFeistelParams
+{
+public:
+    using FieldT = libff::Fr<libff::default_ec_pp>;
+    using Bigint = libff::bigint<FieldT::num_limbs>;
+    using Bytes = FieldBytes<FieldT>;
+    using Ifma = FieldIfma<FieldT>;
+
+    static constexpr size_t BRANCHES_N = BRANCHES;
+    static constexpr size_t BLOCK_N = 2 * BRANCHES;
+    static constexpr size_t PASS_KEYS_N = PASS_KEYS;
+    static constexpr size_t PASSES_N = BLOCK_N / PASS_KEYS;
+    static constexpr size_t ROUNDS_N = ROUNDS;
+    static constexpr size_t TOTAL_ROUNDS_N = PASSES_N * ROUNDS_N;
+    static constexpr size_t FIELD_SIZE = 32;
+    static constexpr size_t BLOCK_SIZE = BLOCK_N * FIELD_SIZE;
+    static constexpr size_t DIGEST_SIZE = BRANCHES * FIELD_SIZE;
+    static constexpr size_t LANES = Ifma::LANES;
+
+    using State = std::array<FieldT, BRANCHES>;
+    using Block = std::array<FieldT, BLOCK_N>;
+
+    static_assert(BRANCHES >= 2, "A Feistel network needs 2 branches");
+    static_assert(PASS_KEYS > 0 && BLOCK_N % PASS_KEYS == 0, "Passes must cover the block");
+    static_assert(ROUNDS_N >= BRANCHES, "Not enough rounds");
+    static_assert(ROUNDS_N - 1 <= MIMC_CONSTANTS_N, "Not enough round constants");
+
+    // Round constants, as constant data in the Montgomery form of FieldT (no initialization)
+    static constexpr MontTable<FieldT> round_cf{MIMC_ROUND_MONT};
+
+    // Element of the block keying round r of pass p
+    static constexpr size_t key_index(size_t p, size_t r)
+    {
+        return p * PASS_KEYS + KeySchedule::key(r, PASS_KEYS);
+    }
+
+    MimcFeistel() = delete;
+
+    static inline void cube(FieldT &x)
+    {
+        FieldT t{x};
+        x *= t;
+        x *= t;
+    }
+
+    /*
+    The state is kept in place as the outputs of the last BRANCHES rounds: round t writes
+    s[t % BRANCHES], over s_{B-1} which it adds, and reads s_0 in s[(t - 1) % BRANCHES].
+    */
+    static inline void round(FieldT s[BRANCHES], size_t t, const FieldT &k)
+    {
+        FieldT x = s[(t + BRANCHES - 1) % BRANCHES];
+
+        x += k;
+        cube(x);
+        s[t % BRANCHES] += x;
+    }
+
+    static inline void round(FieldT s[BRANCHES], size_t t, const FieldT &k, const FieldT &c)
+    {
+        FieldT x = s[(t + BRANCHES - 1) % BRANCHES];
+
+        x += c;
+        x += k;
+        cube(x);
+        s[t % BRANCHES] += x;
+    }
+
+    // s_j is the output of round TOTAL_ROUNDS_N - 1 - j
+    static constexpr size_t state_index(size_t j)
+    {
+        return (TOTAL_ROUNDS_N - 1 - j) % BRANCHES;
+    }
+
+    static State hash_field(const Block &x)
+    {
+        init_ec_params();
+
+        FieldT s[BRANCHES]{};
+        State h;
+
+        for (size_t p = 0, t = 0; p < PASSES_N; ++p)
+        {
+            round(s, t++, x[key_index(p, 0)]);
+            for (size_t r = 1; r < ROUNDS_N; ++r)
+                round(s, t++, x[key_index(p, r)], round_cf[r - 1]);
+        }
+
+        for (size_t j = 0; j < BRANCHES; ++j)
+            h[j] = s[state_index(j)];
+
+        return h;
+    }
+
+    // Interleaved kernel with AVX-512 IFMA when the CPU has it, the scalar one otherwise
+    static void hash_field_xN(State h[LANES], const Block x[LANES])
+    {
+        static const bool use_ifma = CpuFeatures::get().avx512ifma;
+
+        init_ec_params();
+        if (use_ifma)
+            hash_field_xN_ifma(h, x);
+        else
+            hash_field_xN_scalar(h, x);
+    }
+
+    /*
+    Interleaved kernel: h[l] = hash_field(x[l]) for LANES independent messages. Every round is
+    applied to all the lanes before the next one, with a single load of its constant, so that
+    the multiplications of the lanes (independent chains) overlap in the pipeline.
+    */
+    static void hash_field_xN_scalar(State h[LANES], const Block x[LANES])
+    {
+        FieldT s[LANES][BRANCHES]{};
+
+        for (size_t p = 0, t = 0; p < PASSES_N; ++p)
+        {
+            for (size_t l = 0; l < LANES; ++l)
+                round(s[l], t, x[l][key_index(p, 0)]);
+            ++t;
+
+            for (size_t r = 1; r < ROUNDS_N; ++r, ++t)
+            {
+                const FieldT c = round_cf[r - 1];
+                const size_t k = key_index(p, r);
+
+                for (size_t l = 0; l < LANES; ++l)
+                    round(s[l], t, x[l][k], c);
+            }
+        }
+
+        for (size_t l = 0; l < LANES; ++l)
+            for (size_t j = 0; j < BRANCHES; ++j)
+                h[l][j] = s[l][state_index(j)];
+    }
+
+    // Same as hash_field_xN_scalar, with the lanes in AVX-512 IFMA registers (FieldIfma)
+    CPU_TARGET(IFMA_TARGET)
+    static void hash_field_xN_ifma(State h[LANES], const Block x[LANES])
+    {
+        const Ifma::Constants &c = Ifma::constants();
+        const Ifma::Limbs *rc = MIMC_ROUND_IFMA;
+        Ifma::Vec vx[BLOCK_N], s[BRANCHES], t;
+        FieldT lanes[LANES];
+
+        for (size_t i = 0; i < BLOCK_N; ++i)
+        {
+            for (size_t l = 0; l < LANES; ++l)
+                lanes[l] = x[l][i];
+            Ifma::load(vx[i], lanes, c);
+        }
+
+        for (size_t j = 0; j < BRANCHES; ++j)
+            for (size_t i = 0; i < Ifma::LIMBS; ++i)
+                s[j].l[i] = _mm512_setzero_si512();
+
+        for (size_t p = 0, n = 0; p < PASSES_N; ++p)
+        {
+            t = s[(n + BRANCHES - 1) % BRANCHES];
+            Ifma::add(t, vx[key_index(p, 0)], c);
+            Ifma::cube(t, c);
+            Ifma::add(s[n++ % BRANCHES], t, c);
+
+            for (size_t r = 1; r < ROUNDS_N; ++r, ++n)
+            {
+                t = s[(n + BRANCHES - 1) % BRANCHES];
+                Ifma::add(t, rc[r - 1], c);
+                Ifma::add(t, vx[key_index(p, r)], c);
+                Ifma::cube(t, c);
+                Ifma::add(s[n % BRANCHES], t, c);
+            }
+        }
+
+        for (size_t j = 0; j < BRANCHES; ++j)
+        {
+            Ifma::store(lanes, s[state_index(j)], c);
+            for (size_t l = 0; l < LANES; ++l)
+                h[l][j] = lanes[l];
+        }
+    }
+
+    static void hash_oneblock(uint8_t *digest, const void *message)
+    {
+        init_ec_params();
+
+        Block x;
+
+        for (size_t i = 0; i < BLOCK_N; ++i)
+            x[i] = Bytes::to_field((const uint8_t *)message + FIELD_SIZE * i);
+
+        State h = hash_field(x);
+
+        for (size_t j = 0; j < BRANCHES; ++j)
+            Bytes::from_field(digest + FIELD_SIZE * j, h[j]);
+    }
+
+    // Hash n <= LANES independent blocks, blocks[i] into digests[i] (unused lanes hash zeros)
+    static void hash_oneblock_xN(uint8_t *const digests[], const void *const blocks[],
+                                 size_t n = LANES)
+    {
+        init_ec_params();
+
+        Block x[LANES]{};
+        State h[LANES];
+
+        for (size_t l = 0; l < n; ++l)
+            for (size_t i = 0; i < BLOCK_N; ++i)
+                x[l][i] = Bytes::to_field((const uint8_t *)blocks[l] + FIELD_SIZE * i);
+
+        hash_field_xN(h, x);
+
+        for (size_t l = 0; l < n; ++l)
+            for (size_t j = 0; j < BRANCHES; ++j)
+                Bytes::from_field(digests[l] + FIELD_SIZE * j, h[l][j]);
+    }
+
+    static void hash_many(uint8_t *out, const uint8_t *in, size_t n)
+    {
+        hash_many_lanes<MimcFeistel>(out, in, n);
+    }
+
+    static void hash_pairs(uint8_t *out, const uint8_t *left, const uint8_t *right, size_t n)
+    {
+        hash_pairs_lanes<MimcFeistel>(out, left, right, n);
+    }
+
+    static void hash_add(void *x, const void *y)
+    {
+        for (size_t i = 0; i < BRANCHES; ++i)
+            Bytes::add((uint8_t *)x + FIELD_SIZE * i, (const uint8_t *)y + FIELD_SIZE * i);
+    }
+};
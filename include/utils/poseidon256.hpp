@@ -0,0 +1,238 @@
+#pragma once
+
+#ifndef CURVE_ALT_BN128
+    #define CURVE_ALT_BN128
+#endif
+
+#include "utils/ec_params.hpp"
+#include "utils/field_bytes.hpp"
+#include "utils/field_ifma.hpp"
+#include "utils/hash_batch.hpp"
+#include "utils/poseidon_constants.hpp"
+
+#include <array>
+#include <libff/algebra/curves/public_params.hpp>
+#include <libff/common/default_types/ec_pp.hpp>
+
+/*
+Poseidon over the scalar field of BN254: state of WIDTH = 3 elements, S-box x^5, 8 full rounds
+and 57 partial rounds, with the constants of the reference implementation (generated by
+utils/poseidon_constants.py). A block is two field elements x, y and the digest is the first
+element of the permutation of (0, x, y), the same as Poseidon([x, y]) of circomlib.
+*/
+class Poseidon256
+{
+public:
+    using FieldT = libff::Fr<libff::default_ec_pp>;
+    using Bigint = libff::bigint<FieldT::num_limbs>;
+    using Bytes = FieldBytes<FieldT>;
+    using Ifma = FieldIfma<FieldT>;
+
+    static constexpr size_t BLOCK_SIZE = 64;
+    static constexpr size_t DIGEST_SIZE = 32;
+    static constexpr size_t WIDTH = POSEIDON_T;
+    static constexpr size_t FULL_ROUNDS_N = POSEIDON_RF;
+    static constexpr size_t PARTIAL_ROUNDS_N = POSEIDON_RP;
+    static constexpr size_t ROUNDS_N = FULL_ROUNDS_N + PARTIAL_ROUNDS_N;
+    static constexpr size_t LANES = Ifma::LANES;
+
+    using State = std::array<FieldT, WIDTH>;
+
+    // Constants, as constant data in the Montgomery form of FieldT (no initialization)
+    static constexpr MontTable<FieldT> round_cf{POSEIDON_C_MONT};
+    static constexpr MontTable<FieldT> mds{POSEIDON_M_MONT};
+
+    /*
+    libff parameters for FieldT, ready before main(). The hash functions also initialize them on
+    first use, for static initializers of other translation units.
+    */
+    static inline const bool params_init = init_ec_params();
+
+    Poseidon256() = delete;
+
+    // The first and last FULL_ROUNDS_N / 2 rounds apply the S-box to the whole state
+    static constexpr bool is_full_round(size_t r)
+    {
+        return r < FULL_ROUNDS_N / 2 || r >= FULL_ROUNDS_N / 2 + PARTIAL_ROUNDS_N;
+    }
+
+    static inline void sbox(FieldT &x)
+    {
+        FieldT t = x.squared();
+
+        t = t.squared();
+        x *= t;
+    }
+
+    static inline void mix(State &s)
+    {
+        State t;
+
+        for (size_t i = 0; i < WIDTH; ++i)
+        {
+            t[i] = mds[i * WIDTH] * s[0];
+            for (size_t j = 1; j < WIDTH; ++j)
+                t[i] += mds[i * WIDTH + j] * s[j];
+        }
+        s = t;
+    }
+
+    static void permute(State &s)
+    {
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            for (size_t i = 0; i < WIDTH; ++i)
+                s[i] += round_cf[r * WIDTH + i];
+
+            if (is_full_round(r))
+                for (size_t i = 0; i < WIDTH; ++i)
+                    sbox(s[i]);
+            else
+                sbox(s[0]);
+
+            mix(s);
+        }
+    }
+
+    static FieldT hash_field(const FieldT &x, const FieldT &y)
+    {
+        init_ec_params();
+
+        State s{FieldT::zero(), x, y};
+
+        permute(s);
+
+        return s[0];
+    }
+
+    // Interleaved kernel with AVX-512 IFMA when the CPU has it, the scalar one otherwise
+    static void hash_field_xN(FieldT h[LANES], const FieldT x[LANES], const FieldT y[LANES])
+    {
+        static const bool use_ifma = CpuFeatures::get().avx512ifma;
+
+        init_ec_params();
+        if (use_ifma)
+            hash_field_xN_ifma(h, x, y);
+        else
+            hash_field_xN_scalar(h, x, y);
+    }
+
+    /*
+    Interleaved kernel: h[l] = hash_field(x[l], y[l]) for LANES independent messages, every step
+    of a round being applied to all the lanes before the next one.
+    */
+    static void hash_field_xN_scalar(FieldT h[LANES], const FieldT x[LANES],
+                                     const FieldT y[LANES])
+    {
+        State s[LANES];
+
+        for (size_t l = 0; l < LANES; ++l)
+            s[l] = {FieldT::zero(), x[l], y[l]};
+
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            for (size_t i = 0; i < WIDTH; ++i)
+            {
+                const FieldT c = round_cf[r * WIDTH + i];
+
+                for (size_t l = 0; l < LANES; ++l)
+                    s[l][i] += c;
+            }
+
+            for (size_t i = 0; i < (is_full_round(r) ? WIDTH : 1); ++i)
+                for (size_t l = 0; l < LANES; ++l)
+                    sbox(s[l][i]);
+
+            for (size_t l = 0; l < LANES; ++l)
+                mix(s[l]);
+        }
+
+        for (size_t l = 0; l < LANES; ++l)
+            h[l] = s[l][0];
+    }
+
+    // Same as hash_field_xN_scalar, with the lanes in AVX-512 IFMA registers (FieldIfma)
+    CPU_TARGET(IFMA_TARGET)
+    static void hash_field_xN_ifma(FieldT h[LANES], const FieldT x[LANES], const FieldT y[LANES])
+    {
+        const Ifma::Constants &c = Ifma::constants();
+        Ifma::Vec s[WIDTH], t[WIDTH], u;
+        FieldT zero[LANES]{};
+
+        Ifma::load(s[0], zero, c);
+        Ifma::load(s[1], x, c);
+        Ifma::load(s[2], y, c);
+
+        for (size_t r = 0; r < ROUNDS_N; ++r)
+        {
+            for (size_t i = 0; i < WIDTH; ++i)
+                Ifma::add(s[i], POSEIDON_C_IFMA[r * WIDTH + i], c);
+
+            for (size_t i = 0; i < (is_full_round(r) ? WIDTH : 1); ++i)
+            {
+                u = s[i];
+                Ifma::mul(u, u, c);
+                Ifma::mul(u, u, c);
+                Ifma::mul(s[i], u, c);
+            }
+
+            for (size_t i = 0; i < WIDTH; ++i)
+            {
+                t[i] = s[0];
+                Ifma::mul(t[i], POSEIDON_M_IFMA[i * WIDTH], c);
+                for (size_t j = 1; j < WIDTH; ++j)
+                {
+                    u = s[j];
+                    Ifma::mul(u, POSEIDON_M_IFMA[i * WIDTH + j], c);
+                    Ifma::add(t[i], u, c);
+                }
+            }
+            for (size_t i = 0; i < WIDTH; ++i)
+                s[i] = t[i];
+        }
+
+        Ifma::store(h, s[0], c);
+    }
+
+    static void hash_oneblock(uint8_t *digest, const void *message)
+    {
+        init_ec_params();
+
+        FieldT x = Bytes::to_field(message);
+        FieldT y = Bytes::to_field((const uint8_t *)message + DIGEST_SIZE);
+
+        Bytes::from_field(digest, hash_field(x, y));
+    }
+
+    // Hash n <= LANES independent blocks, blocks[i] into digests[i] (unused lanes hash zeros)
+    static void hash_oneblock_xN(uint8_t *const digests[], const void *const blocks[],
+                                 size_t n = LANES)
+    {
+        init_ec_params();
+
+        FieldT x[LANES]{}, y[LANES]{}, h[LANES];
+
+        for (size_t l = 0; l < n; ++l)
+        {
+            x[l] = Bytes::to_field(blocks[l]);
+            y[l] = Bytes::to_field((const uint8_t *)blocks[l] + DIGEST_SIZE);
+        }
+
+        hash_field_xN(h, x, y);
+
+        for (size_t l = 0; l < n; ++l)
+            Bytes::from_field(digests[l], h[l]);
+    }
+
+    static void hash_many(uint8_t *out, const uint8_t *in, size_t n)
+    {
+        hash_many_lanes<Poseidon256>(out, in, n);
+    }
+
+    static void hash_pairs(uint8_t *out, const uint8_t *left, const uint8_t *right, size_t n)
+    {
+        hash_pairs_lanes<Poseidon256>(out, left, right, n);
+    }
+
+    static void hash_add(void *x, const void *y) { Bytes::add(x, y); }
+};
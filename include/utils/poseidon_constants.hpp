@@ -0,0 +1,438 @@
+// Generated by utils/poseidon_constants.py, do not edit
+#pragma once
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+
+/*
+Poseidon parameters for the BN254 scalar field r, in Montgomery form:
+- POSEIDON_C_*[r * POSEIDON_T + i]: round constant of round r, state element i
+- POSEIDON_M_*[i * POSEIDON_T + j]: MDS matrix, row major
+*_MONT: x * 2^256 mod r, 4 little-endian limbs of 64 bits (libff::alt_bn128_Fr)
+*_IFMA: x * 2^260 mod r, 5 little-endian limbs of 52 bits (FieldIfma)
+*/
+static constexpr size_t POSEIDON_T = 3;
+static constexpr size_t POSEIDON_RF = 8;
+static constexpr size_t POSEIDON_RP = 57;
+static constexpr size_t POSEIDON_C_N = (POSEIDON_RF + POSEIDON_RP) * POSEIDON_T;
+
+alignas(64) inline constexpr uint64_t POSEIDON_C_MONT[POSEIDON_C_N][4] = {
+    {0x83bbbac36534a858, 0x0971619601250a07, 0x27a219050e23910c, 0x1638bf18c8507442},
+    {0x5e2bb0e6bb25631a, 0x56b042b8def5875e, 0x01bc3e10a8e9b451, 0x17bfe16092ef1d7e},
+    {0xa4fef9b954508d89, 0xafeb6b7d4ee4c69e, 0xd8ebe8a7fc301c39, 0x1840976e07ad780c},
+    {0x18b8e553a04b72cb, 0x4d654fb8ec90df10, 0x3f8dafc39d1b9658, 0x1a72c6a50e4e6a8a},
+    {0x44f18fdd12c7177a, 0x43d28a9b520bd0ee, 0x440b83130192f008, 0x13c53f3b277b2fde},
+    {0xfc116b6c9e33b756, 0x933e67d042eb5320, 0xabc0d9f2c9d9bdcf, 0x23b0bd1fabcb64b0},
+    {0xde8ebdf8535243af, 0x1e851377b3d81387, 0xdfa4b107ef127fb9, 0x1e12da839a042314},
+    {0xe25ff0a9dd264f6b, 0x0215e509d49d08b2, 0xc2cf093542425093, 0x0baaf53d85cb02e0},
+    {0x6eaa462f90cf8115, 0xaf07e5d221dd2e13, 0x9a0b65abec88aa63, 0x1fcea175624b262f},
+    {0x99aa70f04fe89c1e, 0xdc11129d80826695, 0x1a68006fcc353aee, 0x299ea7eabe5d4996},
+    {0x413df2c8c5541138, 0xeb469618c9de6bb3, 0x1a668e52b76fe275, 0x0fed7116657d8da5},
+    {0x4c5cd4085911f6df, 0xa69c3b9c95ae98e6, 0xf308d88c93d19608, 0x079c79c9cffd5ad4},
+    {0xdd5d50a6115b6ae6, 0x3e2079ce31994482, 0x0beac0a93142d7a6, 0x29838a07888323b4},
+    {0x3031a7c21bf4f9f8, 0xf093c1cc653a991a, 0x092a0cd128aac7c2, 0x1e230e4aa7c4c266},
+    {0x2a72b06d29407105, 0x281dbf7148ac7771, 0x175c5083bc22a44d, 0x08c912947cf53b92},
+    {0x7eb180a889ee3c2d, 0xd38343a986d44c8c, 0x286bdbe0472b1d0e, 0x24f6be203117cc53},
+    {0xe221229550b8eb66, 0x9ffe52fabfc796eb, 0x1b9eef2ed361ed14, 0x0c575104fa7034f4},
+    {0xf9b28f842a2e4643, 0x4d5c080bd2ca1317, 0xcd76ae812c271eb9, 0x0ea4878f3b96e943},
+    {0x1b12a0ead7ee00cd, 0x794461ec0d8acd32, 0x3abb3e24c75e20a7, 0x27cb85854f2c16db},
+    {0xc34a0ce29e5c844a, 0xbae3900198f23f61, 0xf582e09985e6d0c4, 0x055c6d26a35cf2de},
+    {0x33e1751f74f74c21, 0xdef83f5279f2ec1a, 0x3ce7d0bd374490ba, 0x0eecc29342805119},
+    {0xe45772c6259d3e58, 0x4c683f93ebeab683, 0xfb8c13b607a4642e, 0x2e3e8ef03eeaed41},
+    {0xd197c44c630c5eb4, 0x053857ab70186b79, 0x18ee44c7bdb0d26a, 0x18b94e2583a0557b},
+    {0xd27736b000acdc77, 0x258b4b227cbcb7f5, 0x40df2e84269de616, 0x209aa4bbc966b500},
+    {0x5aafe5dc0720254f, 0x0e91a580f18d1016, 0x11a00abff154d5b7, 0x28083140319b0d09},
+    {0x624ed13efd7f2bca, 0xcc9e53bcf2c28b13, 0x7ca39c04d885ccfa, 0x032c7e9c1ed0d643},
+    {0xbee575ac208c3258, 0x8976d09923790363, 0xeac3c4d39b58eaaf, 0x28585586ade6e3d5},
+    {0x275e64927c987248, 0x1023453306381ce9, 0xd90511a7cb2159f6, 0x2997881a59a4151b},
+    {0x96ea7b645b7ee005, 0x12e49ee4759a80d5, 0x3ff0710c0c7c209c, 0x1207d4f65a29a973},
+    {0x225570d6a943095f, 0xa11ab5832d54aa69, 0x5ed544b9dc72feac, 0x16ba83b29fa0dfde},
+    {0xd35fe784498f8347, 0x448e2c74dc5c310b, 0x8bc35d4158df81d3, 0x11a01d27b058a3b8},
+    {0xcf4dac5594af2d83, 0xc6f6531b8cc21243, 0x6e65adc157b9548f, 0x082a1067f00d6dfb},
+    {0x173fc30b103a6dcf, 0xc91b63e498d301c3, 0xb8f7ea4064eea1f2, 0x06548827d7df35e4},
+    {0xf1dcdd1866e91665, 0xaf44edb31bfcc76e, 0x69a2f851bc5fdeb1, 0x16a3add7fd6847e5},
+    {0x277fa19569af0ab3, 0x28e4a94421550cd3, 0x8b1893dc1510def2, 0x152b3eebf2e3b9af},
+    {0x82a43eaade461743, 0x4bd307501a719bfd, 0x94e914f0f35fb5ea, 0x2d45e6c07093f3ec},
+    {0x1307c7dfcdec9d68, 0x569ed7de9138f494, 0x3345109c6374a0b6, 0x21b5a1904b9d9fa1},
+    {0xeb775b5909a98dc7, 0x54a57335128a23bf, 0x5b11e52888015162, 0x212a6cfdd608fde8},
+    {0x4c04265f18d146f1, 0x10d10bc4c7853d4e, 0xa8e2a51db14f2f2c, 0x0f5fd95645106055},
+    {0x68dd43d7b51c37dd, 0x1e46476089e1d073, 0x58e04cf38f805754, 0x0b0bbf5b8688b08b},
+    {0x1b14f57c4122a309, 0xe02913572e132548, 0x8d3c17048b7c32db, 0x22434cd0616dbf37},
+    {0xa0a5d482a6154db8, 0xd1c8cb01ba422f45, 0xb8a57919e05a3d45, 0x285a24a238af96cb},
+    {0x1aaa1405fafbd364, 0xb8d8b685230034b7, 0x0b7aef992fcc0854, 0x28d85f4b9f36af66},
+    {0x21fc148d2efde136, 0xc0a3008d29eeb0a8, 0xf3914ca16745a3c9, 0x0856523236dd2341},
+    {0xa14a336112fbf9f3, 0xb1ff289ba2eae970, 0x32a2feccaf57f78d, 0x003726ecc0267f6c},
+    {0x65e4051e623a8231, 0x3de6d47d48c406d3, 0xa9bbd406bdb8ead2, 0x0d600d159a165a0c},
+    {0x50648feb424d5e04, 0x78694de6ef267969, 0x5aa8b3580718f950, 0x1b044d4e05de9b70},
+    {0x2a796e5ea8f4e119, 0x946bbb44d739483a, 0xe21604d22b7ff1bb, 0x0c4327027869e663},
+    {0xe85e117615b09542, 0x96ce582e170967b3, 0x065b39840af36d54, 0x11b11f0e477f05b0},
+    {0x0d74f0994cb254bf, 0x4f4e4871fc63bd6d, 0x89d7b727ebdad559, 0x2cf20283390eb822},
+    {0xa30b526823bdb058, 0x886bb7b6f8eccd0d, 0x1f437e6dbc295914, 0x29ad2879e6833325},
+    {0xec3b39410fe43a5d, 0x3fb9d90ddcfa176a, 0x5fcaa229a47556d0, 0x07a583162e51b6d8},
+    {0x5b3fe2630608396e, 0x1e4496112e954403, 0x855a9daaa37c42a9, 0x10f643f4b4fa5128},
+    {0x28590d0004f98e35, 0xe13a159fc2cc8cf6, 0x8d22be85be68317a, 0x085a637b8618db96},
+    {0x5588c6954188d4d5, 0x28bdcaed360f0373, 0x67cc7a411974cf44, 0x27ab756e2cc849ac},
+    {0x32a0c18f088e99ad, 0x22795c50dd9cc1f3, 0x39c0855c6dc26a51, 0x12388feb2e428a82},
+    {0xaddbd56d19cb859c, 0x2f7ceda49032fb62, 0xebdf3719874c459e, 0x036d7aa8bc44149d},
+    {0x2caa41d785b941c8, 0x971e4e4c154f2c6b, 0x7874a8d468e0e6c8, 0x07b4735d54f5d234},
+    {0x01f51a3aa044c8f2, 0x7a636b4bfcab2c29, 0xb31eb377a96a00ce, 0x0f0c53f00bb104ac},
+    {0xd79328003e9566e7, 0xed5f36c07d3074ba, 0x8a2da6c60a9e4cb8, 0x28bd60c78f4c27c2},
+    {0xfffebd8720631bbc, 0x8efe2a4219d8aba5, 0x6bdf4ded7ef1b62d, 0x1ff6c9e06d6cf68e},
+    {0x22a696d457b8106d, 0x8b98ffed5d4905f8, 0x5edf9329bbef0232, 0x1392824c46ea4c39},
+    {0xab107cfef787c8a0, 0x278e7c4207fb3230, 0x99b9ea6ce46d8256, 0x0d682fd0fb31a00e},
+    {0x4ecef90fb11c850c, 0x84e45781c9eec3a9, 0x8ec25128e2f1f4f8, 0x2a2c1a8412a70cce},
+    {0x8f369a4d332e2cc7, 0xb22c513234251590, 0x706ac3aeb811231f, 0x19740e5e8ade8979},
+    {0x221080f029f28b75, 0xa437450974cb1e94, 0x87926f33c69f3da2, 0x029cf616ee2ad166},
+    {0x02442c4fee11e91d, 0x5dc410e07fdcbe17, 0x1a867232b63d9457, 0x1a1c9a07b2782748},
+    {0x1edb82dae474f114, 0xd3bc7df0735a0a00, 0x03b3817d280da899, 0x0701ed4f517f4c79},
+    {0xe14d649a6bf08497, 0xa3ea3ec2fba171b1, 0x8f61083e65c736bd, 0x1ac1a9fdf38c7ebb},
+    {0xcf49198274ef25d7, 0x562c05e01036644e, 0x3f41976e276e258c, 0x1f5be530194ef994},
+    {0x82c0529d3b0c6560, 0xce8537e7cb3d788c, 0x92494f9d3bd8e8bc, 0x132c81f43fd33e53},
+    {0x3f40cc1629cd3111, 0xb9f9665b8d257da8, 0x185f61f8e8e16198, 0x021adba7bd33ab21},
+    {0x342f2a113fd36130, 0x9ceccbd5349c530a, 0x617bd57533444841, 0x1648cdf733eee1d3},
+    {0x9efbd552827fcf73, 0xfaebeb1c6ab69375, 0x464172e7be8e88a8, 0x0847931e0d042c0f},
+    {0x120193648a28dc6c, 0x988a6302e7370526, 0xa78edb0d97474b0c, 0x19959641a1b547fa},
+    {0x8e6dfb112427c2d2, 0x20c25819e588e384, 0x1d88377d30897cb6, 0x2a508af373b9729a},
+    {0x1d14c873ddc51680, 0x0e0da86908009656, 0xbf4ec9ba1340d6a4, 0x0098bdf65a0afb9c},
+    {0x50d73614f3243e60, 0x45209e69e50c537e, 0xbf44d99fc759be13, 0x279f34df0724a583},
+    {0x219cffe63c3aa682, 0xa6dd59c7425acf48, 0x444cb706acccec8f, 0x2e8c17deff5b9dd4},
+    {0x9997c91436bf5d0b, 0x1629fb48677678be, 0x49c4d97bdb9eb29a, 0x2035dd09daa0d61e},
+    {0x10168e7c8e51546b, 0x507ec1516ab22d0c, 0x1a194fcaa4bf09c0, 0x0c637dc86849f4fd},
+    {0x57fe04691ea6f531, 0x2190682e353d037b, 0x72e47ef9e904d3b9, 0x211f475dfb3c75ed},
+    {0x7e838b86503617d0, 0xe6bad1948ae1955e, 0x707e58fad5b30483, 0x0a0972982b764b31},
+    {0x03bb8a08fc34185c, 0x7697ad2d4d810bfd, 0xfd12136fc816f501, 0x120d076c88279b56},
+    {0xee24105eeb22800c, 0xb7cbe7af82283d5e, 0x6191e1e38cd71bb5, 0x1aeaf2e491efd9a9},
+    {0xa04e07018cc9237a, 0x5361733b3151e0b6, 0x40e61ee38ddf97c3, 0x227af916f8b30fd4},
+    {0x3a89c2121dbc8729, 0xbc8fbdb3d8db1a87, 0xe86e48af8d840b86, 0x2ce7a4cb0acf31c8},
+    {0x5034a090dc3af464, 0x6ed46f82617008aa, 0x358e71ffd819f7e3, 0x26c8080ae116e13b},
+    {0x788952cfb8b52e37, 0xefc72a5be7fb7fbc, 0xc77bac4f9459447a, 0x001040af8a6d261e},
+    {0x16e6d600d2ff7426, 0xca5f5816acfc9401, 0xe38beefe9a0e0072, 0x21938b191a7bc331},
+    {0xd5b44d21a21f9297, 0x86167973aa7d0743, 0x79bd6f4550d4e54f, 0x03cfdb40ac6940ca},
+    {0x9c929ba1d69d55fc, 0x87d64dfc151271ae, 0x2d27e3179fac9536, 0x1a90b4df9101e879},
+    {0x7499664fc0ebe7ec, 0x09716f8e84931303, 0x4cc0dccb94634b45, 0x1a32f5ff8519e33c},
+    {0x870877b73b9bcaa9, 0x1881870f75379e4f, 0x9f3f06e451a7e672, 0x1151fe3bb41dcb29},
+    {0x0b7cb1a81cac0430, 0x271f481c441f88f9, 0xeda16949984a6294, 0x073cc8fe043bb91c},
+    {0x5d4c4bfe348cbfe4, 0xcfd654c4476c9489, 0xdd48f53cf0b1efcd, 0x06c975ea69621011},
+    {0x39fb6c74184c9024, 0x80e79b39a143fe21, 0xb1253d509d48cbfc, 0x1a4900be8c52124d},
+    {0x190a59d14d51b5c0, 0xa444e21ad8bdb73a, 0xb2259807fe061798, 0x271a2e9bbfcf2f6a},
+    {0xc0af13dc96417133, 0x1cb1c8979c88420d, 0x353f8e5673b9f841, 0x0ad2874818ce1183},
+    {0x5eae10d5fd0f7d29, 0x7da0cc2beaa853e4, 0xb844b04ad2a3b6e2, 0x0b184f0b40c038ee},
+    {0xe5e995b4b1d54591, 0x19548f28b12e5099, 0xe0da5976f40f1c72, 0x1c55359d2d014456},
+    {0x68c411465f6f87d8, 0xa3a18882c980c957, 0x5c79518c4fabcf20, 0x26edc29497bc5cb3},
+    {0xb50f63c3948b6732, 0x9c160bd71ae1dbb4, 0x24cfd9385abff66a, 0x02063a7ceced9ea6},
+    {0xdb0cbc35d22245b0, 0xfe86319a55232e6d, 0x6105fbfdf3add538, 0x2c2dc27c38d94255},
+    {0xf1895d988a8c8995, 0xdedefbad0c1b5a82, 0x5f3fb8bc0bd416d8, 0x0e2a4c7d21d78dc2},
+    {0x72f59f40b87cd518, 0x619b20e02d8b3ee3, 0xd6ebb896f7d9329f, 0x211c1fdf6141dd3a},
+    {0xd6e372c64f54c992, 0x99827b2bf785abe0, 0xb67492d94fbeae14, 0x0288174a915f1cb7},
+    {0x0cee89601a4ad1c5, 0x66dee7acd570e8b4, 0x237331b25471fc2c, 0x0f79a3dc068020d0},
+    {0x898fee0b8f31bc12, 0x5c8954aa2da1961c, 0x77326678c3da12af, 0x144313217a7f389f},
+    {0x05f342cad3b4864a, 0xe2c7d39d0656a010, 0x61b8bef5da62a23f, 0x195806ad7b6696ef},
+    {0x76c6fbf50cbdef02, 0xf535ea975a6b40f4, 0x0c5fe2383fe86bce, 0x117abeb34b8688b9},
+    {0x722fcd9132e35924, 0x8d991c0f2fa40665, 0xab060365a33bc385, 0x0b61468d5f2060aa},
+    {0xf37de77a8f1be22a, 0x427159a97577781e, 0x14e99813266148d9, 0x138e8d0f0e5be0c4},
+    {0xe1543733c9bb6fc7, 0xd8c9704535e21c8c, 0xd433edc282de438c, 0x11466ae0f81b3763},
+    {0x2cbd8cdb39524874, 0xf9855b644afce00e, 0xb290cb62abfbd66c, 0x25acd478b1084494},
+    {0x8ebc6672b41dcee8, 0x606f0745849196a1, 0xe55ae090bd88d82a, 0x009470554167249d},
+    {0x062094bcc7a6418b, 0x2803495b8583c637, 0x53eb48b97437c010, 0x0c7a1222e9138165},
+    {0x27eab79c36018a4e, 0xbd1864c1d0c4068d, 0xf902113a25a237e3, 0x128d87abeb1e9c1f},
+    {0xdb7fc417f7652d14, 0x58bd4f3aaac09e67, 0x728f58664d60e85c, 0x0f85a634b96fdda0},
+    {0xe32fe000e302eadc, 0x7d23c3dd3c7df083, 0x5bd45107b443a012, 0x2acca27428d1a73c},
+    {0xbf727ded10944264, 0x4ebf249fe7df1f42, 0x9ae7e1ea5448317c, 0x098478d1386f06d1},
+    {0x41702faeb62c6d90, 0x5dea60565d31eda6, 0x99144c98f362ec45, 0x0666d88648f73f04},
+    {0x83b3ca7e199d699c, 0x32ebc3b0c43d5f81, 0x14a61edd1a1d5f6b, 0x2cb5c8fea1103978},
+    {0x5d05e3ae54a68bc4, 0x4faa9d463460a6f2, 0x7f3ed5cd074f3aaf, 0x2d280f20dae67de3},
+    {0xd2efe4ca6dada240, 0x85c3424c91e6e450, 0x67ded928e819912f, 0x2a47110115ad187e},
+    {0xfd689c88325914ba, 0x217ccba0c4f678a8, 0x775c3aa0caac332b, 0x0237eeffadb3dc0b},
+    {0x951cba230d48ab5a, 0xac60fef56f7dcd80, 0xee0e118c667a107a, 0x286963de12abebeb},
+    {0xd5bf474c37545102, 0x8df0210724a7bbf7, 0x2869e00fd06cee5c, 0x10a5a9a9e9679a80},
+    {0xb756d548a7c1fc31, 0x91a8ff87ec937a72, 0xc052832f337e9900, 0x0529844a975226c0},
+    {0xd6bd6219ea723ea7, 0xb15ef75a47a73dbc, 0xce0d24f3bcdba423, 0x00f2c9c00b75da95},
+    {0x8839b8e43934561b, 0xeed5c479997614af, 0x8e13af4ce37ec975, 0x1c11b1381a0da7d1},
+    {0xf38903221b52a70d, 0x57941bad5616f0b4, 0x79e0e60ac24d695a, 0x28196a6e4dc51202},
+    {0x064ebe0c3dd24eb6, 0x3802fd84feb04f9d, 0x86b2d2b0907fa843, 0x2c574ff686c617aa},
+    {0x4350bfc9d26b3c37, 0x21c07f7c582555a7, 0xc26f0a1a39e61d98, 0x23e04b5b20773885},
+    {0x9ecdf0801c4960f1, 0x90455ea0aa5c29bd, 0x7a4f7128a78bbda6, 0x08a72f2200068a14},
+    {0x8e78423055561239, 0xc68657f8b6a9b0c3, 0x3c1f30023e9a9859, 0x020a5307957c386b},
+    {0xc2b2ec89df413870, 0x698417646a3cbfa5, 0x85b88d3108e46241, 0x1153cf64cd3c1731},
+    {0xd3c742f41b1facfd, 0x48cc11f7ce5600d8, 0xd924a20425ad06ca, 0x2b92d896b64a36f0},
+    {0x47e3641e16232e80, 0xb5b83d38f4118ce6, 0x9c757d818e9fe957, 0x0f040021849b01ec},
+    {0xbf3cd76e39709602, 0xe2d93e6cf717615f, 0x4e5f8607aa4aa483, 0x1fcceb2264ae4e31},
+    {0xcad7b25f437a38d9, 0xf66dcd4743bd617a, 0x75627910ca985f41, 0x1c2d962253a27827},
+    {0x3eca0791994cce65, 0x059234b17e8476d9, 0x8403f0cd92adc262, 0x2116c5244c9f73b9},
+    {0x7ebcbcd0ece065e3, 0xc1a06905a0139ff9, 0xf0e0a214eafcce74, 0x102221a24bb3f1ad},
+    {0xc73946d2fd0793c6, 0xd684e968a7714ca9, 0x4516892656a0badd, 0x2bb1a1d769bcf7e8},
+    {0x6b45148d7b52e3c9, 0x030bfb6edf8c0734, 0x78374b448edd38c4, 0x05ba2d1f46a5b689},
+    {0x96a850062bca34d6, 0x1af76c923852014e, 0xad93ce5cfda5d027, 0x1c592caf1ab3d348},
+    {0xafbb1743f0bb4932, 0x6a7696e10bda8c0c, 0x07a07831609bf58e, 0x2d35e80598271115},
+    {0xdc24c33ffdafcabc, 0xf4dd4a38331852d4, 0x5ed1b79ac97e8d89, 0x07fcc7dca8d2fa83},
+    {0xe41041004d1b83f0, 0x09933bdb3497d06a, 0xa3a268100bbdd441, 0x2dacd4f6ccf638f4},
+    {0x41e818cce281e4e9, 0xdacb05da4c9f0b3c, 0x9c98e80797123b9e, 0x05c2785171cf9893},
+    {0x8bb70713661dd3ef, 0xa3219b41e1e866e4, 0x4841aeae94dbafcb, 0x1f04ab075b343c2e},
+    {0x09877b99da1ed4d8, 0x3e1b13bebb562ab7, 0xfd0a453abc796707, 0x1b08caf18fe542b6},
+    {0x8772776c35ed4ddb, 0xd1e483c46dca8f20, 0x3d6ef5b0ece3cb77, 0x04350d60ac3cdeda},
+    {0xd59789d52dfd828d, 0xd0d4f5c7c7c66b69, 0x4184bf91b5309734, 0x0e09dedd81137365},
+    {0x3c46a5ad6730c5ce, 0x5c7bd37bda525007, 0xd57d1e170a707411, 0x13e189b521197bdd},
+    {0xa6343ee1f304a26f, 0xca33c793d2ba7228, 0x25dad12500d4d448, 0x09cf827625852c46},
+    {0x797a8602c63a54d9, 0x1ac2bc433aa0e827, 0x7c3fbe7f580b7789, 0x03174635b882d894},
+    {0x4f16dab5318908d8, 0x618709ae9bb33e9b, 0x79f6ce9d1fcccdb9, 0x2a42c258663e5559},
+    {0x9352c66f8db85bed, 0xf76a6cfc91216ae2, 0xecadbbeeab6ddeba, 0x0501860d019acbef},
+    {0x33bbf7559b633bea, 0x59bc392c36c8c252, 0x13a0563e80b1aebc, 0x15fa97680663b761},
+    {0xd34b76cc7ce56662, 0x4637562052f0c797, 0x121bc99292d6f09e, 0x0a694fce552ddc2d},
+    {0x2c91b8df8e961db5, 0xe0847837f14b5eb8, 0xdfa9bfc0600b988a, 0x0e88c05fa2dd61ec},
+    {0x062b0126d1594ed2, 0xf6b8ef949360c8f3, 0x88685c33681f9b19, 0x057ca2cedc6147f2},
+    {0xbc4cb8237d1d6988, 0x40a88f0ac02628ed, 0x38d89898d686d929, 0x2333cd11b0515c31},
+    {0xb242031f673208b5, 0x144ef3dff309ec58, 0x74d56678e4dc599f, 0x2ca99301804984ef},
+    {0x5131dba233a4bed1, 0x8a8e1b36d8400bac, 0x21e59e8865901cd2, 0x0e5c8ec6f3fab0a5},
+    {0x2a4bb5fd88edc047, 0x5b86f3ebc68d0c2a, 0x54882f2a5688b04f, 0x05a94e75507cbe33},
+    {0x2b1caac2f8ecdb92, 0x1fc9ccb8dee0c00d, 0x132b98f93676a1fc, 0x26683390479088d2},
+    {0x35366d726512589d, 0x1a3e6b999132d200, 0xde087c496782aa42, 0x19bd0fcb4d53dd00},
+    {0x047cb750ec6c0762, 0x24d6a46e5dabb47b, 0xc919256c1ba14cab, 0x273396a78c4b62c4},
+    {0xf0b98c2b57687d8e, 0x80147c912063365e, 0x59b461ea91ba1607, 0x28c3fc150c32ff50},
+    {0xf5eccf1c3d434232, 0x473330d9dd3d1536, 0xade583c6c46d86b2, 0x2c598c961ec58e70},
+    {0x03b800160def6797, 0xc4cf4ab9a943177e, 0xcde7b62ac1588f3c, 0x06eecbd051cf7c34},
+    {0x0369b2583c6bd1fd, 0x0dbdc1a076d43177, 0xcb0dd179adcedd3d, 0x0bbe0370470abd29},
+    {0x7cef46f570a500c7, 0xd5c89d2b7ae0671e, 0x32a472d2e25b5d5d, 0x1819574a6430cd10},
+    {0x6f7de7d7f2113dc2, 0x9bad7676e26494cc, 0x59b77b7b4f7cb546, 0x2624ebdd096c1e37},
+    {0x11a5cdddfca66b49, 0x768bcc294debebe3, 0x852080c87fbfda18, 0x1c7d91a619b633ee},
+    {0xaae5e35d8145efad, 0xce1d50cae0bbe5f3, 0x36970cefb2134e9f, 0x1280d61543c46cfe},
+    {0xbaaef2d36b5468c6, 0x498f7feb859e85a0, 0xfbbe4f4fef131eac, 0x0b321fd2bfd3b824},
+    {0x73cf2dd7fb1b7a9a, 0xfa91136de4c46704, 0x7477293dd0a4ef08, 0x1b2e2f421e0c4760},
+    {0xb4af5805db788bf2, 0x4c06654190ce9257, 0x3c0942be862b0413, 0x19358aa7ecb1ffdc},
+    {0x1a5f2289be6e42d5, 0xb8558e89c40d8a7a, 0x6db403e0d417290a, 0x0df8c12d84359369},
+    {0x2c1623378fa50e7b, 0x334709d38676a013, 0x424966dfeb1a23e8, 0x13f728b84aee75c8},
+    {0x58cf088ebda25f34, 0x7a5d6a37c20a05fc, 0xc3e67e0e8ef2478f, 0x28cf15d813041154},
+    {0xcd9b371660e26854, 0xa798e006bde7c2a5, 0xa589cbbf8f0cde4e, 0x0cc83461e6654fc6},
+    {0x5aa5df881cf08b7a, 0x854536b686b10afa, 0x54fbdc7acbaf9ae0, 0x2267e5792b131883},
+    {0x6800c90673d40313, 0x370cc2be065355bb, 0x48b361af98b894c4, 0x1574397ef2d5da4d},
+    {0x980463e7193ce68c, 0xae87dc9d1a4abf45, 0x038a72f6f99cdb5e, 0x169da4f52a8f168c},
+    {0xc837d64534683bb9, 0xa1c5ad4757898b12, 0xc4eb6597a3d9aa3f, 0x10551f64e930629a},
+    {0xc276f1f23fa3dfda, 0x07be179d0f4e390f, 0xef2cc368f6a7932d, 0x169888fd256ea6c8},
+    {0x0933f9e69fdb4920, 0x757798d2cb552ac2, 0x44617531aff8a6e8, 0x1c88dc66ae439dee},
+    {0x84d6faa1219d011a, 0x6c621fc73f57d413, 0x06661776bd78cbf4, 0x0d40569eac57478d},
+    {0x65a764cb33746490, 0xd857618b6d3d133b, 0x597d95e1bcb82d7c, 0x1999b22a5b250c0d},
+    {0x09913f64ed0f55eb, 0x71f4b894b1d49b95, 0xe64f2d869782046b, 0x2ac51c6d3b362aaa},
+    {0x4e1f1fb6f3864524, 0x183aa6e52734a295, 0x7a585dc7414a772d, 0x0e2e7f46b2e96900},
+};
+
+alignas(64) inline constexpr uint64_t POSEIDON_M_MONT[POSEIDON_T * POSEIDON_T][4] = {
+    {0xf2e8909a56fcf3d7, 0x8019ce3145ed8c1d, 0xdda896a228616418, 0x0e5ed723ffc885e1},
+    {0x3158f311d66c0469, 0x9511d96f69f040a0, 0xbc6996e5b22127bf, 0x07e69e17a7c9122a},
+    {0x28f45876169969b0, 0x3d6ded69e30a7649, 0x79aed6124c9b23dd, 0x03cf3048ffadf517},
+    {0x670d8bd946474dd5, 0x56daed800bf07bae, 0x5c98d51ecca20e6d, 0x1a3491eda18b0028},
+    {0xf0193e572ba79c47, 0x5fb2e46a6ee2dac5, 0x6892f0d5b6ffb984, 0x0df1dabd49661413},
+    {0x3293bffccaab272d, 0x85cbae38b11c4e1f, 0x67208956c8757b3c, 0x17ca537ab6c9d981},
+    {0xcc226561d2802757, 0xfcfbd22f5bb9f4ed, 0xc8ef58acce2b8678, 0x05984bb41bae9c88},
+    {0x17561a5176bfeefd, 0x1cd5d7be100061af, 0x714cefb2dce7646c, 0x0043bf61f2173fe9},
+    {0x4c72e3c51c729128, 0xd35b9fd9170d616c, 0x4d095dc74ab700a6, 0x1282bdf76dc5d39b},
+};
+
+alignas(64) inline constexpr std::array<uint64_t, 5> POSEIDON_C_IFMA[POSEIDON_C_N] = {
+    {0xdf52ac34a8579, 0x64be3e8c7f608, 0x7afa6347daabf, 0xe2fe6fefa8535, 0x010cdcc685cab},
+    {0xd576022563199, 0x929b4661ed078, 0x411da895198d1, 0x76bc1191f90d0, 0x0293ff0e50696},
+    {0xfeef5c508d888, 0x912080e56030d, 0x6f700b1bd1775, 0x7f7fcc3c5ccbb, 0x000e70349714a},
+    {0xea89a84b72ca8, 0x4afb426c776c7, 0x5aea29b94b5b9, 0xa7563658ce85c, 0x02409f6b9db59},
+    {0xd3c598c71779a, 0x0246646b7cb7c, 0x026ee554bf138, 0x3ce9eed68ee91, 0x019fa1d013089},
+    {0x1296e933b7555, 0xe6f3bd5bd1d66, 0xd0d10f879ab81, 0x693fd09aa0550, 0x026bc730b0f94},
+    {0xa3d51c5243ae7, 0xeef5fc436285f, 0x39be04b7e7e0c, 0x8fd67f789d146, 0x02da6e62fb583},
+    {0x929e20264f6ad, 0xc3dca4397a5a5, 0xfa10018a8c297, 0x4d8f03ffc2309, 0x02982687fb91b},
+    {0x0cb31acf81146, 0x4d5c947b8a43d, 0x97d32975e774a, 0x21586d93a19db, 0x018ff06d958c2},
+    {0xd9681ce89c1d3, 0x29d9bbb1f9282, 0xfc23232b66e5e, 0x77434a6c7cb82, 0x024d282d6764f},
+    {0x560a8a541137b, 0x223d47885dc07, 0xf776d8ceb65d8, 0xb9810cd7889ae, 0x00ce18927f1e0},
+    {0x9555db11f6dee, 0x386776ad423e0, 0xa16afd0195be9, 0x6cfbbfecfd5c3, 0x018feffb73d72},
+    {0xb91dde5b6ae53, 0x34eb2990cd635, 0x09bfda8d764d1, 0x19226298804e8, 0x02320a4a318ad},
+    {0x8d9ee4f4f9f77, 0x3a0c249c87a02, 0xd2060e89f68f2, 0x84e917ce59a7f, 0x02eaa22a0918d},
+    {0x71baab407104e, 0x83975495f01f6, 0xf279418317426, 0x78ce05247cceb, 0x02bc88c620cf0},
+    {0x087995ee3c2c4, 0x32b89381f8bc8, 0x0a1ac8f55c557, 0x433de2fa79766, 0x00ab834a08329},
+    {0xa53054b8eb65c, 0x8a1593ac79128, 0x0196fd55f158e, 0xce9ad8addc133, 0x003e3d684223c},
+    {0x121f2e2e4642c, 0x9b45bb6f3a8ba, 0xc6c8a2034f0df, 0x1395f629d138b, 0x028b73f2834a8},
+    {0x0962a4ee00cc3, 0x12aa421bc13eb, 0x2508dbc89a353, 0x4b954fa05807e, 0x007a05c7f833c},
+    {0xed895f5c8449f, 0xd1156a858af0b, 0xcebb3ee860517, 0x8dc59fddc3e1d, 0x0256283f7549d},
+    {0xf7ba78f74c20c, 0x05b848ff5e2e8, 0xe43aa394eb454, 0x90eced3bf4f96, 0x02d3aef68a33e},
+    {0x9c8b749d3e571, 0xff9ccdcfbb4b3, 0x3b2156f6b795c, 0x71adec0d25aee, 0x00e085648bcc6},
+    {0xc9826b0c5eb38, 0x7333bb3312fa6, 0xf0263b711e638, 0x5663cc621ec7c, 0x008726ec13078},
+    {0xfd338aacdc766, 0x530a8d19b0809, 0xad0edbec6ad9f, 0x0e62dad02f215, 0x025bf3b3fca7b},
+    {0x4e53d420254e3, 0x60ea664a05388, 0x1bbdeb5de778c, 0xae72bded21ba8, 0x00b6b182daa2b},
+    {0xb1e5be7f2bc9f, 0x86b26f40a4e10, 0x6db774fa1b153, 0xc40e11e97a970, 0x002639b4f0bdb},
+    {0xde23ed8c32573, 0xe409257edb7bd, 0x1fd2e3d8cca3d, 0x1b405028c2f52, 0x0106d5c956ee9},
+    {0xcd0a499872473, 0x8235171732036, 0xe8422a5f79187, 0x2f9f343d90381, 0x0246085d02abc},
+    {0xdea6207ee004b, 0xdcf908da831b3, 0x03b4fef654664, 0x76636575b4304, 0x02e87c7273ca2},
+    {0x9565f043095e9, 0x37813892994a2, 0xca6803df83ffe, 0x9cc1e32263a03, 0x018ea1605d1b2},
+    {0x4ac60e8f8346b, 0xe36523dde6e29, 0x67163627fdf3d, 0x1ab822a477850, 0x0280c4a3c9f92},
+    {0x6da316af2d82e, 0x27d8ae431a6d1, 0x89298421efd61, 0x9f6375ba50a87, 0x021d869993e73},
+    {0x8458923a6dcee, 0xb899bd3b0eec3, 0xbe76e72414e6d, 0x1df81ede18994, 0x0047fe597bb90},
+    {0x01a7ade916649, 0x366bba62f642a, 0xb74808edae381, 0x1d328ffd9d1e3, 0x0177cb85bae29},
+    {0xe57defaf0ab2a, 0x8f3af829cae0a, 0x805dcf39d1322, 0xd9fe5fa79b7a4, 0x0305a180de711},
+    {0x87c96c4617422, 0x0afef597e673e, 0x0e8898c8a59c1, 0x7c813a2d7f142, 0x02ee221beb888},
+    {0x6f0a18ec9d675, 0xcbd897730345c, 0x6bb3f64afb282, 0x184848de0aeea, 0x0070aba150cb8},
+    {0x21dc93a98dc66, 0x7c6763d65210a, 0x107a281b85020, 0x9ce47dfb99677, 0x02ebbbf60949f},
+    {0x89a0ddd146f0b, 0xe217b4a20e6cd, 0xd6c38ef440d32, 0xe489f498f54a8, 0x004080d25eb0d},
+    {0xe5cbf81c37dcd, 0x2f30f0b582c22, 0x3816c2a6bc8bd, 0x28386513fe157, 0x01f8f0a5fc4f6},
+    {0x9ca68c22a3085, 0x55a63a7e43c69, 0x73461bd48563a, 0x11ade84e71712, 0x00fe56e1669ba},
+    {0x3cfa73154db73, 0x6d75b83cf997e, 0x21257a211e9e4, 0x4a9d2e4407597, 0x0108a4e4e1b74},
+    {0x7c7dc7fbd3633, 0xa401989411382, 0x92f089082e89c, 0xd4425b9b6f4e6, 0x0186df8e483e5},
+    {0xd5dab0fde135e, 0x41ab78295f97f, 0x1578be1b9c838, 0xf3cbc8743ea97, 0x0249c863dab6e},
+    {0x336112fbf9f30, 0xba2eae970a14a, 0x57f78db1ff289, 0xf6c32a2feccaf, 0x003726ecc0267},
+    {0x87b9663a8230c, 0xb2a55aaaf14eb, 0x5894baf3d9da6, 0x2023ba7c2991d, 0x0146f978e1c9f},
+    {0x95214a4d5e038, 0x2b249c120ae73, 0x584d21e44f59c, 0xb5b7e80907cc6, 0x02d226149545c},
+    {0xf0f9acf4e118c, 0x2b8caec15d980, 0x1f9ba44a5ec13, 0xe597401f3648b, 0x002a1365c01d7},
+    {0x74b7dab09541b, 0x770ff74868327, 0x7b01b77a3e1f9, 0x3a2fcc223bb02, 0x0291c68a611f8},
+    {0x39b7dab254be2, 0x291e17aedf20f, 0x89a807cc20dd3, 0xbfe08917a283a, 0x029a3ddeb4034},
+    {0xbadff0bdb0573, 0xc160621979be3, 0xf04148d7c18af, 0x103398245c972, 0x025ba8bc8f8ae},
+    {0xfa8e91e43a5ce, 0x4cdc2e958c3be, 0x452bc49ab35c0, 0x2d328c09972d4, 0x0198f947d22b8},
+    {0x45a4cb08396db, 0xa888b50d5f609, 0x03d70c01b45d7, 0xf1b7bc187e19b, 0x01d6eb70ce9ac},
+    {0xce4d86f98e34e, 0x6b3955ee3ffdc, 0x38066f3c33989, 0x7915618b5ceee, 0x024dd9ad29f2a},
+    {0x2f0d0e88d4d43, 0x2532857fd4e61, 0x3bb77878139e3, 0x78a820b419cd0, 0x0059f5b0d5cff},
+    {0x05778e8e99aca, 0x5aff737bcb92c, 0x31e92e3365e53, 0xe7294a26b37fd, 0x0012f28019cfe},
+    {0xb613dacb859bf, 0x008976459999d, 0x3430185cf9af2, 0xa9b505a32be1f, 0x006735c18e30f},
+    {0x032507b941c7e, 0x30617fe59042e, 0xb0bbbcf217d14, 0xe2f416aa01d98, 0x01a7e98ef8cf9},
+    {0x9cd5a444c8f1c, 0x9de3cd004b0fc, 0x09aab73056713, 0xca2450aa20a09, 0x02f3405353649},
+    {0x90780b9566e63, 0x59a49c944d06b, 0x6534ed3cb50a0, 0x5a0a46c6e21c1, 0x016be10a3853d},
+    {0x840aaa631bbb6, 0x4cdc4c54b3591, 0x00def355ddb91, 0x27458ad225b6e, 0x01b818d8a0adf},
+    {0xdabcddb8106ca, 0x22fa37bc1a931, 0x5e810f9c8588d, 0x029b9c179054b, 0x016ce4e13277b},
+    {0xff99fb87c89fc, 0xfe98cd60c5a17, 0x0d2c3edd81822, 0x8042ba5d8ff44, 0x014f1c3442e53},
+    {0x61877e1c850b3, 0x6e708183347a7, 0xb8dd2cd43a2ac, 0xaaca901188499, 0x02da9ac6bbaeb},
+    {0x9f833b2e2cc68, 0xdf7485d47ed45, 0x5076f11e125d0, 0x9649442a0d377, 0x0141e7251a45b},
+    {0x80f029f28b750, 0x974cb1e942210, 0x9f3da2a437450, 0x16687926f33c6, 0x029cf616ee2ad},
+    {0x3185f611e91c8, 0xc430005ce6053, 0x7ce828c9aa1cb, 0x7333e5e4f5775, 0x01ea72ce41df5},
+    {0x44286674f113e, 0x76422dbedf65f, 0xdd7d8e2eb600e, 0x873cca978c657, 0x00f56380f5591},
+    {0x69d073f084968, 0xebec4b9693f5c, 0x068a8f0fd04a9, 0xea6b338e56325, 0x028f82c482f3a},
+    {0xe005feef25d66, 0x2c4227df404db, 0x7d4e521d0b94b, 0x57a2c0f6bdc16, 0x011d34284c8ff},
+    {0x9685c10c655fa, 0xc9d97ee56094b, 0x486799df71c0c, 0x243ed2b3578cb, 0x0106e4892b60a},
+    {0xcc1629cd31110, 0xb8d257da83f40, 0xe16198b9f9665, 0xb21185f61f8e8, 0x021adba7bd33a},
+    {0x4ea086d3612f9, 0x57f5b31caa67c, 0x9bb198db56163, 0xbc120d8b6f55a, 0x011ceba4f1692},
+    {0x96a0047fcf72e, 0x35b7f6563767f, 0x5e5d9d55e56e1, 0x80a0f376a30ee, 0x023b094fb0ddf},
+    {0x989a9228dc6b8, 0xeaa5a4cdd7010, 0x869ede04706ed, 0x7e5cb66b83256, 0x01636f08311c7},
+    {0x6388f127c2d13, 0xf02a2380e8746, 0x5064ea70182b5, 0x07837c6fed8e7, 0x02ff0b361cc12},
+    {0xc873ddc516800, 0x9080096561d14, 0x40d6a40e0da86, 0xb9cbf4ec9ba13, 0x0098bdf65a0af},
+    {0x9e8cc0243e5f3, 0xf0225a80849af, 0x20a647947671a, 0x361d983a0fb7e, 0x004db521b02c5},
+    {0x29ab8b3aa6811, 0x3503cf5bff1f9, 0x63a9b8512cb00, 0x7ad278175ab93, 0x012e0e534c3d1},
+    {0x8f97c0bf5d0a6, 0xb1b629263cf2a, 0xaddb5fdd098a1, 0x2043692ade9ca, 0x01f72c020de1d},
+    {0x11179251546ac, 0xf4c43d0e7bf1e, 0x5eb3a90671c73, 0xcf2ac053e5d04, 0x004a6a2baffd8},
+    {0xcaeca8a6f5306, 0x0e9291d208d90, 0x13fc7ee86ff70, 0x1d35fb25367d8, 0x02e096562e7d7},
+    {0x2d7a933617cfd, 0x6f40ed04341c9, 0x6ac3f26f31160, 0xd299def4be89d, 0x00f6a3e2a13cf},
+    {0xed4ac134185bb, 0x6a77718cf9e84, 0x9e89645a07749, 0x949f378fda6bf, 0x02edaee8a1c81},
+    {0x1594f322800b8, 0xb454b85164c33, 0x166f8723b1f38, 0x9948569bf084c, 0x02b8cbab21570},
+    {0xae2bd7c923795, 0x95da26352c1a2, 0xd6ab0347bdc38, 0x1b7922eeef614, 0x01360327fde0f},
+    {0x0b30abbc87282, 0x46e58d8081f24, 0x32de353962527, 0x5a467280bafdc, 0x028fe02685c3c},
+    {0x2861e83af4634, 0xc0624f43d5d4b, 0xf8f59d90ad814, 0x91beb523db6f6, 0x027ccd34b831a},
+    {0x52cfb8b52e370, 0xbe7fb7fbc7889, 0x59447aefc72a5, 0x61ec77bac4f94, 0x001040af8a6d2},
+    {0x7d2b1dff74255, 0x4d94d169d383b, 0x0513b2bebba86, 0x51534d4bf1121, 0x004e952a1fa9a},
+    {0x2dc8631f9296f, 0xf22e1703ac176, 0xbccfc9b3933ae, 0x6c7de386ae9e8, 0x00c996597e562},
+    {0xa0d7de9d55fb8, 0x7d835b965faa1, 0xebe907f3bc59d, 0x86450ffc03c5e, 0x025e8da620691},
+    {0x6b85c8ebe7eb8, 0xa47b65abad2a8, 0xa29f1675577b6, 0x3277098b9f053, 0x0200cec614811},
+    {0xdaf9009bcaa8b, 0x8cf2dab2221d1, 0x2f7ad4fbf14e7, 0x91c95a5f11b49, 0x0232a5b7cdbe4},
+    {0x72f59eac042fe, 0x334e85ae6e300, 0x1a37888218cb1, 0x517b6976092c8, 0x01303f2fa8158},
+    {0x0d4bb68cbfe3e, 0xb3835667734d0, 0x81c4c22acfd7b, 0xc0ca63eec8620, 0x00bcec1c0d3bd},
+    {0x71aa204c90238, 0x5646745d8980a, 0x881fcdeccda71, 0x238d4fd1a755c, 0x0216d9851bb94},
+    {0xe1a25951b5bf4, 0x47d72a2cd2620, 0xe51552c61df3e, 0x74b67e963bf1c, 0x02cef3c596e9f},
+    {0xb5d0d9417132d, 0xa05b57cf283f4, 0x71b7afa5280d0, 0x37b62b081443b, 0x01bfb8928e94c},
+    {0xb2ca400f7d28d, 0xe53d58ec921f3, 0x5b76510617109, 0xae6e5b5a3389a, 0x02058055b686e},
+    {0x7b917ad545907, 0xfecb601482fba, 0x365abdb2b75c7, 0xa3f692d32404b, 0x011cc97c8e555},
+    {0x99176b6f87d74, 0xc6e35b4ea75da, 0x8accdac57a9a4, 0x494123d1d436e, 0x02a287be6ed72},
+    {0x63c3948b67320, 0x71ae1dbb4b50f, 0xbff66a9c160bd, 0xea624cfd9385a, 0x02063a7ceced9},
+    {0x0554602245af2, 0xaeaa0ebeebfa7, 0x5ca7e77b58c65, 0x630dfbfbefe42, 0x01d5fdd7b3cdd},
+    {0xe0338e8c8994c, 0xaedacfe5ea090, 0x73c0c194d2019, 0x5b7f12ba74e6b, 0x021138e0698b2},
+    {0x65c4427cd5176, 0x2e1775888a888, 0xe85b65287aafb, 0x920c3b98d04e6, 0x02dd6ed79482d},
+    {0x72c64f54c9920, 0xbf785abe0d6e3, 0xbeae1499827b2, 0xcb7b67492d94f, 0x0288174a915f1},
+    {0xeca1df4ad1c4b, 0x62f66f586a7b7, 0xf9908f4a4eaf1, 0xec319da1be94b, 0x005a4b5820209},
+    {0x31f41531bc11a, 0xefffc0be6101b, 0x49918c6d75dd8, 0xc8fd2144c5453, 0x021d75b6660c9},
+    {0x4800dbb486498, 0x8c979e7c76402, 0xa1f6114eaddf7, 0x6da85909c1a99, 0x0125df740acdc},
+    {0x5f36d1bdef01b, 0x0b4614dc71190, 0x700031d8a5b20, 0x6ac02c6cc6f37, 0x025b662f65270},
+    {0x6f8575e35923d, 0x198d1414a3575, 0xf382f4160f608, 0x2a2d876f6536a, 0x024e77d7d4e71},
+    {0x2b63151be229a, 0xe47d1ede87a09, 0xd0c7b6535de28, 0x4b46fcb7deeb5, 0x0168efa3f9e94},
+    {0x9a758ebb6fc6b, 0xe8fd8295f7c1d, 0x65d7efbc3937a, 0x556ca9ad7f97a, 0x0227125d11bbb},
+    {0x14ac455248734, 0xdefb1cba139d4, 0xdad4271b5e6d2, 0xc7568549719ca, 0x016199a288230},
+    {0x6672b41dcee80, 0x5849196a18ebc, 0x88d82a606f074, 0x49de55ae090bd, 0x0094705541672},
+    {0x1757cba6418ac, 0x967156a12b528, 0xd769f8ddf64f4, 0x95ae5d7374bd3, 0x0060fe8630c71},
+    {0xfb84bc018a4da, 0x6a31e7c56ae75, 0x11b6c0ce04eda, 0x01053e3f715b5, 0x0067ea40d6ac0},
+    {0x2759bc652d13b, 0x404b6ab3a7649, 0xe87cbf3c2d16a, 0xb9368f6429d44, 0x00664db0d3105},
+    {0x291f7102eadb2, 0xdd1fbae04c7ca, 0xf272c0f9f6589, 0xb17da8e140802, 0x0074ddcfa3c63},
+    {0x1fe153944263d, 0x2510c5a2782b8, 0xfff0ead735691, 0x8c9c858d4d81b, 0x0071aa1bae35b},
+    {0xf0fc382c6d8fe, 0xd4dfabf9418f3, 0x32c139b8e3e34, 0xaff620a43e223, 0x005a4eb7ecd10},
+    {0x139ca79d699b2, 0x159bb1d02684e, 0xcc3219afbe587, 0xd53935fe1dd68, 0x025e045a1c04c},
+    {0x2ccce2a68bc32, 0x6c9de647341a0, 0xfe0d5dcc7d320, 0x1befdf898cd55, 0x02d04a7c55db1},
+    {0x4d423aada23f3, 0x1af0038dacbc8, 0xe07963d519159, 0x65c821da0849e, 0x02f59143beb4c},
+    {0x9c88325914ba0, 0x0c4f678a8fd68, 0xac332b217ccba, 0xc0b775c3aa0ca, 0x0237eeffadb3d},
+    {0x229ada48ab593, 0xa8c97220a8df5, 0x40f8aefbb6d23, 0x9ca084cd8e81d, 0x0117e420bbb39},
+    {0xaa8dfc545101b, 0x07e9dc8ca7088, 0xf482bf715fe87, 0x8731ed0ca46c7, 0x0186512603081},
+    {0xb5ef68c1fc30f, 0x364f7e369a318, 0x66837abf25c10, 0xcbe24cd7ed3cb, 0x02233f63693f0},
+    {0x6219ea723ea70, 0xa47a73dbcd6bd, 0xdba423b15ef75, 0xa95ce0d24f3bc, 0x00f2c9c00b75d},
+    {0x9ec10234561a7, 0x0d4fdc55dd20a, 0xa607c1883891d, 0xdba166688163a, 0x00d945177b61b},
+    {0x6b99e852a70c3, 0x27330453eec61, 0x14518ea6e9eef, 0xfe0941fad6679, 0x00c7eab0f6ccb},
+    {0x072acbd24eb52, 0x5942e0d1deae9, 0x2e7af1b4d5924, 0xb86056c95b0df, 0x01ff8b5201baa},
+    {0x66f41d6b3c365, 0xa8475d84364a5, 0xdd30d8161ccfc, 0xa6913b7da2cc0, 0x029b556c25a51},
+    {0xb1cd9e4960f0e, 0x79b24fbab7651, 0x5b929aeb3ee19, 0x60f43456871d7, 0x029aa553a3e05},
+    {0x4230555612390, 0x8b6a9b0c38e78, 0x9a9859c68657f, 0x86b3c1f30023e, 0x020a5307957c3},
+    {0x4fcba441386fb, 0xdc432cc785d7c, 0x6bf6a44cf3dec, 0x5247c1f776800, 0x023476e0e6dc9},
+    {0x8c12a91facfc2, 0x863d3be59b861, 0x5bd978c59ea6b, 0xacc57de650474, 0x013b13f2313ec},
+    {0xe6b91a232e7fc, 0x6d5a330c1f6ea, 0x3f93406bab432, 0x9e22e616c13ee, 0x02eaec84cc4e9},
+    {0x9df1c37096016, 0xfab037b04f4cf, 0x59cd49a9b8cd3, 0xa173b2d5a7599, 0x018e3a1a97ef4},
+    {0x983c0c7a38d87, 0xe7f45122914a8, 0xbf9d8d8fd09a9, 0xe0ffdb551da21, 0x00f52a01b4f68},
+    {0xce15234cce646, 0x43270907e745c, 0xbceb27cc71c38, 0xf9f70d1c53b81, 0x02d8141c7fe06},
+    {0x2012b1e065e2b, 0xefa09accc1986, 0x8462d7a510306, 0xfa0e7478c4be2, 0x0102c91e65546},
+    {0x8ff18b0793c52, 0x93cef0a2aabd3, 0x4f8d8c53577e2, 0xbc3c3d04c26a5, 0x0159dd32e4b18},
+    {0xf5343c52e3c8f, 0xa57f0702b5706, 0xc5233e3088bce, 0xc86dcb246e926, 0x02b3e83818929},
+    {0x35e2f4ca34d57, 0x973d9b1fce079, 0xcd0e72b45a39e, 0x93135e6a72654, 0x0120c08e7c07e},
+    {0x60627ebb49312, 0x1a158498d9455, 0x4ac83ce7492ba, 0x4f0865a3b31af, 0x02de2361131ba},
+    {0x848d7fafcabbe, 0xf23e124c2b3a8, 0x4e627e4fd6cd2, 0x67e27c7aee3f9, 0x01f03e0e4cacc},
+    {0x6ac59c1b83ef1, 0x74279f6e2b46c, 0x549169b3e2921, 0x2cd86d726b4f2, 0x004ecb6b19d7b},
+    {0xf973a381e4e8f, 0x5c50374332da9, 0xfa26190847c75, 0xe910113e3ac2e, 0x02bc336a43bc7},
+    {0xcd96f01dd3ee6, 0x495d48089c149, 0xead8916a012a1, 0x814350f831c83, 0x00c5f9ff8e753},
+    {0x80cfe21ed4d78, 0xa7e79726e6796, 0xb8bad8aa011f9, 0x2a220e2225f7b, 0x02d6a3b81f4c7},
+    {0x5812f6ed4ddaf, 0xfe62ef8177334, 0xcbb5f1ff61453, 0x4d7a1e9f15584, 0x012ec8797e29c},
+    {0x0c7031fd828cc, 0x5a9580f45849f, 0xd0411d86c7fbb, 0xb5ad370ae2414, 0x01f0cb40c8c70},
+    {0xe995ed30c5cda, 0x0acacc5d0c2d1, 0xdff2ee6d685c6, 0xfce305f03f299, 0x01bbec4a0ca6d},
+    {0xe0d63604a26ed, 0x63be7ad0d6979, 0x8c93b752aa0c0, 0xe3e534bc412c8, 0x00bcb3c09b4bd},
+    {0x66a9873a54d8f, 0xeb305511e653c, 0xf36203483f7db, 0xe91e0baba23ef, 0x0011014e8a6fb},
+    {0x432cfe8908d73, 0x3b8cc932547ef, 0x93b5edb0dcdcf, 0x337943595f8d6, 0x02f1429b0f460},
+    {0xa7164eb85becf, 0x80985d3d97f14, 0x55c93524e72e7, 0x1ed5128b79343, 0x01fb4125d387b},
+    {0x1be4e2633be99, 0xc8187a112a609, 0x0918139825838, 0x14ed2fd37bea8, 0x00ceb515c3de0},
+    {0x18c0bfe56661d, 0x2bc1e027c9691, 0x8eb00ccead9a9, 0xe253f8cbc805a, 0x01568118caf48},
+    {0x3b7a92961db4c, 0x5d2dd0293db99, 0xab427396777e2, 0x9e27195ae52bf, 0x026facc2ea90f},
+    {0xe1cd92594ed1f, 0x00bc531e9f1ec, 0x0785942435b11, 0xdefece357d800, 0x02765de7ae4e2},
+    {0x5f4dc81d69875, 0x8ec76ab89dda1, 0x7dec693504df5, 0xe148a2168ab5d, 0x01eed722b57f3},
+    {0x4c3df53208b42, 0x08887a9d996dc, 0x8b2c4d912188a, 0x8caf38f297933, 0x0251ce5cfb3e1},
+    {0x5e3d37a4bed0c, 0x4b9d1af880039, 0x2fc6bb4081212, 0x89ab3d18d1ac5, 0x02437b2a3bae4},
+    {0x96a449edc046f, 0x73ef17521160d, 0x709ac98903b56, 0x430b9032aceee, 0x02a3098e2269a},
+    {0x329404ecdb914, 0x28395aba03833, 0x559fb641a2de8, 0x0b2c8ef64b055, 0x021cf8ba1eab5},
+    {0x72a86d12589c8, 0x5545619b79345, 0xc1fe138624777, 0xcec01e0596e26, 0x018ae891dcbb0},
+    {0x3f21f86c07614, 0x80260a00e1193, 0x804a6546afb63, 0xaa57edcf1233a, 0x02e85bd163662},
+    {0xf4a324687d8d3, 0x63d7c8ae8e991, 0x80fe3bcf6a4fd, 0xd2e73f3294648, 0x01727c57b53aa},
+    {0x183acb4342312, 0xa72bad2b7da87, 0x1c5960c405c59, 0x24c2c9f46c713, 0x0201c7f199ba2},
+    {0xc1638fef6796e, 0x09a0be96bdb3b, 0x2864311fc8cdb, 0x82f96ddad73f1, 0x00e24201f5a94},
+    {0x544c7f6bd1fcd, 0x2e0016c5bc6af, 0x869cab9634061, 0xf21f87ec46775, 0x02ab34babcd16},
+    {0x6b84b7a500c69, 0xbc59f45deef3c, 0xb2c6b51431e78, 0x6fdf201545309, 0x02ed74f821ab1},
+    {0x6fa8fe113dc14, 0x08719805f7c94, 0x5bb300bd86884, 0x6180f7b47326e, 0x01d9b106e086e},
+    {0xb3bac5a66b487, 0x089739c915b76, 0xe718640fee998, 0x9d70d735991d6, 0x014525857b0a4},
+    {0x27460745efaca, 0xfb3165bbd3171, 0x82cd7cdf09d9a, 0x0ee9178f2cb41, 0x005b38aa2f51d},
+    {0x94c7ae5468c5d, 0xdeecbc0857df4, 0xcade1ad205c45, 0xa1d292f423db6, 0x021f511d359a6},
+    {0x330e031b7a998, 0x9a7e7aebbd1de, 0xe442da66771f4, 0x74b984f06628f, 0x02fc0808ad737},
+    {0x5d3be3788bf18, 0xd53f1da0f12be, 0x6a57e4b7ec711, 0xfc75fe11fe345, 0x0103636e7c192},
+    {0xa524c26e42d4c, 0x7a59f2e55c966, 0xb6d2f36e48947, 0xb5eff9ff27333, 0x01dfad90cbe92},
+    {0x672015a50e7aa, 0x858d115dcb2a1, 0x89a2c5443392b, 0x9b89d2b4cbb7a, 0x01d18b4d367bd},
+    {0x71068aa25f333, 0xcdf235a8651a7, 0xb92fc3c9b33d7, 0xf32de25456a45, 0x017d961abc0bb},
+    {0xb9b164e26853c, 0x49f7966817ca2, 0xac88375d8be5f, 0x7bc3775ba51ee, 0x00af20c52e18e},
+    {0x86b267f08b795, 0x4b3018d967bfa, 0xa6ae2079a1870, 0xa66a644ac8d52, 0x0122ef8a3040f},
+    {0xed95bad403129, 0xe5112347bda4d, 0x0ffe1b75760d1, 0x43b0810432fc0, 0x0048572cb0502},
+    {0x8876603ce68b9, 0xd65099e060a51, 0xf444b5ecf126f, 0x079c2e7547720, 0x0171c2a2e8096},
+    {0x3986f9683bb8b, 0x0b17f97e56301, 0x613ea2853574b, 0x08dbb524fce9b, 0x0135c6e102d0e},
+    {0x168186a3dfd99, 0xd5a0d17d034c4, 0xfefc84462761f, 0x0b6ae89a4e91d, 0x016ca6aae2e8f},
+    {0xdfc368db491f7, 0xa06dcdb705304, 0x1fe5340eda662, 0x3d6ccb44dfb07, 0x015070460f97b},
+    {0x7d3c259d0119c, 0x520e977ef33de, 0x1875dd225525b, 0xf82985206091d, 0x01274301f40ad},
+    {0x6a013b74648f8, 0x730605af2c3b6, 0xf7814e443d6d6, 0xbf87d5573067b, 0x01678af0ea8c3},
+    {0x88837b0f55ea2, 0x547525915ee2b, 0x30d719eec74d5, 0xe866508f086e6, 0x006d57c8b62ab},
+    {0xa251f7864523c, 0x308c64670fd26, 0xea2115ce2dacd, 0x0f60c444c59a0, 0x02156ba9fa9d0},
+};
+
+alignas(64) inline constexpr std::array<uint64_t, 5> POSEIDON_M_IFMA[POSEIDON_T * POSEIDON_T] = {
+    {0x13355afcf3d6c, 0xf277f2ff9a1f0, 0x010e01360cd41, 0xdd76f94853488, 0x0245c387477c1},
+    {0xb45f586c0468e, 0x65ab9128e08dc, 0xf0fcb3f00b5c6, 0xe25855f8e2ee1, 0x01da14494ba2d},
+    {0x391cd79969aff, 0x55b6edf4014b6, 0x830e576aeaaee, 0xb14de29d1b6e4, 0x00c8eb61d19ad},
+    {0x910f4e474dd48, 0xbcf13c365c51c, 0xe1623ec2c0f95, 0x0138070b2438b, 0x02026ab430f23},
+    {0xc0f22fa79c46c, 0x850747ea19f20, 0x9f636d15a5ea5, 0xc08fa7edf6816, 0x01d8c7209119a},
+    {0xe48c11ab272c9, 0x8fbdb2cdfa4e0, 0xcce493c434f89, 0x36f267d6ad6ef, 0x029e712874442},
+    {0x460893802756f, 0xad41e5de4b7e4, 0x1370f32a7893a, 0x2862d6a545166, 0x029206cced9b8},
+    {0x1a5176bfeefd0, 0xe100061af1756, 0xe7646c1cd5d7b, 0xfe9714cefb2dc, 0x0043bf61f2173},
+    {0x27ada2729127a, 0xde967d735d2fe, 0x267f83e44828b, 0x78ba7eb43a2da, 0x005d208c59533},
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "utils/cpu_features.hpp"
+#include "utils/hash_batch.hpp"
+
 #ifdef _WIN32
     #include <intrin.h>
 #else
@@ -9,31 +12,86 @@
 
 class Sha256
 {
+private:
+    template<int n>
+    CPU_TARGET("avx2")
+    static __m256i ror8(__m256i x)
+    {
+        return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+    }
+
 public:
     static constexpr size_t BLOCK_SIZE = 64;
     static constexpr size_t DIGEST_SIZE = 32;
 
+    static constexpr uint32_t IV[DIGEST_SIZE / sizeof(uint32_t)] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+
+    static constexpr uint32_t K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+        0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+        0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+        0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+        0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+        0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+        0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+        0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+        0xc67178f2,
+    };
+
     Sha256() = delete;
 
+    // Use the SHA extensions when the CPU has them, the portable code otherwise
     static void hash_oneblock(uint8_t *digest, const void *message)
     {
-        static constexpr uint32_t k[BLOCK_SIZE] = {
-            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
-            0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
-            0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
-            0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-            0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
-            0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
-            0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
-            0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
-            0xc67178f2,
-        };
+        static const bool use_shani = CpuFeatures::get().sha && CpuFeatures::get().sse41;
+
+        if (use_shani)
+            hash_oneblock_shani(digest, message);
+        else
+            hash_oneblock_scalar(digest, message);
+    }
+
+    static constexpr size_t LANES = 16;
+
+    /*
+    Hash n <= LANES independent blocks, blocks[i] into digests[i], with the fastest kernel of the
+    CPU: 16 lanes with AVX-512, one block at a time with the SHA extensions, 8 lanes with AVX2.
+    Missing lanes are filled with dummy work on the first block.
+    */
+    static void hash_oneblock_xN(uint8_t *const digests[], const void *const blocks[],
+                                 size_t n = LANES)
+    {
+        static const CpuFeatures &cpu = CpuFeatures::get();
+        static const size_t lanes = cpu.avx512bw             ? LANES_AVX512
+                                    : cpu.sha && cpu.sse41 ? 1
+                                    : cpu.avx2             ? LANES_AVX2
+                                                           : 1;
 
+        hash_oneblock_lanes<Sha256>(digests, blocks, n, lanes, hash_oneblock_x16, hash_oneblock_x8);
+    }
+
+    // Batch API (utils/hash_batch.hpp) on contiguous arrays, through the multi-buffer kernels
+    static void hash_many(uint8_t *out, const uint8_t *in, size_t n)
+    {
+        hash_many_lanes<Sha256>(out, in, n);
+    }
+
+    static void hash_pairs(uint8_t *out, const uint8_t *left, const uint8_t *right, size_t n)
+    {
+        hash_pairs_lanes<Sha256>(out, left, right, n);
+    }
+
+    static void hash_oneblock_scalar(uint8_t *digest, const void *message)
+    {
         uint32_t w[64];
-        uint32_t wv[DIGEST_SIZE / sizeof(uint32_t)] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372,
-                                                       0xa54ff53a, 0x510e527f, 0x9b05688c,
-                                                       0x1f83d9ab, 0x5be0cd19};
+        uint32_t wv[DIGEST_SIZE / sizeof(uint32_t)];
+
+        for (uint32_t i = 0; i < 8; ++i)
+            wv[i] = IV[i];
 
         for (uint32_t i = 0; i < 16; ++i)
             w[i] = _bswap(((const uint32_t *)message)[i]);
@@ -45,7 +103,7 @@ public:
         for (uint32_t i = 0; i < 64; ++i)
         {
             uint32_t t1 = wv[7] + (_rotr(wv[4], 6) ^ _rotr(wv[4], 11) ^ _rotr(wv[4], 25)) +
-                          ((wv[4] & wv[5]) ^ (~wv[4] & wv[6])) + k[i] + w[i];
+                          ((wv[4] & wv[5]) ^ (~wv[4] & wv[6])) + K[i] + w[i];
 
             uint32_t t2 = (_rotr(wv[0], 2) ^ _rotr(wv[0], 13) ^ _rotr(wv[0], 22)) +
                           ((wv[0] & wv[1]) ^ (wv[0] & wv[2]) ^ (wv[1] & wv[2]));
@@ -60,17 +118,220 @@ public:
             wv[0] = t1 + t2;
         }
 
-        wv[0] += 0x6a09e667;
-        wv[1] += 0xbb67ae85;
-        wv[2] += 0x3c6ef372;
-        wv[3] += 0xa54ff53a;
-        wv[4] += 0x510e527f;
-        wv[5] += 0x9b05688c;
-        wv[6] += 0x1f83d9ab;
-        wv[7] += 0x5be0cd19;
-
         for (uint32_t i = 0; i < 8; i++)
-            ((uint32_t *)digest)[i] = _bswap(wv[i]);
+            ((uint32_t *)digest)[i] = _bswap(wv[i] + IV[i]);
+    }
+
+    /*
+    Same as hash_oneblock_scalar with the SHA extensions (sha256rnds2 does two rounds, msg1/msg2
+    compute the message schedule four words at a time). The state is kept as ABEF/CDGH, the order
+    sha256rnds2 expects.
+    */
+    CPU_TARGET("sha,sse4.1")
+    static void hash_oneblock_shani(uint8_t *digest, const void *message)
+    {
+        const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+        const __m128i *block = (const __m128i *)message;
+        __m128i msg[4];
+        __m128i tmp, m;
+
+        // load state as ABEF/CDGH
+        __m128i state0 = _mm_loadu_si128((const __m128i *)&IV[0]);
+        __m128i state1 = _mm_loadu_si128((const __m128i *)&IV[4]);
+
+        tmp = _mm_shuffle_epi32(state0, 0xb1);       // CDAB
+        state1 = _mm_shuffle_epi32(state1, 0x1b);    // EFGH
+        state0 = _mm_alignr_epi8(tmp, state1, 8);    // ABEF
+        state1 = _mm_blend_epi16(state1, tmp, 0xf0); // CDGH
+
+        const __m128i abef = state0;
+        const __m128i cdgh = state1;
+
+        // 16 groups of 4 rounds, msg[g % 4] holds the words 4g..4g+3 of the schedule
+        for (size_t g = 0; g < 16; ++g)
+        {
+            if (g < 4)
+                msg[g] = _mm_shuffle_epi8(_mm_loadu_si128(block + g), mask);
+
+            m = _mm_add_epi32(msg[g % 4], _mm_loadu_si128((const __m128i *)&K[4 * g]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, m);
+
+            if (g >= 3 && g < 15)
+            {
+                tmp = _mm_alignr_epi8(msg[g % 4], msg[(g + 3) % 4], 4);
+                msg[(g + 1) % 4] = _mm_add_epi32(msg[(g + 1) % 4], tmp);
+                msg[(g + 1) % 4] = _mm_sha256msg2_epu32(msg[(g + 1) % 4], msg[g % 4]);
+            }
+
+            m = _mm_shuffle_epi32(m, 0x0e);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, m);
+
+            if (g >= 1 && g < 13)
+                msg[(g + 3) % 4] = _mm_sha256msg1_epu32(msg[(g + 3) % 4], msg[g % 4]);
+        }
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+
+        // back to ABCD/EFGH, big endian
+        tmp = _mm_shuffle_epi32(state0, 0x1b);       // FEBA
+        state1 = _mm_shuffle_epi32(state1, 0xb1);    // DCHG
+        state0 = _mm_blend_epi16(tmp, state1, 0xf0); // DCBA
+        state1 = _mm_alignr_epi8(state1, tmp, 8);    // HGFE
+
+        _mm_storeu_si128((__m128i *)digest, _mm_shuffle_epi8(state0, mask));
+        _mm_storeu_si128((__m128i *)(digest + 16), _mm_shuffle_epi8(state1, mask));
+    }
+
+    /*
+    Multi-buffer kernels: LANES_AVX2 (resp. LANES_AVX512) independent blocks are hashed at once,
+    one block per 32-bit lane, with the message words transposed so that every round is a few
+    vector instructions for all the lanes. No SHA extensions are needed.
+    */
+    static constexpr size_t LANES_AVX2 = 8;
+    static constexpr size_t LANES_AVX512 = 16;
+
+    CPU_TARGET("avx2")
+    static void hash_oneblock_x8(uint8_t *const digests[LANES_AVX2],
+                                 const void *const blocks[LANES_AVX2])
+    {
+        const __m256i bswap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2,
+                                              3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1,
+                                              2, 3);
+        const uint32_t *b[LANES_AVX2];
+        __m256i w[16];
+        __m256i s[8];
+
+        for (size_t l = 0; l < LANES_AVX2; ++l)
+            b[l] = (const uint32_t *)blocks[l];
+
+        for (size_t t = 0; t < 16; ++t)
+            w[t] = _mm256_shuffle_epi8(_mm256_set_epi32(b[7][t], b[6][t], b[5][t], b[4][t],
+                                                        b[3][t], b[2][t], b[1][t], b[0][t]),
+                                       bswap);
+
+        for (size_t i = 0; i < 8; ++i)
+            s[i] = _mm256_set1_epi32(IV[i]);
+
+        for (size_t t = 0; t < 64; ++t)
+        {
+            if (t >= 16)
+            {
+                __m256i w2 = w[(t - 2) & 15], w15 = w[(t - 15) & 15];
+                __m256i sigma1 = _mm256_xor_si256(
+                    _mm256_xor_si256(ror8<17>(w2), ror8<19>(w2)), _mm256_srli_epi32(w2, 10));
+                __m256i sigma0 = _mm256_xor_si256(
+                    _mm256_xor_si256(ror8<7>(w15), ror8<18>(w15)), _mm256_srli_epi32(w15, 3));
+
+                w[t & 15] = _mm256_add_epi32(_mm256_add_epi32(w[t & 15], w[(t - 7) & 15]),
+                                             _mm256_add_epi32(sigma0, sigma1));
+            }
+
+            __m256i sum1 =
+                _mm256_xor_si256(_mm256_xor_si256(ror8<6>(s[4]), ror8<11>(s[4])), ror8<25>(s[4]));
+            __m256i ch = _mm256_xor_si256(_mm256_and_si256(s[4], s[5]),
+                                          _mm256_andnot_si256(s[4], s[6]));
+            __m256i t1 = _mm256_add_epi32(
+                _mm256_add_epi32(_mm256_add_epi32(s[7], sum1), _mm256_add_epi32(ch, w[t & 15])),
+                _mm256_set1_epi32(K[t]));
+            __m256i sum0 =
+                _mm256_xor_si256(_mm256_xor_si256(ror8<2>(s[0]), ror8<13>(s[0])), ror8<22>(s[0]));
+            __m256i maj = _mm256_or_si256(_mm256_and_si256(s[0], s[1]),
+                                          _mm256_and_si256(s[2], _mm256_or_si256(s[0], s[1])));
+
+            s[7] = s[6];
+            s[6] = s[5];
+            s[5] = s[4];
+            s[4] = _mm256_add_epi32(s[3], t1);
+            s[3] = s[2];
+            s[2] = s[1];
+            s[1] = s[0];
+            s[0] = _mm256_add_epi32(t1, _mm256_add_epi32(sum0, maj));
+        }
+
+        alignas(32) uint32_t out[8][LANES_AVX2];
+
+        for (size_t i = 0; i < 8; ++i)
+            _mm256_store_si256((__m256i *)out[i],
+                               _mm256_shuffle_epi8(_mm256_add_epi32(s[i], _mm256_set1_epi32(IV[i])),
+                                                   bswap));
+
+        for (size_t l = 0; l < LANES_AVX2; ++l)
+            for (size_t i = 0; i < 8; ++i)
+                ((uint32_t *)digests[l])[i] = out[i][l];
+    }
+
+    CPU_TARGET("avx512f,avx512bw")
+    static void hash_oneblock_x16(uint8_t *const digests[LANES_AVX512],
+                                  const void *const blocks[LANES_AVX512])
+    {
+        const __m512i bswap = _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+        const uint32_t *b[LANES_AVX512];
+        __m512i w[16];
+        __m512i s[8];
+
+        for (size_t l = 0; l < LANES_AVX512; ++l)
+            b[l] = (const uint32_t *)blocks[l];
+
+        for (size_t t = 0; t < 16; ++t)
+            w[t] = _mm512_shuffle_epi8(
+                _mm512_set_epi32(b[15][t], b[14][t], b[13][t], b[12][t], b[11][t], b[10][t],
+                                 b[9][t], b[8][t], b[7][t], b[6][t], b[5][t], b[4][t], b[3][t],
+                                 b[2][t], b[1][t], b[0][t]),
+                bswap);
+
+        for (size_t i = 0; i < 8; ++i)
+            s[i] = _mm512_set1_epi32(IV[i]);
+
+        for (size_t t = 0; t < 64; ++t)
+        {
+            if (t >= 16)
+            {
+                __m512i w2 = w[(t - 2) & 15], w15 = w[(t - 15) & 15];
+                __m512i sigma1 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(w2, 17),
+                                                           _mm512_ror_epi32(w2, 19),
+                                                           _mm512_srli_epi32(w2, 10), 0x96);
+                __m512i sigma0 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(w15, 7),
+                                                           _mm512_ror_epi32(w15, 18),
+                                                           _mm512_srli_epi32(w15, 3), 0x96);
+
+                w[t & 15] = _mm512_add_epi32(_mm512_add_epi32(w[t & 15], w[(t - 7) & 15]),
+                                             _mm512_add_epi32(sigma0, sigma1));
+            }
+
+            // 0x96: a ^ b ^ c, 0xca: a ? b : c, 0xe8: majority
+            __m512i sum1 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(s[4], 6),
+                                                     _mm512_ror_epi32(s[4], 11),
+                                                     _mm512_ror_epi32(s[4], 25), 0x96);
+            __m512i ch = _mm512_ternarylogic_epi32(s[4], s[5], s[6], 0xca);
+            __m512i t1 = _mm512_add_epi32(
+                _mm512_add_epi32(_mm512_add_epi32(s[7], sum1), _mm512_add_epi32(ch, w[t & 15])),
+                _mm512_set1_epi32(K[t]));
+            __m512i sum0 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(s[0], 2),
+                                                     _mm512_ror_epi32(s[0], 13),
+                                                     _mm512_ror_epi32(s[0], 22), 0x96);
+            __m512i maj = _mm512_ternarylogic_epi32(s[0], s[1], s[2], 0xe8);
+
+            s[7] = s[6];
+            s[6] = s[5];
+            s[5] = s[4];
+            s[4] = _mm512_add_epi32(s[3], t1);
+            s[3] = s[2];
+            s[2] = s[1];
+            s[1] = s[0];
+            s[0] = _mm512_add_epi32(t1, _mm512_add_epi32(sum0, maj));
+        }
+
+        alignas(64) uint32_t out[8][LANES_AVX512];
+
+        for (size_t i = 0; i < 8; ++i)
+            _mm512_store_si512(out[i],
+                               _mm512_shuffle_epi8(_mm512_add_epi32(s[i], _mm512_set1_epi32(IV[i])),
+                                                   bswap));
+
+        for (size_t l = 0; l < LANES_AVX512; ++l)
+            for (size_t i = 0; i < 8; ++i)
+                ((uint32_t *)digests[l])[i] = out[i][l];
     }
 
     static void hash_add(void *x, const void *y)
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "utils/cpu_features.hpp"
+#include "utils/hash_batch.hpp"
+
 #ifdef _WIN32
     #include <intrin.h>
 #else
@@ -9,46 +12,82 @@
 
 class Sha512
 {
+private:
+    template<int n>
+    CPU_TARGET("avx2")
+    static __m256i ror4(__m256i x)
+    {
+        return _mm256_or_si256(_mm256_srli_epi64(x, n), _mm256_slli_epi64(x, 64 - n));
+    }
+
 public:
     static constexpr size_t BLOCK_SIZE = 128;
     static constexpr size_t DIGEST_SIZE = 64;
 
+    static constexpr uint64_t IV[8] = {
+        0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+        0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179,
+    };
+
+    static constexpr uint64_t K[80] = {
+        0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
+        0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
+        0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+        0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 0xc19bf174cf692694,
+        0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+        0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+        0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4,
+        0xc6e00bf33da88fc2, 0xd5a79147930aa725, 0x06ca6351e003826f, 0x142929670a0e6e70,
+        0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+        0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+        0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30,
+        0xd192e819d6ef5218, 0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
+        0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
+        0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
+        0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+        0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b,
+        0xca273eceea26619c, 0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
+        0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
+        0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
+        0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
+    };
+
     Sha512() = delete;
 
-    static void hash_oneblock(uint8_t *digest, const void *message)
+    static constexpr size_t LANES = 8;
+
+    /*
+    Hash n <= LANES independent blocks, blocks[i] into digests[i], with the widest multi-buffer
+    kernel of the CPU: 8 lanes with AVX-512, 4 lanes with AVX2, one block at a time otherwise.
+    Missing lanes are filled with dummy work on the first block.
+    */
+    static void hash_oneblock_xN(uint8_t *const digests[], const void *const blocks[],
+                                 size_t n = LANES)
+    {
+        static const CpuFeatures &cpu = CpuFeatures::get();
+        static const size_t lanes = cpu.avx512bw ? LANES_AVX512 : cpu.avx2 ? LANES_AVX2 : 1;
+
+        hash_oneblock_lanes<Sha512>(digests, blocks, n, lanes, hash_oneblock_x8, hash_oneblock_x4);
+    }
+
+    // Batch API (utils/hash_batch.hpp) on contiguous arrays, through the multi-buffer kernels
+    static void hash_many(uint8_t *out, const uint8_t *in, size_t n)
+    {
+        hash_many_lanes<Sha512>(out, in, n);
+    }
+
+    static void hash_pairs(uint8_t *out, const uint8_t *left, const uint8_t *right, size_t n)
     {
-        static constexpr uint64_t sha512_k[80] = {
-            0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
-            0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
-            0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
-            0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 0xc19bf174cf692694,
-            0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
-            0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
-            0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4,
-            0xc6e00bf33da88fc2, 0xd5a79147930aa725, 0x06ca6351e003826f, 0x142929670a0e6e70,
-            0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
-            0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
-            0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30,
-            0xd192e819d6ef5218, 0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
-            0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
-            0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
-            0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
-            0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b,
-            0xca273eceea26619c, 0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
-            0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
-            0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
-            0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
-        };
-        static constexpr uint64_t sha512_abc[8] = {
-            0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
-            0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179,
-        };
+        hash_pairs_lanes<Sha512>(out, left, right, n);
+    }
 
+    static void hash_oneblock(uint8_t *digest, const void *message)
+    {
         uint64_t w[80];
-        uint64_t wv[DIGEST_SIZE / sizeof(uint64_t)] = {
-            0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
-            0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179,
-        };
+        uint64_t wv[DIGEST_SIZE / sizeof(uint64_t)];
+
+        for (uint64_t i = 0; i < 8; ++i)
+            wv[i] = IV[i];
 
         for (uint64_t i = 0; i < 16; ++i)
             w[i] = _bswap64(((const uint64_t *)message)[i]);
@@ -60,7 +99,7 @@ public:
         for (uint64_t j = 0; j < 80; j++)
         {
             uint64_t t1 = wv[7] + (_lrotr(wv[4], 14) ^ _lrotr(wv[4], 18) ^ _lrotr(wv[4], 41)) +
-                          ((wv[4] & wv[5]) ^ (~wv[4] & wv[6])) + sha512_k[j] + w[j];
+                          ((wv[4] & wv[5]) ^ (~wv[4] & wv[6])) + K[j] + w[j];
             uint64_t t2 = (_lrotr(wv[0], 28) ^ _lrotr(wv[0], 34) ^ _lrotr(wv[0], 39)) +
                           ((wv[0] & wv[1]) ^ (wv[0] & wv[2]) ^ (wv[1] & wv[2]));
 
@@ -74,17 +113,156 @@ public:
             wv[0] = t1 + t2;
         }
 
-        wv[0] += sha512_abc[0];
-        wv[1] += sha512_abc[1];
-        wv[2] += sha512_abc[2];
-        wv[3] += sha512_abc[3];
-        wv[4] += sha512_abc[4];
-        wv[5] += sha512_abc[5];
-        wv[6] += sha512_abc[6];
-        wv[7] += sha512_abc[7];
-
         for (uint64_t i = 0; i < 8; i++)
-            ((uint64_t *)digest)[i] = _bswap64(wv[i]);
+            ((uint64_t *)digest)[i] = _bswap64(wv[i] + IV[i]);
+    }
+
+    /*
+    Multi-buffer kernels: LANES_AVX2 (resp. LANES_AVX512) independent blocks are hashed at once,
+    one block per 64-bit lane, with the message words transposed. Same API as the SHA-256 ones.
+    */
+    static constexpr size_t LANES_AVX2 = 4;
+    static constexpr size_t LANES_AVX512 = 8;
+
+    CPU_TARGET("avx2")
+    static void hash_oneblock_x4(uint8_t *const digests[LANES_AVX2],
+                                 const void *const blocks[LANES_AVX2])
+    {
+        const __m256i bswap = _mm256_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6,
+                                              7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5,
+                                              6, 7);
+        const uint64_t *b[LANES_AVX2];
+        __m256i w[16];
+        __m256i s[8];
+
+        for (size_t l = 0; l < LANES_AVX2; ++l)
+            b[l] = (const uint64_t *)blocks[l];
+
+        for (size_t t = 0; t < 16; ++t)
+            w[t] = _mm256_shuffle_epi8(_mm256_set_epi64x(b[3][t], b[2][t], b[1][t], b[0][t]),
+                                       bswap);
+
+        for (size_t i = 0; i < 8; ++i)
+            s[i] = _mm256_set1_epi64x(IV[i]);
+
+        for (size_t t = 0; t < 80; ++t)
+        {
+            if (t >= 16)
+            {
+                __m256i w2 = w[(t - 2) & 15], w15 = w[(t - 15) & 15];
+                __m256i sigma1 = _mm256_xor_si256(
+                    _mm256_xor_si256(ror4<19>(w2), ror4<61>(w2)), _mm256_srli_epi64(w2, 6));
+                __m256i sigma0 = _mm256_xor_si256(
+                    _mm256_xor_si256(ror4<1>(w15), ror4<8>(w15)), _mm256_srli_epi64(w15, 7));
+
+                w[t & 15] = _mm256_add_epi64(_mm256_add_epi64(w[t & 15], w[(t - 7) & 15]),
+                                             _mm256_add_epi64(sigma0, sigma1));
+            }
+
+            __m256i sum1 = _mm256_xor_si256(_mm256_xor_si256(ror4<14>(s[4]), ror4<18>(s[4])),
+                                            ror4<41>(s[4]));
+            __m256i ch = _mm256_xor_si256(_mm256_and_si256(s[4], s[5]),
+                                          _mm256_andnot_si256(s[4], s[6]));
+            __m256i t1 = _mm256_add_epi64(
+                _mm256_add_epi64(_mm256_add_epi64(s[7], sum1), _mm256_add_epi64(ch, w[t & 15])),
+                _mm256_set1_epi64x(K[t]));
+            __m256i sum0 = _mm256_xor_si256(_mm256_xor_si256(ror4<28>(s[0]), ror4<34>(s[0])),
+                                            ror4<39>(s[0]));
+            __m256i maj = _mm256_or_si256(_mm256_and_si256(s[0], s[1]),
+                                          _mm256_and_si256(s[2], _mm256_or_si256(s[0], s[1])));
+
+            s[7] = s[6];
+            s[6] = s[5];
+            s[5] = s[4];
+            s[4] = _mm256_add_epi64(s[3], t1);
+            s[3] = s[2];
+            s[2] = s[1];
+            s[1] = s[0];
+            s[0] = _mm256_add_epi64(t1, _mm256_add_epi64(sum0, maj));
+        }
+
+        alignas(32) uint64_t out[8][LANES_AVX2];
+
+        for (size_t i = 0; i < 8; ++i)
+            _mm256_store_si256(
+                (__m256i *)out[i],
+                _mm256_shuffle_epi8(_mm256_add_epi64(s[i], _mm256_set1_epi64x(IV[i])), bswap));
+
+        for (size_t l = 0; l < LANES_AVX2; ++l)
+            for (size_t i = 0; i < 8; ++i)
+                ((uint64_t *)digests[l])[i] = out[i][l];
+    }
+
+    CPU_TARGET("avx512f,avx512bw")
+    static void hash_oneblock_x8(uint8_t *const digests[LANES_AVX512],
+                                 const void *const blocks[LANES_AVX512])
+    {
+        const __m512i bswap = _mm512_set4_epi64(0x08090a0b0c0d0e0f, 0x0001020304050607,
+                                                0x08090a0b0c0d0e0f, 0x0001020304050607);
+        const uint64_t *b[LANES_AVX512];
+        __m512i w[16];
+        __m512i s[8];
+
+        for (size_t l = 0; l < LANES_AVX512; ++l)
+            b[l] = (const uint64_t *)blocks[l];
+
+        for (size_t t = 0; t < 16; ++t)
+            w[t] = _mm512_shuffle_epi8(_mm512_set_epi64(b[7][t], b[6][t], b[5][t], b[4][t],
+                                                        b[3][t], b[2][t], b[1][t], b[0][t]),
+                                       bswap);
+
+        for (size_t i = 0; i < 8; ++i)
+            s[i] = _mm512_set1_epi64(IV[i]);
+
+        for (size_t t = 0; t < 80; ++t)
+        {
+            if (t >= 16)
+            {
+                __m512i w2 = w[(t - 2) & 15], w15 = w[(t - 15) & 15];
+                __m512i sigma1 = _mm512_ternarylogic_epi64(_mm512_ror_epi64(w2, 19),
+                                                           _mm512_ror_epi64(w2, 61),
+                                                           _mm512_srli_epi64(w2, 6), 0x96);
+                __m512i sigma0 = _mm512_ternarylogic_epi64(_mm512_ror_epi64(w15, 1),
+                                                           _mm512_ror_epi64(w15, 8),
+                                                           _mm512_srli_epi64(w15, 7), 0x96);
+
+                w[t & 15] = _mm512_add_epi64(_mm512_add_epi64(w[t & 15], w[(t - 7) & 15]),
+                                             _mm512_add_epi64(sigma0, sigma1));
+            }
+
+            // 0x96: a ^ b ^ c, 0xca: a ? b : c, 0xe8: majority
+            __m512i sum1 = _mm512_ternarylogic_epi64(_mm512_ror_epi64(s[4], 14),
+                                                     _mm512_ror_epi64(s[4], 18),
+                                                     _mm512_ror_epi64(s[4], 41), 0x96);
+            __m512i ch = _mm512_ternarylogic_epi64(s[4], s[5], s[6], 0xca);
+            __m512i t1 = _mm512_add_epi64(
+                _mm512_add_epi64(_mm512_add_epi64(s[7], sum1), _mm512_add_epi64(ch, w[t & 15])),
+                _mm512_set1_epi64(K[t]));
+            __m512i sum0 = _mm512_ternarylogic_epi64(_mm512_ror_epi64(s[0], 28),
+                                                     _mm512_ror_epi64(s[0], 34),
+                                                     _mm512_ror_epi64(s[0], 39), 0x96);
+            __m512i maj = _mm512_ternarylogic_epi64(s[0], s[1], s[2], 0xe8);
+
+            s[7] = s[6];
+            s[6] = s[5];
+            s[5] = s[4];
+            s[4] = _mm512_add_epi64(s[3], t1);
+            s[3] = s[2];
+            s[2] = s[1];
+            s[1] = s[0];
+            s[0] = _mm512_add_epi64(t1, _mm512_add_epi64(sum0, maj));
+        }
+
+        alignas(64) uint64_t out[8][LANES_AVX512];
+
+        for (size_t i = 0; i < 8; ++i)
+            _mm512_store_si512(
+                out[i],
+                _mm512_shuffle_epi8(_mm512_add_epi64(s[i], _mm512_set1_epi64(IV[i])), bswap));
+
+        for (size_t l = 0; l < LANES_AVX512; ++l)
+            for (size_t i = 0; i < 8; ++i)
+                ((uint64_t *)digests[l])[i] = out[i][l];
     }
 
     static void hash_add(void *x, const void *y)
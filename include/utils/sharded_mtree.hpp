@@ -0,0 +1,229 @@
+#pragma once
+
+#include "utils/fixed_mtree.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <omp.h>
+#include <vector>
+
+#ifndef _WIN32
+    #include <cctype>
+    #include <dirent.h>
+    #include <fstream>
+    #include <sched.h>
+    #include <string>
+    #include <sys/mman.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+/*
+Build a FixedMTree<height, Hash> as SHARDS_N independent subtrees of height shard_height.
+Shard i covers the leaves [i * SHARD_LEAVES_N, (i + 1) * SHARD_LEAVES_N) and can be built on its
+own (another process, another machine); the SHARDS_N shard roots are then merged to compute the
+top height - shard_height levels. The resulting root is the same as the one of the FixedMTree.
+*/
+template<size_t height, size_t shard_height, typename Hash>
+class ShardedMTree
+{
+    static_assert(shard_height > 0 && shard_height <= height, "Bad shard height");
+
+public:
+    using Shard = FixedMTree<shard_height, Hash>;
+
+    static constexpr size_t LEAVES_N = 1ULL << (height - 1);
+    static constexpr size_t SHARD_LEAVES_N = 1ULL << (shard_height - 1);
+    static constexpr size_t SHARDS_N = LEAVES_N / SHARD_LEAVES_N;
+    static constexpr size_t SHARD_NODES_N = (1ULL << shard_height) - 1;
+    static constexpr size_t INPUT_SIZE = LEAVES_N * Hash::BLOCK_SIZE;
+    static constexpr size_t SHARD_INPUT_SIZE = Shard::INPUT_SIZE;
+    static constexpr size_t ROOTS_SIZE = SHARDS_N * Hash::DIGEST_SIZE;
+
+    ShardedMTree() = delete;
+
+    // Build shard i, data being the input of the whole tree
+    static Shard build_shard(const void *data, size_t i)
+    {
+        return Shard{(const uint8_t *)data + i * SHARD_INPUT_SIZE, SHARD_INPUT_SIZE};
+    }
+
+    // Export the levels of a shard (SHARD_NODES_N digests, same layout as FixedMTree)
+    static void export_levels(uint8_t *out, const Shard &shard)
+    {
+        for (size_t i = 0; i < SHARD_NODES_N; ++i)
+            memcpy(out + i * Hash::DIGEST_SIZE, shard.get_node(i)->get_digest(),
+                   Hash::DIGEST_SIZE);
+    }
+
+    // Compute the root of the tree from the SHARDS_N shard roots, in shard order
+    static void merge(uint8_t *digest, const void *roots, size_t sz)
+    {
+        if (sz != ROOTS_SIZE)
+        {
+            std::cerr << "ShardedMTree: Bad size of shard roots\n";
+            return;
+        }
+
+        std::vector<uint8_t> level((const uint8_t *)roots, (const uint8_t *)roots + sz);
+        uint8_t block[Hash::BLOCK_SIZE]{};
+
+        // pairs are hashed in place, node i only overwrites nodes already consumed; the rest of
+        // the block stays zero, as in FixedMTree
+        for (size_t n = SHARDS_N; n > 1; n >>= 1)
+            for (size_t i = 0; i < n / 2; ++i)
+            {
+                memcpy(block, &level[2 * i * Hash::DIGEST_SIZE], 2 * Hash::DIGEST_SIZE);
+                Hash::hash_oneblock(&level[i * Hash::DIGEST_SIZE], block);
+            }
+
+        memcpy(digest, level.data(), Hash::DIGEST_SIZE);
+    }
+
+#ifndef _WIN32
+    /*
+    Local driver: fork one worker per CPU (or `workers` workers spread over the NUMA nodes), pin
+    it to the CPUs of its node, let it build a contiguous range of shards, and collect the shard
+    roots through shared memory. Workers only call Shard::build_serial, which never enters libgomp,
+    so they are safe to fork even after the parent has run parallel regions. Returns false if a
+    worker failed.
+    */
+    static bool build_forked(uint8_t *digest, const void *data, size_t sz, size_t workers = 0)
+    {
+        if (sz != INPUT_SIZE)
+        {
+            std::cerr << "ShardedMTree: Bad size of input data\n";
+            return false;
+        }
+
+        std::vector<cpu_set_t> nodes = numa_nodes();
+        std::vector<size_t> cpu_node;
+
+        for (size_t n = 0; n < nodes.size(); ++n)
+            cpu_node.insert(cpu_node.end(), CPU_COUNT(&nodes[n]), n);
+
+        if (workers == 0)
+            workers = cpu_node.size();
+        workers = std::min(workers, SHARDS_N);
+
+        void *shm = mmap(nullptr, ROOTS_SIZE, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (shm == MAP_FAILED)
+        {
+            std::cerr << "ShardedMTree: Cannot allocate shared memory\n";
+            return false;
+        }
+
+        uint8_t *roots = (uint8_t *)shm;
+        std::vector<typename Shard::Node> shard(SHARD_NODES_N); // allocated before forking
+        std::vector<pid_t> pids;
+        bool ok = true;
+
+        for (size_t w = 0; w < workers; ++w)
+        {
+            pid_t pid = fork();
+
+            if (pid == 0)
+            {
+                const cpu_set_t &cpus = nodes[cpu_node[w * cpu_node.size() / workers]];
+
+                sched_setaffinity(0, sizeof(cpus), &cpus);
+
+                for (size_t i = w * SHARDS_N / workers; i < (w + 1) * SHARDS_N / workers; ++i)
+                {
+                    Shard::build_serial(shard.data(), (const uint8_t *)data + i * SHARD_INPUT_SIZE);
+                    memcpy(roots + i * Hash::DIGEST_SIZE, shard.back().get_digest(),
+                           Hash::DIGEST_SIZE);
+                }
+
+                _exit(0);
+            }
+
+            if (pid < 0)
+            {
+                std::cerr << "ShardedMTree: Cannot fork worker\n";
+                ok = false;
+                break;
+            }
+
+            pids.push_back(pid);
+        }
+
+        for (auto &&pid : pids)
+        {
+            int status = 0;
+
+            waitpid(pid, &status, 0);
+            ok &= WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        }
+
+        if (ok)
+            merge(digest, roots, ROOTS_SIZE);
+
+        munmap(shm, ROOTS_SIZE);
+
+        return ok;
+    }
+
+private:
+    // Our CPUs on each NUMA node, or a single set with all of them if NUMA info is not available
+    static std::vector<cpu_set_t> numa_nodes()
+    {
+        std::vector<cpu_set_t> nodes;
+        cpu_set_t allowed;
+        DIR *dir = opendir("/sys/devices/system/node");
+
+        sched_getaffinity(0, sizeof(allowed), &allowed);
+
+        if (dir)
+        {
+            std::vector<std::string> names;
+
+            for (dirent *ent; (ent = readdir(dir));)
+                if (strncmp(ent->d_name, "node", 4) == 0 && isdigit(ent->d_name[4]))
+                    names.emplace_back(ent->d_name);
+            closedir(dir);
+            std::sort(names.begin(), names.end());
+
+            for (auto &&name : names)
+            {
+                std::ifstream in{"/sys/devices/system/node/" + name + "/cpulist"};
+                std::string list;
+                cpu_set_t cpus;
+
+                CPU_ZERO(&cpus);
+                std::getline(in, list);
+
+                // format is like "0-3,8-11"
+                for (size_t pos = 0; pos < list.size();)
+                {
+                    size_t end = list.find(',', pos);
+                    std::string range = list.substr(pos, end - pos);
+                    size_t dash = range.find('-');
+                    size_t first = std::stoul(range);
+                    size_t last = first;
+
+                    if (dash != std::string::npos)
+                        last = std::stoul(range.substr(dash + 1));
+
+                    for (size_t c = first; c <= last; ++c)
+                        CPU_SET(c, &cpus);
+
+                    pos = end == std::string::npos ? list.size() : end + 1;
+                }
+
+                // only the CPUs we may run on
+                CPU_AND(&cpus, &cpus, &allowed);
+                if (CPU_COUNT(&cpus))
+                    nodes.push_back(cpus);
+            }
+        }
+
+        if (nodes.empty())
+            nodes.push_back(allowed);
+
+        return nodes;
+    }
+#endif
+};
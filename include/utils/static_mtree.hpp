@@ -0,0 +1,341 @@
+#pragma once
+
+#include "utils/string_utils.hpp"
+
+#include <array>
+#include <cstring>
+#include <iostream>
+
+#if __cplusplus >= 202002L
+    #include <ranges>
+#endif
+
+/*
+Small trees stored by value in an std::array, without any heap allocation nor pointers: a node is
+just its digest and the tree structure is given by the node indices, which follow the same layout
+as FixedMTree, FixedMTreePath and FixedAbr. All these classes are trivially copyable, so they can
+be copied, returned and kept in registers/L1 freely (e.g. path rebuilds in a verification loop).
+*/
+static constexpr size_t STATIC_TREE_MAX_HEIGHT = 8;
+
+template<typename Hash>
+class StaticNode
+{
+private:
+    uint8_t digest[Hash::DIGEST_SIZE];
+
+public:
+    StaticNode() = default;
+
+    // Leaf: hash of a whole block
+    explicit StaticNode(const uint8_t *block) { Hash::hash_oneblock(this->digest, block); }
+
+    // Merkle node: hash of the concatenation of the children
+    StaticNode(const uint8_t *left, const uint8_t *right)
+    {
+        uint8_t block[Hash::BLOCK_SIZE]{};
+
+        memcpy(block, left, Hash::DIGEST_SIZE);
+        memcpy(block + Hash::DIGEST_SIZE, right, Hash::DIGEST_SIZE);
+
+        Hash::hash_oneblock(this->digest, block);
+    }
+
+    // ABR node, same as FixedAbrNode
+    StaticNode(const uint8_t *left, const uint8_t *right, const uint8_t *middle)
+    {
+        uint8_t block[Hash::BLOCK_SIZE];
+
+        memcpy(block, left, Hash::DIGEST_SIZE);
+        memcpy(block + Hash::DIGEST_SIZE, right, Hash::DIGEST_SIZE);
+
+        Hash::hash_add(block, middle);
+        Hash::hash_add(block + Hash::DIGEST_SIZE, middle);
+        Hash::hash_oneblock(this->digest, block);
+        Hash::hash_add(this->digest, right);
+    }
+
+    const uint8_t *get_digest() const { return digest; }
+};
+
+
+template<size_t height, typename Hash>
+class StaticMTree
+{
+    static_assert(height > 1 && height <= STATIC_TREE_MAX_HEIGHT, "Use FixedMTree for big trees");
+
+public:
+    using Node = StaticNode<Hash>;
+
+    static constexpr size_t LEAVES_N = 1ULL << (height - 1);
+    static constexpr size_t NODES_N = (1ULL << height) - 1;
+    static constexpr size_t INPUT_SIZE = LEAVES_N * Hash::BLOCK_SIZE;
+
+private:
+    std::array<Node, NODES_N> nodes{};
+
+    static constexpr size_t level_offset(size_t level)
+    {
+        return 2 * LEAVES_N - (2 * LEAVES_N >> level);
+    }
+
+    void print(std::ostream &os, size_t level, size_t i) const
+    {
+        for (size_t j = level; j < height - 1; ++j)
+            os << "    ";
+
+        os << "*: "
+           << hexdump(nodes[level_offset(level) + i].get_digest(), Hash::DIGEST_SIZE, false, 64)
+           << '\n';
+
+        if (level > 0)
+        {
+            print(os, level - 1, 2 * i);
+            print(os, level - 1, 2 * i + 1);
+        }
+    }
+
+public:
+    StaticMTree() = default;
+
+#if __cplusplus >= 202002L
+    template<std::ranges::range Range>
+    StaticMTree(const Range &range) :
+        StaticMTree(std::ranges::cdata(range),
+                    std::ranges::size(range) * sizeof(*std::ranges::cdata(range)))
+    {}
+#endif
+
+    template<typename Iter>
+    StaticMTree(const Iter begin, const Iter end) :
+        StaticMTree(&*begin, std::distance(begin, end) * sizeof(*begin))
+    {}
+
+    StaticMTree(const void *vdata, size_t sz)
+    {
+        if (sz != INPUT_SIZE)
+        {
+            std::cerr << "StaticMTree: Bad size of input data\n";
+            return;
+        }
+
+        const uint8_t *data = (const uint8_t *)vdata;
+
+        // add leaves
+        for (size_t i = 0; i < LEAVES_N; ++i)
+            nodes[i] = Node{data + Hash::BLOCK_SIZE * i};
+
+        // build tree bottom-up
+        for (size_t i = 0, last = LEAVES_N; last < NODES_N; i += 2, ++last)
+            nodes[last] = Node{nodes[i].get_digest(), nodes[i + 1].get_digest()};
+    }
+
+    const uint8_t *digest() const { return nodes[NODES_N - 1].get_digest(); }
+
+    const Node *get_node(size_t i) const { return &nodes[i]; }
+
+    friend std::ostream &operator<<(std::ostream &os, const StaticMTree &tree)
+    {
+        tree.print(os, height - 1, 0);
+
+        return os;
+    }
+};
+
+
+template<size_t height, typename Hash>
+class StaticMTreePath
+{
+    static_assert(height > 1, "Bad tree height");
+
+public:
+    using Node = StaticNode<Hash>;
+
+    static constexpr size_t NODES_N = 2 * height - 1;
+    static constexpr size_t INPUT_SIZE = height * Hash::DIGEST_SIZE;
+
+private:
+    /*
+    Nodes layout is the same as FixedMTreePath: nodes[0] and nodes[1] are the leaves, then each
+    even node is the hash of the two previous ones and each odd node is the next sibling.
+    */
+    std::array<Node, NODES_N> nodes{};
+
+    void print(std::ostream &os, size_t i, size_t depth) const
+    {
+        for (size_t j = 0; j < depth; ++j)
+            os << "    ";
+
+        os << "*: " << hexdump(nodes[i].get_digest(), Hash::DIGEST_SIZE, false, 64) << '\n';
+
+        if (i >= 2 && i % 2 == 0)
+        {
+            print(os, i - 2, depth + 1);
+            print(os, i - 1, depth + 1);
+        }
+    }
+
+public:
+    StaticMTreePath() = default;
+
+#if __cplusplus >= 202002L
+    template<std::ranges::range Range>
+    StaticMTreePath(const Range &range) :
+        StaticMTreePath(std::ranges::cdata(range),
+                        std::ranges::size(range) * sizeof(*std::ranges::cdata(range)))
+    {}
+#endif
+
+    template<typename Iter>
+    StaticMTreePath(const Iter begin, const Iter end) :
+        StaticMTreePath(&*begin, std::distance(begin, end) * sizeof(*begin))
+    {}
+
+    StaticMTreePath(const void *vdata, size_t sz)
+    {
+        if (sz != INPUT_SIZE)
+        {
+            std::cerr << "StaticMTreePath: Bad size of input data\n";
+            return;
+        }
+
+        const uint8_t *data = (const uint8_t *)vdata;
+
+        // add leaves (they are already digests)
+        memcpy(&nodes[0], data, Hash::DIGEST_SIZE);
+        memcpy(&nodes[1], data + Hash::DIGEST_SIZE, Hash::DIGEST_SIZE);
+
+        // build tree bottom-up
+        for (size_t i = 2, j = 2; i < NODES_N; i += 2, ++j)
+        {
+            nodes[i] = Node{nodes[i - 2].get_digest(), nodes[i - 1].get_digest()};
+            if (i + 1 < NODES_N)
+                memcpy(&nodes[i + 1], data + j * Hash::DIGEST_SIZE, Hash::DIGEST_SIZE);
+        }
+    }
+
+    const uint8_t *digest() const { return nodes[NODES_N - 1].get_digest(); }
+
+    const Node *get_node(size_t i) const { return &nodes[i]; }
+
+    friend std::ostream &operator<<(std::ostream &os, const StaticMTreePath &tree)
+    {
+        tree.print(os, NODES_N - 1, 0);
+
+        return os;
+    }
+};
+
+
+template<size_t height, typename Hash>
+class StaticAbr
+{
+    static_assert(height > 2 && height <= STATIC_TREE_MAX_HEIGHT, "Use FixedAbr for big trees");
+
+public:
+    using Node = StaticNode<Hash>;
+
+    static constexpr size_t INTERNAL_N = (1ULL << (height - 2)) - 1;
+    static constexpr size_t LEAVES_N = 1ULL << (height - 1);
+    static constexpr size_t INPUT_N = LEAVES_N + INTERNAL_N;
+    static constexpr size_t INPUT_SIZE = INPUT_N * Hash::BLOCK_SIZE;
+    static constexpr size_t NODES_N = (1ULL << height) - 1 + INTERNAL_N;
+
+private:
+    /*
+    Nodes layout is the same as FixedAbr:
+    - The first LEAVES_N nodes contain the leaves
+    - The next INTERNAL_N nodes contain the "internal leaves" (aka middle nodes)
+    - The remaining nodes are the internal nodes of the tree, layer by layer
+    */
+    std::array<Node, NODES_N> nodes{};
+
+    // offset of the t-th internal layer (0 is the one just above the leaves)
+    static constexpr size_t layer_offset(size_t t)
+    {
+        return INPUT_N + LEAVES_N - (LEAVES_N >> t);
+    }
+
+    // offset of the middle nodes of the t-th internal layer (t > 0)
+    static constexpr size_t middle_offset(size_t t)
+    {
+        return LEAVES_N + LEAVES_N / 2 - (LEAVES_N >> t);
+    }
+
+    void print(std::ostream &os, size_t i, char tag, size_t depth) const
+    {
+        for (size_t j = 0; j < depth; ++j)
+            os << "    ";
+
+        os << tag << ": " << hexdump(nodes[i].get_digest(), Hash::DIGEST_SIZE) << '\n';
+    }
+
+    void print(std::ostream &os, size_t t, size_t p, char tag, size_t depth) const
+    {
+        print(os, layer_offset(t) + p, tag, depth);
+
+        if (t == 0)
+        {
+            print(os, 2 * p, 'L', depth + 1);
+            print(os, 2 * p + 1, 'R', depth + 1);
+        }
+        else
+        {
+            print(os, t - 1, 2 * p, 'L', depth + 1);
+            print(os, middle_offset(t) + p, 'M', depth + 1);
+            print(os, t - 1, 2 * p + 1, 'R', depth + 1);
+        }
+    }
+
+public:
+    StaticAbr() = default;
+
+#if __cplusplus >= 202002L
+    template<std::ranges::range Range>
+    StaticAbr(const Range &range) :
+        StaticAbr(std::ranges::cdata(range),
+                  std::ranges::size(range) * sizeof(*std::ranges::cdata(range)))
+    {}
+#endif
+
+    template<typename Iter>
+    StaticAbr(const Iter begin, const Iter end) :
+        StaticAbr(&*begin, std::distance(begin, end) * sizeof(*begin))
+    {}
+
+    StaticAbr(const void *vdata, size_t sz)
+    {
+        if (sz / Hash::BLOCK_SIZE != INPUT_N || sz % Hash::BLOCK_SIZE != 0)
+        {
+            std::cerr << "StaticAbr: Bad size of input data\n";
+            return;
+        }
+
+        const uint8_t *data = (const uint8_t *)vdata;
+        size_t last = INPUT_N;
+
+        // add leaves and middle nodes
+        for (size_t i = 0; i < INPUT_N; ++i)
+            nodes[i] = Node{data + Hash::BLOCK_SIZE * i};
+
+        // build first internal layer (only hash, no addition)
+        for (size_t i = 0; i < LEAVES_N; i += 2)
+            nodes[last++] = Node{nodes[i].get_digest(), nodes[i + 1].get_digest()};
+
+        // build the other layers, each node with its middle node
+        for (size_t i = INPUT_N, e = LEAVES_N; last < NODES_N; i += 2, ++e)
+            nodes[last++] = Node{nodes[i].get_digest(), nodes[i + 1].get_digest(),
+                                 nodes[e].get_digest()};
+    }
+
+    const uint8_t *digest() const { return nodes[NODES_N - 1].get_digest(); }
+
+    const Node *get_node(size_t i) const { return &nodes[i]; }
+
+    friend std::ostream &operator<<(std::ostream &os, const StaticAbr &tree)
+    {
+        tree.print(os, height - 2, 0, '*', 0);
+
+        return os;
+    }
+};
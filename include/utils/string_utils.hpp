@@ -202,11 +202,11 @@ std::string hexdump(const T (&arr)[sz], bool upper = false, size_t spacing = 0)
 template<bool reverse = false, long limbs = 4>
 std::string hexdump(const libff::bigint<limbs> &x, bool upper = false, size_t spacing = 0)
 {
-    uint8_t buff[limbs * 8]{}; // limbs are 64-bit wide
-    mpz_class tmp;
+    uint8_t buff[limbs * 8]; // limbs are 64-bit wide, most significant first
 
-    x.to_mpz(tmp.get_mpz_t());
-    mpz_export(buff, NULL, 1, 1, 0, 0, tmp.get_mpz_t());
+    for (long i = 0; i < limbs; ++i)
+        for (size_t j = 0; j < 8; ++j)
+            buff[i * 8 + j] = (uint8_t)(x.data[limbs - 1 - i] >> (56 - 8 * j));
 
     return hexdump<reverse>(buff, upper, spacing);
 }
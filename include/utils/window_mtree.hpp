@@ -0,0 +1,237 @@
+#pragma once
+
+#include "utils/hash_batch.hpp"
+#include "utils/string_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <omp.h>
+#include <vector>
+
+#if __cplusplus >= 202002L
+    #include <ranges>
+#endif
+
+/*
+Merkle tree over a sliding window of the last LEAVES_N events. Leaves are a ring buffer: pushing
+new events overwrites the oldest slots, and only the paths from the overwritten slots to the root
+are recomputed. Leaves and internal nodes are hashed as in FixedMTree, hence a window built from
+LEAVES_N blocks has the same root as a FixedMTree over the same blocks in slot order.
+*/
+template<size_t height, typename Hash>
+class WindowMTree
+{
+public:
+    static constexpr size_t LEAVES_N = 1ULL << (height - 1);
+    static constexpr size_t NODES_N = (1ULL << height) - 1;
+    static constexpr size_t INPUT_SIZE = LEAVES_N * Hash::BLOCK_SIZE;
+    static constexpr size_t PATH_SIZE = height * Hash::DIGEST_SIZE;
+
+private:
+    /*
+    Nodes layout is the same as FixedMTree: the first LEAVES_N digests are the leaves (slots of
+    the ring buffer), followed by each upper level, the root being the last one.
+    */
+    std::vector<uint8_t> digests;
+    size_t next = 0;  // slot that will receive the next event
+    size_t count = 0; // number of events currently in the window
+
+    static constexpr size_t level_offset(size_t level)
+    {
+        return 2 * LEAVES_N - (2 * LEAVES_N >> level);
+    }
+
+    uint8_t *node(size_t level, size_t i)
+    {
+        return &digests[(level_offset(level) + i) * Hash::DIGEST_SIZE];
+    }
+
+    const uint8_t *node(size_t level, size_t i) const
+    {
+        return &digests[(level_offset(level) + i) * Hash::DIGEST_SIZE];
+    }
+
+    // Rehash the n <= HASH_SLICE_N nodes pos[0..n) of a level from their children
+    void hash_children(size_t level, const size_t *pos, size_t n)
+    {
+        uint8_t left[HASH_SLICE_N][Hash::DIGEST_SIZE]{};
+        uint8_t right[HASH_SLICE_N][Hash::DIGEST_SIZE]{};
+        uint8_t out[HASH_SLICE_N][Hash::DIGEST_SIZE];
+
+        for (size_t j = 0; j < n; ++j)
+        {
+            memcpy(left[j], node(level - 1, 2 * pos[j]), Hash::DIGEST_SIZE);
+            memcpy(right[j], node(level - 1, 2 * pos[j] + 1), Hash::DIGEST_SIZE);
+        }
+        hash_pairs<Hash>(out[0], left[0], right[0], n);
+
+        for (size_t j = 0; j < n; ++j)
+            memcpy(node(level, pos[j]), out[j], Hash::DIGEST_SIZE);
+    }
+
+    void build(const uint8_t *data)
+    {
+#pragma omp parallel for
+        for (size_t c = 0; c < LEAVES_N; c += HASH_SLICE_N)
+            hash_many<Hash>(node(0, c), data + Hash::BLOCK_SIZE * c,
+                            std::min(HASH_SLICE_N, LEAVES_N - c));
+
+        for (size_t level = 1; level < height; ++level)
+        {
+            size_t n = LEAVES_N >> level;
+
+#pragma omp parallel for
+            for (size_t c = 0; c < n; c += HASH_SLICE_N)
+                hash_level<Hash>(node(level, c), node(level - 1, 2 * c),
+                                 std::min(HASH_SLICE_N, n - c));
+        }
+    }
+
+public:
+    // An empty window, whose slots hold the digest of the all-zero block
+    WindowMTree() : digests(NODES_N * Hash::DIGEST_SIZE)
+    {
+        std::vector<uint8_t> zero(INPUT_SIZE);
+
+        build(zero.data());
+    }
+
+#if __cplusplus >= 202002L
+    template<std::ranges::range Range>
+    WindowMTree(const Range &range) :
+        WindowMTree(std::ranges::cdata(range),
+                    std::ranges::size(range) * sizeof(*std::ranges::cdata(range)))
+    {}
+#endif
+
+    template<typename Iter>
+    WindowMTree(const Iter begin, const Iter end) :
+        WindowMTree(&*begin, std::distance(begin, end) * sizeof(*begin))
+    {}
+
+    // A full window of LEAVES_N events
+    WindowMTree(const void *vdata, size_t sz) : digests(NODES_N * Hash::DIGEST_SIZE)
+    {
+        if (sz != INPUT_SIZE)
+        {
+            std::cerr << "WindowMTree: Bad size of input data\n";
+            return;
+        }
+
+        build((const uint8_t *)vdata);
+        count = LEAVES_N;
+    }
+
+    /*
+    Append sz / BLOCK_SIZE events, evicting the oldest ones once the window is full. Only the
+    ancestors of the overwritten slots are recomputed: they are deduplicated and rehashed level by
+    level in parallel.
+    */
+    void push(const void *vdata, size_t sz)
+    {
+        if (sz % Hash::BLOCK_SIZE != 0)
+        {
+            std::cerr << "WindowMTree: Bad size of input data\n";
+            return;
+        }
+
+        const uint8_t *data = (const uint8_t *)vdata;
+        size_t n = sz / Hash::BLOCK_SIZE;
+
+        // events that would be evicted within this same batch are never stored
+        if (n > LEAVES_N)
+        {
+            data += (n - LEAVES_N) * Hash::BLOCK_SIZE;
+            next = (next + n - LEAVES_N) % LEAVES_N;
+            n = LEAVES_N;
+        }
+
+        if (n == 0)
+            return;
+
+        std::vector<size_t> dirty(n);
+
+        for (size_t i = 0; i < n; ++i)
+            dirty[i] = (next + i) % LEAVES_N;
+
+        // the new events fill at most two runs of consecutive slots, [next, ...) then [0, ...)
+        size_t run = std::min(n, LEAVES_N - next);
+
+#pragma omp parallel for
+        for (size_t c = 0; c < run; c += HASH_SLICE_N)
+            hash_many<Hash>(node(0, dirty[c]), data + Hash::BLOCK_SIZE * c,
+                            std::min(HASH_SLICE_N, run - c));
+
+#pragma omp parallel for
+        for (size_t c = run; c < n; c += HASH_SLICE_N)
+            hash_many<Hash>(node(0, dirty[c]), data + Hash::BLOCK_SIZE * c,
+                            std::min(HASH_SLICE_N, n - c));
+
+        next = (next + n) % LEAVES_N;
+        count = std::min(count + n, LEAVES_N);
+
+        std::sort(dirty.begin(), dirty.end());
+        for (size_t level = 1; level < height; ++level)
+        {
+            for (auto &&x : dirty)
+                x >>= 1;
+            dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
+#pragma omp parallel for
+            for (size_t c = 0; c < dirty.size(); c += HASH_SLICE_N)
+                hash_children(level, &dirty[c], std::min(HASH_SLICE_N, dirty.size() - c));
+        }
+    }
+
+    const uint8_t *digest() const { return node(height - 1, 0); }
+
+    // Number of events in the window
+    size_t size() const { return count; }
+
+    // Slot holding the event at position pos of the window (0 is the oldest)
+    size_t slot(size_t pos) const { return (next + LEAVES_N - count + pos) % LEAVES_N; }
+
+    const uint8_t *get_leaf(size_t pos) const { return node(0, slot(pos)); }
+
+    /*
+    Write the authentication path of the event at position pos of the window: its digest,
+    followed by its sibling at each level (PATH_SIZE bytes, like the input of FixedMTreePath).
+    Returns the slot of the event, whose bits tell on which side each sibling is.
+    */
+    size_t path(size_t pos, uint8_t *out) const
+    {
+        if (pos >= count)
+        {
+            std::cerr << "WindowMTree: Element out of the window\n";
+            return LEAVES_N;
+        }
+
+        size_t idx = slot(pos);
+
+        memcpy(out, node(0, idx), Hash::DIGEST_SIZE);
+        for (size_t level = 0, i = idx; level < height - 1; ++level, i >>= 1)
+            memcpy(out + (level + 1) * Hash::DIGEST_SIZE, node(level, i ^ 1), Hash::DIGEST_SIZE);
+
+        return idx;
+    }
+
+    // Check a path produced by path() against a root
+    static bool verify_path(const uint8_t *root, const uint8_t *path, size_t idx)
+    {
+        uint8_t block[Hash::BLOCK_SIZE]{};
+        uint8_t digest[Hash::DIGEST_SIZE];
+
+        memcpy(digest, path, Hash::DIGEST_SIZE);
+        for (size_t level = 1; level < height; ++level, idx >>= 1)
+        {
+            const uint8_t *sibling = path + level * Hash::DIGEST_SIZE;
+
+            memcpy(block + (idx & 1) * Hash::DIGEST_SIZE, digest, Hash::DIGEST_SIZE);
+            memcpy(block + (~idx & 1) * Hash::DIGEST_SIZE, sibling, Hash::DIGEST_SIZE);
+            Hash::hash_oneblock(digest, block);
+        }
+
+        return memcmp(digest, root, Hash::DIGEST_SIZE) == 0;
+    }
+};
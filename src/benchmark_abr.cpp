@@ -1,9 +1,11 @@
 #define CURVE_ALT_BN128
 
 #include "gadget/abr_gadget.hpp"
+#include "gadget/blake2s/blake2s_gadget.hpp"
 #include "gadget/mimc256/mimc256_gadget.hpp"
 #include "gadget/mimc512f/mimc512f_gadget.hpp"
 #include "gadget/mimc512f2k/mimc512f2k_gadget.hpp"
+#include "gadget/poseidon256/poseidon256_gadget.hpp"
 #include "gadget/sha256/sha256_gadget.hpp"
 #include "gadget/sha512/sha512_gadget.hpp"
 #include "utils/fixed_abr.hpp"
@@ -27,9 +29,11 @@ using FieldT = libff::Fr<ppT>;
 
 using GadSha256 = libsnark::sha256_two_to_one_hash_gadget<FieldT>;
 using GadSha512 = libsnark::sha512::sha512_two_to_one_hash_gadget<FieldT>;
+using GadBlake2s = blake2s_two_to_one_hash_gadget<FieldT>;
 using GadMimc256 = mimc256_two_to_one_hash_gadget<FieldT>;
 using GadMimc512F = mimc512f_two_to_one_hash_gadget<FieldT>;
 using GadMimc512F2K = mimc512f2k_two_to_one_hash_gadget<FieldT>;
+using GadPoseidon256 = poseidon256_two_to_one_hash_gadget<FieldT>;
 
 std::ofstream log_file{"log.txt"};
 
@@ -355,6 +359,10 @@ int main()
     log_file << "Height\tTree\tGadget\tConstraint\tWitness\tKey\tProof\tVerify\n";
     test_tRee_from<MIN_TREE_HEIGHT, MAX_TREE_HEIGHT, Sha512, GadSha512>("SHA512");
 
+    log_file << "BLAKE2s\n";
+    log_file << "Height\tTree\tGadget\tConstraint\tWitness\tKey\tProof\tVerify\n";
+    test_tRee_from<MIN_TREE_HEIGHT, MAX_TREE_HEIGHT, Blake2s, GadBlake2s>("BLAKE2s");
+
     log_file << "MiMC256\n";
     log_file << "Height\tTree\tGadget\tConstraint\tWitness\tKey\tProof\tVerify\n";
     test_ptRee_from<MIN_TREE_HEIGHT, MAX_TREE_HEIGHT, Mimc256, GadMimc256>("MiMC256");
@@ -367,5 +375,9 @@ int main()
     log_file << "Height\tTree\tGadget\tConstraint\tWitness\tKey\tProof\tVerify\n";
     test_ptRee_from<MIN_TREE_HEIGHT, MAX_TREE_HEIGHT, Mimc512F2K, GadMimc512F2K>("MiMC512f2k");
 
+    log_file << "Poseidon256\n";
+    log_file << "Height\tTree\tGadget\tConstraint\tWitness\tKey\tProof\tVerify\n";
+    test_ptRee_from<MIN_TREE_HEIGHT, MAX_TREE_HEIGHT, Poseidon256, GadPoseidon256>("Poseidon256");
+
     return 0;
 }
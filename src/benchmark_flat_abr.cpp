@@ -0,0 +1,96 @@
+#include "utils/fixed_abr.hpp"
+#include "utils/flat_abr.hpp"
+#include "utils/measure.hpp"
+#include "utils/sha256.hpp"
+#include "utils/sha512.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <omp.h>
+#include <random>
+#include <vector>
+
+static constexpr size_t MIN_TREE_HEIGHT = 10;
+static constexpr size_t MAX_TREE_HEIGHT = 21;
+static constexpr size_t REPEAT = 5;
+
+std::ofstream log_file{"log.txt"};
+
+/*
+Build time of FixedAbr (pointer nodes) against FlatAbr (flat arrays) on the same input, both with
+all the OpenMP threads, then of FixedAbr on a single thread as a serial reference
+*/
+template<size_t tree_height, typename Hash>
+bool test_build()
+{
+    using FixTree = FixedAbr<tree_height, Hash>;
+    using FlatTree = FlatAbr<tree_height, Hash>;
+
+    static std::mt19937 rng{std::random_device{}()};
+
+    std::vector<uint8_t> data(FixTree::INPUT_SIZE);
+    std::generate(data.begin(), data.end(), std::ref(rng));
+
+    uint8_t fixed_digest[Hash::DIGEST_SIZE];
+    uint8_t flat_digest[Hash::DIGEST_SIZE];
+
+    auto build_fixed = [&]()
+    {
+        FixTree tree{data.data(), data.size()};
+        memcpy(fixed_digest, tree.digest(), Hash::DIGEST_SIZE);
+    };
+
+    double elap_fixed = measure(build_fixed, REPEAT, 1, nullptr, false);
+
+    double elap_flat = measure(
+        [&]()
+        {
+            FlatTree tree{data.data(), data.size()};
+            memcpy(flat_digest, tree.digest(), Hash::DIGEST_SIZE);
+        },
+        REPEAT, 1, nullptr, false);
+
+    const int threads = omp_get_max_threads();
+
+    omp_set_num_threads(1);
+    double elap_serial = measure(build_fixed, REPEAT, 1, nullptr, false);
+    omp_set_num_threads(threads);
+
+    bool check = memcmp(fixed_digest, flat_digest, Hash::DIGEST_SIZE) == 0;
+
+    log_file << elap_fixed << '\t' << elap_flat << '\t' << elap_fixed / elap_flat << '\t'
+             << elap_serial << '\t' << check << '\n';
+    log_file.flush();
+
+    return check;
+}
+
+template<size_t first, size_t last, typename Hash>
+void test_build_from(const char *name)
+{
+    if constexpr (first < last)
+    {
+        log_file << first << '\t';
+        log_file.flush();
+
+        test_build<first, Hash>();
+
+        test_build_from<first + 1, last, Hash>(name);
+    }
+}
+
+int main()
+{
+    log_file << std::boolalpha;
+
+    log_file << "SHA256\n";
+    log_file << "Height\tFixedAbr\tFlatAbr\tSpeedup\tFixedAbr (1 thread)\tSame root\n";
+    test_build_from<MIN_TREE_HEIGHT, MAX_TREE_HEIGHT, Sha256>("SHA256");
+
+    log_file << "SHA512\n";
+    log_file << "Height\tFixedAbr\tFlatAbr\tSpeedup\tFixedAbr (1 thread)\tSame root\n";
+    test_build_from<MIN_TREE_HEIGHT, MAX_TREE_HEIGHT, Sha512>("SHA512");
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+#define CURVE_ALT_BN128
+
+#include "gadget/hybrid_mtree_gadget.hpp"
+#include "gadget/mimc256/mimc256_gadget.hpp"
+#include "gadget/poseidon256/poseidon256_gadget.hpp"
+#include "utils/hybrid_mtree.hpp"
+#include "utils/measure.hpp"
+#include "utils/mimc256.hpp"
+#include "utils/poseidon256.hpp"
+#include "utils/sha256.hpp"
+
+#include <libsnark/common/default_types/r1cs_ppzksnark_pp.hpp>
+#include <libsnark/zk_proof_systems/ppzksnark/r1cs_ppzksnark/r1cs_ppzksnark.hpp>
+#include <libsnark/zk_proof_systems/ppzksnark/r1cs_ppzksnark/r1cs_ppzksnark.tcc>
+
+#include <libff/common/default_types/ec_pp.hpp>
+
+#include <fstream>
+#include <omp.h>
+#include <random>
+
+static constexpr size_t TRANS_IDX = 0;
+static constexpr size_t TREE_HEIGHT = 17;
+static constexpr size_t REPEAT = 5;
+
+using ppT = libsnark::default_r1cs_ppzksnark_pp;
+using FieldT = libff::Fr<ppT>;
+
+using GadMimc256 = mimc256_two_to_one_hash_gadget<FieldT>;
+using GadPoseidon256 = poseidon256_two_to_one_hash_gadget<FieldT>;
+
+std::ofstream log_file{"log.txt"};
+
+/*
+Crossover of a tree with Lower below split and Upper above: native build time of the whole tree
+(falls with split when Lower is the faster hash) against the cost of proving a path, which only
+covers the levels above split
+*/
+template<size_t split, typename Lower, typename Upper, typename GadHash>
+bool test_hybrid()
+{
+    using Tree = HybridMTree<TREE_HEIGHT, SplitLevels<split, Lower, Upper>>;
+    using GadTree = HybridMTree_Gadget<FieldT, GadHash, Tree>;
+    using DigVar = typename GadTree::DigVar;
+
+    static constexpr size_t DIGEST_VARS = GadTree::DIGEST_VARS;
+
+    static std::mt19937 rng{std::random_device{}()};
+
+    double elap = 0;
+
+    // Build tree
+    std::vector<uint8_t> data(Tree::INPUT_SIZE);
+    std::generate(data.begin(), data.end(), std::ref(rng));
+    Tree tree;
+
+    elap = measure([&]() { tree = Tree{data.data(), data.size()}; }, REPEAT, 1, nullptr, false);
+    log_file << elap / REPEAT << '\t';
+    log_file.flush();
+
+    // Build gadget and constraints
+    libsnark::protoboard<FieldT> pb;
+    DigVar out{pb, DIGEST_VARS, FMT("out")};
+    DigVar trans{pb, DIGEST_VARS, FMT("trans")};
+    std::vector<DigVar> other;
+
+    for (size_t i = 0; i < GadTree::PATH_N; ++i)
+        other.emplace_back(pb, DIGEST_VARS, FMT("other_%llu", i));
+
+    pb.set_input_sizes(DIGEST_VARS);
+    GadTree gadget{pb, out, trans, other, TRANS_IDX, FMT("hybrid_tree")};
+
+    gadget.generate_r1cs_constraints();
+    log_file << pb.num_constraints() << '\t';
+
+    // Generate witnesses
+    elap = measure([&]() { gadget.generate_r1cs_witness(tree); }, 1, 1, nullptr, false);
+    log_file << elap << '\t';
+    log_file.flush();
+
+    // Generate key
+    bool result;
+    std::vector<libsnark::r1cs_ppzksnark_keypair<ppT>> keypair;
+    elap = measure(
+        [&]() {
+            keypair.emplace_back(
+                libsnark::r1cs_ppzksnark_generator<ppT>(pb.get_constraint_system()));
+        },
+        1, 1, nullptr, false);
+    log_file << elap << '\t';
+    log_file.flush();
+
+    // Generate proof
+    libsnark::r1cs_ppzksnark_proof<ppT> proof;
+    elap = measure(
+        [&]()
+        {
+            proof = libsnark::r1cs_ppzksnark_prover<ppT>(keypair[0].pk, pb.primary_input(),
+                                                         pb.auxiliary_input());
+        },
+        1, 1, nullptr, false);
+    log_file << elap << '\t';
+    log_file.flush();
+
+    // Verify proof
+    elap = measure(
+        [&]()
+        {
+            result = libsnark::r1cs_ppzksnark_verifier_strong_IC<ppT>(keypair[0].vk,
+                                                                      pb.primary_input(), proof);
+        },
+        1, 1, nullptr, false);
+    log_file << elap << '\t' << result << '\n';
+    log_file.flush();
+
+    return result;
+}
+
+// Splits [first, last): the whole tree in the circuit-friendly hash for first = 1
+template<size_t first, size_t last, typename Lower, typename Upper, typename GadHash>
+void test_hybrid_from(const char *name)
+{
+    if constexpr (first < last)
+    {
+        log_file << first << '\t';
+        log_file.flush();
+
+        test_hybrid<first, Lower, Upper, GadHash>();
+
+        test_hybrid_from<first + 1, last, Lower, Upper, GadHash>(name);
+    }
+}
+
+int main()
+{
+    log_file << std::boolalpha;
+    libff::inhibit_profiling_info = true;
+    libff::inhibit_profiling_counters = true;
+
+    ppT::init_public_params();
+    log_file << "SHA256 / MiMC256, height " << TREE_HEIGHT << '\n';
+    log_file << "Split\tTree\tConstraints\tWitness\tKey\tProof\tVerify\tResult\n";
+    test_hybrid_from<1, TREE_HEIGHT - 1, Sha256, Mimc256, GadMimc256>("SHA256 / MiMC256");
+
+    log_file << "SHA256 / Poseidon256, height " << TREE_HEIGHT << '\n';
+    log_file << "Split\tTree\tConstraints\tWitness\tKey\tProof\tVerify\tResult\n";
+    test_hybrid_from<1, TREE_HEIGHT - 1, Sha256, Poseidon256, GadPoseidon256>(
+        "SHA256 / Poseidon256");
+
+    return 0;
+}
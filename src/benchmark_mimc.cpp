@@ -0,0 +1,185 @@
+#include "utils/mimc256.hpp"
+#include "utils/mimc512f.hpp"
+#include "utils/mimc512f2k.hpp"
+#include "utils/poseidon256.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <gmpxx.h>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <x86intrin.h>
+
+static constexpr size_t OPS_N = 1ULL << 14;
+static constexpr size_t HASHES_N = 1ULL << 8;
+static constexpr size_t REPEAT = 8;
+
+using FieldT = Mimc256::FieldT;
+using Bigint = Mimc256::Bigint;
+
+// Former conversions through GMP integers, as a baseline
+struct GmpBytes
+{
+    static FieldT to_field(const void *bytes)
+    {
+        mpz_class tmp;
+
+        mpz_import(tmp.get_mpz_t(), 32, 1, 1, 0, 0, bytes);
+
+        return FieldT{Bigint{tmp.get_mpz_t()}};
+    }
+
+    static void from_field(void *bytes, const FieldT &x)
+    {
+        mpz_class tmp;
+
+        x.as_bigint().to_mpz(tmp.get_mpz_t());
+        memset(bytes, 0, 32);
+        mpz_export(bytes, NULL, 1, 1, 0, 0, tmp.get_mpz_t());
+    }
+
+    static void add(void *x, const void *y)
+    {
+        FieldT t = to_field(x);
+
+        t += to_field(y);
+        from_field(x, t);
+    }
+};
+
+// Best of REPEAT runs of fn, in rdtsc cycles per operation (n operations per run)
+template<typename Fn>
+double run(Fn fn, size_t n)
+{
+    uint64_t best = UINT64_MAX;
+
+    for (size_t r = 0; r < REPEAT; ++r)
+    {
+        uint64_t start = __rdtsc();
+
+        fn();
+
+        best = std::min<uint64_t>(best, __rdtsc() - start);
+    }
+
+    return (double)best / n;
+}
+
+int main()
+{
+    std::mt19937 rng{std::random_device{}()};
+    std::vector<uint8_t> a(OPS_N * Mimc512F::BLOCK_SIZE);
+    std::vector<uint8_t> b(OPS_N * Mimc512F::BLOCK_SIZE);
+    std::vector<FieldT> fields(OPS_N);
+
+    // encodings of field elements, like the digests in a tree
+    auto fill = [&](std::vector<uint8_t> &v)
+    {
+        std::generate(v.begin(), v.end(), std::ref(rng));
+        for (size_t i = 0; i < v.size(); i += 32)
+            FieldBytes<FieldT>::from_field(&v[i], FieldBytes<FieldT>::to_field(&v[i]));
+    };
+
+    fill(a);
+    fill(b);
+
+    auto to_field = [&](auto conv)
+    {
+        return [&, conv]()
+        {
+            for (size_t i = 0; i < OPS_N; ++i)
+                fields[i] = conv(&a[i * 32]);
+        };
+    };
+
+    auto from_field = [&](auto conv)
+    {
+        return [&, conv]()
+        {
+            for (size_t i = 0; i < OPS_N; ++i)
+                conv(&b[i * 32], fields[i]);
+        };
+    };
+
+    // add digests of `size` bytes, by calls on `step` bytes
+    auto add = [&](auto conv, size_t size, size_t step)
+    {
+        return [&, conv, size, step]()
+        {
+            for (size_t i = 0; i < OPS_N; ++i)
+                for (size_t j = 0; j < size; j += step)
+                    conv(&a[i * size + j], &b[i * size + j]);
+        };
+    };
+
+    auto hash = [&](auto hash_oneblock, size_t block_size, size_t digest_size)
+    {
+        return [&, hash_oneblock, block_size, digest_size]()
+        {
+            for (size_t i = 0; i < HASHES_N; ++i)
+                hash_oneblock(&b[i * digest_size], &a[i * block_size]);
+        };
+    };
+
+    auto hash_many = [&](auto hash_many)
+    {
+        return [&, hash_many]() { hash_many(&b[0], &a[0], HASHES_N); };
+    };
+
+    auto report = [](const char *name, double gmp, double direct)
+    {
+        std::cout << name << '\t' << gmp << '\t' << direct << '\t' << gmp / direct << '\n';
+    };
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Operation\tGMP cycles\tDirect cycles\tSpeedup\n";
+
+    report("bytes -> field", run(to_field(GmpBytes::to_field), OPS_N),
+           run(to_field(FieldBytes<FieldT>::to_field), OPS_N));
+
+    report("field -> bytes", run(from_field(GmpBytes::from_field), OPS_N),
+           run(from_field(FieldBytes<FieldT>::from_field), OPS_N));
+
+    report("Mimc256::hash_add", run(add(GmpBytes::add, Mimc256::DIGEST_SIZE, 32), OPS_N),
+           run(add(Mimc256::hash_add, Mimc256::DIGEST_SIZE, 32), OPS_N));
+
+    report("Mimc512F::hash_add", run(add(GmpBytes::add, Mimc512F::DIGEST_SIZE, 32), OPS_N),
+           run(add(Mimc512F::hash_add, Mimc512F::DIGEST_SIZE, 64), OPS_N));
+
+    // the conversions are a small part of a whole hash, reported for scale
+    std::cout << "Mimc256::hash_oneblock\t-\t"
+              << run(hash(Mimc256::hash_oneblock, Mimc256::BLOCK_SIZE, Mimc256::DIGEST_SIZE),
+                     HASHES_N)
+              << "\t-\n";
+    std::cout << "Mimc512F::hash_oneblock\t-\t"
+              << run(hash(Mimc512F::hash_oneblock, Mimc512F::BLOCK_SIZE, Mimc512F::DIGEST_SIZE),
+                     HASHES_N)
+              << "\t-\n";
+
+    // scalar hashes one after the other against the interleaved kernel (LANES at once)
+    std::cout << "\nHash\tScalar cycles\tInterleaved cycles\tSpeedup\n";
+
+    report("Mimc256", run(hash(Mimc256::hash_oneblock, Mimc256::BLOCK_SIZE, Mimc256::DIGEST_SIZE),
+                          HASHES_N),
+           run(hash_many(Mimc256::hash_many), HASHES_N));
+
+    report("Mimc512F",
+           run(hash(Mimc512F::hash_oneblock, Mimc512F::BLOCK_SIZE, Mimc512F::DIGEST_SIZE),
+               HASHES_N),
+           run(hash_many(Mimc512F::hash_many), HASHES_N));
+
+    report("Mimc512F2K",
+           run(hash(Mimc512F2K::hash_oneblock, Mimc512F2K::BLOCK_SIZE, Mimc512F2K::DIGEST_SIZE),
+               HASHES_N),
+           run(hash_many(Mimc512F2K::hash_many), HASHES_N));
+
+    report("Poseidon256",
+           run(hash(Poseidon256::hash_oneblock, Poseidon256::BLOCK_SIZE, Poseidon256::DIGEST_SIZE),
+               HASHES_N),
+           run(hash_many(Poseidon256::hash_many), HASHES_N));
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "utils/cpu_features.hpp"
+#include "utils/sha256.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+static constexpr size_t BLOCKS_N = 1ULL << 16;
+static constexpr size_t REPEAT = 16;
+
+struct Result
+{
+    double cycles = 0; // rdtsc cycles per block
+    double mhps = 0;   // millions of hashes per second
+};
+
+// Best of REPEAT runs of hash_all, which hashes the BLOCKS_N blocks on one core
+template<typename Fn>
+Result run(Fn hash_all)
+{
+    using clk = std::chrono::high_resolution_clock;
+
+    uint64_t best_clocks = UINT64_MAX;
+    double best_sec = 1e30;
+
+    for (size_t r = 0; r < REPEAT; ++r)
+    {
+        uint64_t c_start = __rdtsc();
+        auto start = clk::now();
+
+        hash_all();
+
+        best_clocks = std::min<uint64_t>(best_clocks, __rdtsc() - c_start);
+        best_sec = std::min(best_sec, std::chrono::duration<double>(clk::now() - start).count());
+    }
+
+    return {(double)best_clocks / BLOCKS_N, BLOCKS_N / best_sec / 1e6};
+}
+
+int main()
+{
+    const CpuFeatures &cpu = CpuFeatures::get();
+
+    std::mt19937 rng{std::random_device{}()};
+    std::vector<uint8_t> blocks(BLOCKS_N * Sha256::BLOCK_SIZE);
+    std::vector<uint8_t> ref(BLOCKS_N * Sha256::DIGEST_SIZE);
+    std::vector<uint8_t> out(BLOCKS_N * Sha256::DIGEST_SIZE);
+    std::vector<uint8_t *> digest_ptrs(BLOCKS_N);
+    std::vector<const void *> block_ptrs(BLOCKS_N);
+
+    std::generate(blocks.begin(), blocks.end(), std::ref(rng));
+    for (size_t i = 0; i < BLOCKS_N; ++i)
+    {
+        digest_ptrs[i] = &out[i * Sha256::DIGEST_SIZE];
+        block_ptrs[i] = &blocks[i * Sha256::BLOCK_SIZE];
+    }
+
+    auto one_by_one = [&](void (*hash)(uint8_t *, const void *), std::vector<uint8_t> &dst)
+    {
+        return [&, hash]()
+        {
+            for (size_t i = 0; i < BLOCKS_N; ++i)
+                hash(&dst[i * Sha256::DIGEST_SIZE], &blocks[i * Sha256::BLOCK_SIZE]);
+        };
+    };
+
+    auto by_lanes = [&](auto kernel, size_t lanes)
+    {
+        return [&, kernel, lanes]()
+        {
+            for (size_t i = 0; i < BLOCKS_N; i += lanes)
+                kernel(&digest_ptrs[i], &block_ptrs[i]);
+        };
+    };
+
+    auto report = [&](const char *name, Result res)
+    {
+        std::cout << name << '\t' << res.cycles << '\t' << res.mhps << '\t' << (out == ref)
+                  << '\n';
+        std::fill(out.begin(), out.end(), 0);
+    };
+
+    std::cout << std::fixed << std::setprecision(1) << std::boolalpha;
+    std::cout << "SHA-NI: " << cpu.sha << ", AVX2: " << cpu.avx2 << ", AVX-512: " << cpu.avx512bw
+              << '\n';
+    std::cout << "Kernel\tCycles/block\tMhash/s/core\tSame digests\n";
+
+    run(one_by_one(Sha256::hash_oneblock_scalar, ref));
+    report("scalar", run(one_by_one(Sha256::hash_oneblock_scalar, out)));
+
+    if (cpu.sha && cpu.sse41)
+        report("sha-ni", run(one_by_one(Sha256::hash_oneblock_shani, out)));
+
+    if (cpu.avx2)
+        report("avx2 x8", run(by_lanes(Sha256::hash_oneblock_x8, Sha256::LANES_AVX2)));
+
+    if (cpu.avx512bw)
+        report("avx512 x16", run(by_lanes(Sha256::hash_oneblock_x16, Sha256::LANES_AVX512)));
+
+    report("hash_oneblock", run(one_by_one(Sha256::hash_oneblock, out)));
+
+    report("hash_oneblock_xN",
+           run(by_lanes([](uint8_t *const *digests, const void *const *blocks)
+                        { Sha256::hash_oneblock_xN(digests, blocks); },
+                        Sha256::LANES)));
+
+    return 0;
+}
@@ -1,11 +1,14 @@
 #define CURVE_ALT_BN128
 
 #include "gadget/abr_gadget.hpp"
+#include "gadget/blake2s/blake2s_gadget.hpp"
 #include "gadget/mimc256/mimc256_gadget.hpp"
 #include "gadget/mimc512f/mimc512f_gadget.hpp"
 #include "gadget/mimc512f2k/mimc512f2k_gadget.hpp"
+#include "gadget/poseidon256/poseidon256_gadget.hpp"
 #include "gadget/sha256/sha256_gadget.hpp"
 #include "gadget/sha512/sha512_gadget.hpp"
+#include "utils/abr_verifier.hpp"
 #include "utils/fixed_abr.hpp"
 #include "utils/measure.hpp"
 #include "utils/sha256.hpp"
@@ -29,9 +32,11 @@ using FieldT = libff::Fr<ppT>;
 
 using GadSha256 = libsnark::sha256_two_to_one_hash_gadget<FieldT>;
 using GadSha512 = libsnark::sha512::sha512_two_to_one_hash_gadget<FieldT>;
+using GadBlake2s = blake2s_two_to_one_hash_gadget<FieldT>;
 using GadMimc256 = mimc256_two_to_one_hash_gadget<FieldT>;
 using GadMimc512F = mimc512f_two_to_one_hash_gadget<FieldT>;
 using GadMimc512F2K = mimc512f2k_two_to_one_hash_gadget<FieldT>;
+using GadPoseidon256 = poseidon256_two_to_one_hash_gadget<FieldT>;
 
 template<size_t tree_height, typename Hash, typename GadHash>
 bool test_tRee()
@@ -233,6 +238,104 @@ bool test_ptRee()
     return result;
 }
 
+// Every leaf and middle node: the gadget on the path of FixedAbr::get_path gives the root, as does
+// FixedAbrPath, and AbrVerifier accepts the witnesses of the gadget against its output
+template<size_t tree_height, typename Hash, typename GadHash>
+bool test_ptRee_paths()
+{
+    using Abr = FixedAbr<tree_height, Hash>;
+    using AbrPath = FixedAbrPath<tree_height, Hash>;
+    using Verifier = AbrVerifier<tree_height, Hash>;
+    using DigVar = field_variable<FieldT>;
+
+    static constexpr size_t DIGEST_VARS = GadHash::DIGEST_VARS;
+    static constexpr size_t D = Hash::DIGEST_SIZE;
+
+    std::mt19937 rng{tree_height};
+    std::vector<uint8_t> data(Abr::INPUT_SIZE);
+    std::generate(data.begin(), data.end(), std::ref(rng));
+    Abr tree{data.begin(), data.end()};
+
+    // witnesses read back from the protoboards: trans, other, middle, otherx and out per proof
+    static constexpr size_t PROOF_SIZE = 3 * D + 2 * Abr::PATH_SIZE;
+    std::vector<uint8_t> wit(Abr::INPUT_N * PROOF_SIZE);
+    std::vector<typename Verifier::Proof> proofs(Abr::INPUT_N);
+    bool check = true;
+
+    auto read = [](libsnark::protoboard<FieldT> &pb, const DigVar &var, uint8_t *bytes)
+    {
+        for (size_t i = 0; i < var.size(); ++i)
+            FieldBytes<FieldT>::from_field(bytes + i * FieldBytes<FieldT>::SIZE, pb.val(var[i]));
+    };
+
+    for (size_t idx = 0; idx < Abr::INPUT_N; ++idx)
+    {
+        const uint8_t *trans_d = tree.get_node(idx)->get_digest();
+        uint8_t other_d[D], middle_d[Abr::PATH_SIZE], otherx_d[Abr::PATH_SIZE];
+
+        tree.get_path(idx, other_d, middle_d, otherx_d);
+        AbrPath path{trans_d, other_d, middle_d, otherx_d, idx};
+
+        libsnark::protoboard<FieldT> pb;
+        DigVar out{pb, DIGEST_VARS, FMT("out")};
+        DigVar trans{pb, DIGEST_VARS, FMT("trans")};
+        DigVar other{pb, DIGEST_VARS, FMT("other")};
+        DigVar root{pb, DIGEST_VARS, FMT("root")};
+
+        std::vector<DigVar> middle;
+        std::vector<DigVar> otherx;
+        for (size_t i = 0; i < tree_height - 2; ++i)
+        {
+            middle.emplace_back(pb, DIGEST_VARS, FMT("middle_%llu", i));
+            otherx.emplace_back(pb, DIGEST_VARS, FMT("otherx_%llu", i));
+        }
+
+        pb.set_input_sizes(DIGEST_VARS);
+        ABR_Gadget<FieldT, GadHash> gadget{
+            pb, out, trans, other, middle, otherx, idx, tree_height, FMT("merkle_tree")};
+
+        gadget.generate_r1cs_constraints();
+
+        trans.generate_r1cs_witness(trans_d);
+        other.generate_r1cs_witness(other_d);
+        for (size_t i = 0; i < tree_height - 2; ++i)
+        {
+            middle[i].generate_r1cs_witness(middle_d + i * D);
+            otherx[i].generate_r1cs_witness(otherx_d + i * D);
+        }
+
+        gadget.generate_r1cs_witness();
+        root.generate_r1cs_witness(tree.digest());
+
+        check &= pb.is_satisfied() && memcmp(path.digest(), tree.digest(), D) == 0;
+        for (size_t i = 0; i < DIGEST_VARS; ++i)
+            check &= pb.val(out[i]) == pb.val(root[i]);
+
+        uint8_t *w = &wit[idx * PROOF_SIZE];
+        typename Verifier::Proof &p = proofs[idx];
+
+        p = {w, w + D, w + 2 * D, w + 2 * D + Abr::PATH_SIZE, idx, w + 2 * D + 2 * Abr::PATH_SIZE};
+        read(pb, trans, w);
+        read(pb, other, w + D);
+        for (size_t i = 0; i < tree_height - 2; ++i)
+        {
+            read(pb, middle[i], w + 2 * D + i * D);
+            read(pb, otherx[i], w + 2 * D + Abr::PATH_SIZE + i * D);
+        }
+        read(pb, out, w + 2 * D + 2 * Abr::PATH_SIZE);
+        check &= Verifier::verify(p);
+    }
+
+    // the batch verifier on all the proofs, then with one bad root
+    check &= Verifier::verify_many(proofs) == std::vector<bool>(Abr::INPUT_N, true);
+
+    uint8_t *bad = &wit[Abr::LEAVES_N * PROOF_SIZE + 2 * D + 2 * Abr::PATH_SIZE];
+    bad[D - 1] ^= 1;
+    check &= Verifier::verify_many(proofs)[Abr::LEAVES_N] == false;
+
+    return check;
+}
+
 static bool run_tests()
 {
     bool check = true;
@@ -259,6 +362,14 @@ static bool run_tests()
     std::cout << check << '\n';
     all_check &= check;
 
+    std::cout << "BLAKE2s... ";
+    std::cout.flush();
+    {
+        check = test_tRee<TREE_HEIGHT, Blake2s, GadBlake2s>();
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
     std::cout << "MiMC256... ";
     std::cout.flush();
     {
@@ -283,6 +394,23 @@ static bool run_tests()
     std::cout << check << '\n';
     all_check &= check;
 
+    std::cout << "Poseidon256... ";
+    std::cout.flush();
+    {
+        check = test_ptRee<TREE_HEIGHT, Poseidon256, GadPoseidon256>();
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Paths of every node... ";
+    std::cout.flush();
+    {
+        check = test_ptRee_paths<5, Mimc256, GadMimc256>() &&
+                test_ptRee_paths<6, Poseidon256, GadPoseidon256>();
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
     return all_check;
 }
 
@@ -0,0 +1,94 @@
+#include "utils/abr_verifier.hpp"
+#include "utils/fixed_abr.hpp"
+#include "utils/sha256.hpp"
+#include "utils/sha512.hpp"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+
+// Verify the proofs of all the transactions of a tree, with some of them tampered with
+template<size_t height, typename Hash>
+static bool check_batch()
+{
+    using Abr = FixedAbr<height, Hash>;
+    using Verifier = AbrVerifier<height, Hash>;
+
+    static constexpr size_t DS = Hash::DIGEST_SIZE;
+
+    std::mt19937 rng{height};
+    std::vector<uint8_t> data(Abr::INPUT_SIZE);
+
+    std::generate(data.begin(), data.end(), std::ref(rng));
+
+    Abr tree{data.data(), data.size()};
+    size_t n = Abr::INPUT_N;
+    std::vector<uint8_t> trans(n * DS), other(n * DS);
+    std::vector<uint8_t> middle(n * Abr::PATH_SIZE), otherx(n * Abr::PATH_SIZE);
+    std::vector<typename Verifier::Proof> proofs(n + 1);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        memcpy(&trans[i * DS], tree.get_node(i)->get_digest(), DS);
+        tree.get_path(i, &other[i * DS], &middle[i * Abr::PATH_SIZE],
+                      &otherx[i * Abr::PATH_SIZE]);
+        proofs[i] = {&trans[i * DS], &other[i * DS], &middle[i * Abr::PATH_SIZE],
+                     &otherx[i * Abr::PATH_SIZE], i, tree.digest()};
+    }
+
+    // out of range index
+    proofs[n] = proofs[0];
+    proofs[n].idx = n;
+
+    // bad transaction, bad middle node, wrong index
+    trans[1 * DS] ^= 1;
+    middle[3 * Abr::PATH_SIZE + (height - 3) * DS] ^= 1;
+    proofs[4].idx = 6;
+
+    std::vector<bool> results = Verifier::verify_many(proofs);
+    size_t valid = 0;
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        bool expected = i != 1 && i != 3 && i != 4 && i != n;
+
+        if (results[i] != expected)
+            return false;
+        valid += results[i];
+    }
+
+    return valid == n - 3;
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Batch verification SHA256... ";
+    check = check_batch<4, Sha256>() && check_batch<9, Sha256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Batch verification SHA512... ";
+    check = check_batch<6, Sha512>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing ABR verifier ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+    return 0;
+}
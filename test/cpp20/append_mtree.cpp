@@ -0,0 +1,126 @@
+#include "utils/append_mtree.hpp"
+#include "utils/sha256.hpp"
+#include "utils/sha512.hpp"
+#include "utils/string_utils.hpp"
+#include <cstring>
+#include <iostream>
+
+template<typename Hash>
+static bool check_consistency(size_t max_n)
+{
+    std::vector<uint8_t> data(max_n * Hash::BLOCK_SIZE);
+    std::vector<std::vector<uint8_t>> roots(max_n + 1, std::vector<uint8_t>(Hash::DIGEST_SIZE));
+    AppendMTree<Hash> tree;
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = i * 7 + 3;
+
+    // grow the tree one leaf at a time, remembering every root
+    for (size_t n = 1; n <= max_n; ++n)
+    {
+        tree.append(data.data() + (n - 1) * Hash::BLOCK_SIZE, Hash::BLOCK_SIZE);
+        memcpy(roots[n].data(), tree.digest(), Hash::DIGEST_SIZE);
+    }
+
+    for (size_t m = 1; m <= max_n; ++m)
+    {
+        uint8_t digest[Hash::DIGEST_SIZE];
+
+        tree.digest_at(digest, m);
+        if (memcmp(digest, roots[m].data(), Hash::DIGEST_SIZE) != 0)
+            return false;
+
+        auto proof = tree.consistency_proof(m);
+        if (!AppendMTree<Hash>::verify_consistency(m, max_n, roots[m].data(), tree.digest(),
+                                                   proof.data(), proof.size()))
+            return false;
+
+        // a tampered proof or a wrong old root must be rejected
+        if (!proof.empty())
+        {
+            proof[proof.size() / 2] ^= 1;
+            if (AppendMTree<Hash>::verify_consistency(m, max_n, roots[m].data(), tree.digest(),
+                                                      proof.data(), proof.size()))
+                return false;
+            proof[proof.size() / 2] ^= 1;
+        }
+
+        roots[m][0] ^= 1;
+        if (AppendMTree<Hash>::verify_consistency(m, max_n, roots[m].data(), tree.digest(),
+                                                  proof.data(), proof.size()))
+            return false;
+        roots[m][0] ^= 1;
+    }
+
+    return true;
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    static constexpr size_t LEAVES_N = 8;
+    static constexpr size_t MAX_N = 37;
+
+    // same vectors as the FixedMTree of height 4
+    auto digest256 = "26b0052694fc42fdff93e6fb5a71d38c3dd7dc5b6ad710eb048c660233137fab"_x;
+    auto digest512 =
+        "6e3d539e81fcba88a5a6875590df1f6ec06e67b1656504bd60f33953b81b080637d790e65789a4e03bfa4d457cb820f5153a0299c74798775d4295e9b0955517"_x;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Full Tree SHA256... ";
+    check = true;
+    {
+        std::vector<uint8_t> data(LEAVES_N * Sha256::BLOCK_SIZE);
+        AppendMTree<Sha256> tree(data);
+
+        check = memcmp(tree.digest(), digest256.data(), digest256.size()) == 0;
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Full Tree SHA512... ";
+    check = true;
+    {
+        std::vector<uint8_t> data(LEAVES_N * Sha512::BLOCK_SIZE);
+        AppendMTree<Sha512> tree;
+
+        // appending in uneven batches must give the same tree
+        tree.append(data.data(), 3 * Sha512::BLOCK_SIZE);
+        tree.append(data.data(), 4 * Sha512::BLOCK_SIZE);
+        tree.append(data.data(), 1 * Sha512::BLOCK_SIZE);
+
+        check = memcmp(tree.digest(), digest512.data(), digest512.size()) == 0;
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Consistency SHA256... ";
+    check = check_consistency<Sha256>(MAX_N);
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Consistency SHA512... ";
+    check = check_consistency<Sha512>(MAX_N);
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing Append-only Merkle Tree ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+#ifdef MEASURE_PERFORMANCE
+#endif
+
+    return 0;
+}
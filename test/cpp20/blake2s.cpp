@@ -0,0 +1,78 @@
+#include "utils/blake2s.hpp"
+#include "multi_buffer.hpp"
+#include "utils/cpu_features.hpp"
+#include "utils/string_utils.hpp"
+#include <cstring>
+#include <iostream>
+
+static bool run_tests()
+{
+    uint8_t msg[Blake2s::BLOCK_SIZE]{};
+    uint8_t dig[Blake2s::DIGEST_SIZE]{};
+    auto zero_dig = "ae09db7cd54f42b490ef09b6bc541af688e4959bb8c53f359a6f56e38ab454a3"_x;
+    auto kat_dig = "56f34e8b96557e90c1f24b52d0c89d51086acf1b00f634cf1dde9233b8eaaa3e"_x;
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    // 64 zero bytes, and the 64-byte message 00 01 .. 3f of the reference test vectors
+    std::cout << "Hashing... ";
+    check = true;
+
+    Blake2s::hash_oneblock(dig, msg);
+    check = memcmp(dig, zero_dig.data(), sizeof(dig)) == 0;
+
+    for (size_t i = 0; i < sizeof(msg); ++i)
+        msg[i] = i;
+    Blake2s::hash_oneblock_scalar(dig, msg);
+    check &= memcmp(dig, kat_dig.data(), sizeof(dig)) == 0;
+
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "SSE4.1 against scalar... ";
+    check = true;
+    if (CpuFeatures::get().sse41)
+    {
+        uint8_t dig_sse[Blake2s::DIGEST_SIZE]{};
+
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            for (size_t j = 0; j < sizeof(msg); ++j)
+                msg[j] = i * 31 + j * 7 + (i >> 3);
+
+            Blake2s::hash_oneblock_scalar(dig, msg);
+            Blake2s::hash_oneblock_sse41(dig_sse, msg);
+            check &= memcmp(dig, dig_sse, sizeof(dig)) == 0;
+        }
+    }
+    else
+        std::cout << "(not supported) ";
+
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Multi-buffer against scalar... ";
+    check = check_multi_buffer<Blake2s>(multi_buffer_blocks<Blake2s>(),
+                                        Blake2s::hash_oneblock_scalar, Blake2s::hash_oneblock_x8);
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing BLAKE2S ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+#ifdef MEASURE_PERFORMANCE
+#endif
+
+    return 0;
+}
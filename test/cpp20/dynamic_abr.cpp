@@ -0,0 +1,126 @@
+#include "utils/dynamic_abr.hpp"
+#include "utils/fixed_abr.hpp"
+#include "utils/sha256.hpp"
+#include "utils/sha512.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+// A full DynamicAbr must match FixedAbr on every node
+template<size_t height, typename Hash>
+static bool same_full_tree()
+{
+    using Fixed = FixedAbr<height, Hash>;
+
+    std::vector<uint8_t> data(Fixed::INPUT_SIZE);
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = i * 9 + 4;
+
+    Fixed fixed{data.data(), data.size()};
+    DynamicAbr<Hash> tree{data.data(), data.size()};
+
+    if (tree.height() != height || tree.size() != Fixed::INPUT_N)
+        return false;
+
+    for (size_t i = 0; i < (1ULL << height) - 1 + Fixed::INTERNAL_N; ++i)
+        if (memcmp(tree.get_digest(i), fixed.get_node(i)->get_digest(), Hash::DIGEST_SIZE) != 0)
+            return false;
+
+    return memcmp(tree.digest(), fixed.digest(), Hash::DIGEST_SIZE) == 0;
+}
+
+// Transactions fill leaves then middles, the rest is zero padding
+template<typename Hash>
+static bool check_padding(size_t n)
+{
+    using Tree = DynamicAbr<Hash>;
+
+    std::vector<uint8_t> data(n * Hash::BLOCK_SIZE);
+    uint8_t zero[Hash::DIGEST_SIZE]{};
+    uint8_t digest[Hash::DIGEST_SIZE];
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = i * 5 + 3;
+
+    Tree tree{data.data(), data.size()};
+    size_t height = tree.height();
+
+    if (height != Tree::height_for(n) || Tree::capacity(height) < n ||
+        (height > Tree::MIN_HEIGHT && Tree::capacity(height - 1) >= n))
+        return false;
+
+    for (size_t i = 0; i < tree.capacity(); ++i)
+    {
+        if (i < n)
+            Hash::hash_oneblock(digest, &data[i * Hash::BLOCK_SIZE]);
+        else
+            memcpy(digest, zero, Hash::DIGEST_SIZE);
+
+        if (memcmp(tree.get_digest(i), digest, Hash::DIGEST_SIZE) != 0)
+            return false;
+    }
+
+    // a bigger explicit height gives another root
+    Tree taller{height + 1, data.data(), data.size()};
+
+    return taller.size() == n && memcmp(taller.digest(), tree.digest(), Hash::DIGEST_SIZE) != 0;
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Full trees SHA256... ";
+    check = same_full_tree<3, Sha256>() && same_full_tree<4, Sha256>() &&
+            same_full_tree<9, Sha256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Full trees SHA512... ";
+    check = same_full_tree<5, Sha512>() && same_full_tree<8, Sha512>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Padding SHA256... ";
+    check = check_padding<Sha256>(1) && check_padding<Sha256>(6) && check_padding<Sha256>(9) &&
+            check_padding<Sha256>(1000);
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Padding SHA512... ";
+    check = check_padding<Sha512>(12) && check_padding<Sha512>(300);
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Empty tree... ";
+    {
+        auto is_zero = [](const uint8_t *d)
+        { return std::all_of(d, d + Sha256::DIGEST_SIZE, [](uint8_t b) { return b == 0; }); };
+
+        // default-constructed, and built from no transaction
+        DynamicAbr<Sha256> tree;
+        DynamicAbr<Sha256> no_trans{nullptr, 0};
+
+        check = is_zero(tree.digest()) && is_zero(no_trans.digest()) && no_trans.size() == 0;
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing dynamic ABR ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+    return 0;
+}
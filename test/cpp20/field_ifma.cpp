@@ -0,0 +1,105 @@
+#include "utils/field_ifma.hpp"
+#include "utils/mimc256.hpp"
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+using FieldT = Mimc256::FieldT;
+using Ifma = FieldIfma<FieldT>;
+
+// Random elements, with the edge cases 0, 1 and p - 1 in the first lanes
+static void random_lanes(FieldT x[Ifma::LANES], std::mt19937 &rng)
+{
+    uint8_t bytes[Ifma::Bytes::SIZE];
+
+    for (size_t k = 0; k < Ifma::LANES; ++k)
+    {
+        std::generate(bytes, bytes + sizeof(bytes), std::ref(rng));
+        x[k] = Ifma::Bytes::to_field(bytes);
+    }
+    x[0] = FieldT::zero();
+    x[1] = FieldT::one();
+    x[2] = FieldT::zero() - FieldT::one();
+}
+
+CPU_TARGET(IFMA_TARGET)
+static bool same_arithmetic()
+{
+    const Ifma::Constants &c = Ifma::constants();
+    std::mt19937 rng{1};
+    bool check = true;
+
+    for (size_t r = 0; r < 1000; ++r)
+    {
+        FieldT x[Ifma::LANES], y[Ifma::LANES], out[Ifma::LANES];
+        Ifma::Vec a, b, t;
+
+        random_lanes(x, rng);
+        random_lanes(y, rng);
+        std::shuffle(y, y + Ifma::LANES, rng);
+        Ifma::load(a, x, c);
+        Ifma::load(b, y, c);
+
+        Ifma::store(out, a, c);
+        check &= std::equal(out, out + Ifma::LANES, x);
+
+        t = a;
+        Ifma::mul(t, b, c);
+        Ifma::store(out, t, c);
+        for (size_t k = 0; k < Ifma::LANES; ++k)
+            check &= out[k] == x[k] * y[k];
+
+        t = a;
+        Ifma::add(t, b, c);
+        Ifma::store(out, t, c);
+        for (size_t k = 0; k < Ifma::LANES; ++k)
+            check &= out[k] == x[k] + y[k];
+
+        t = a;
+        Ifma::cube(t, c);
+        Ifma::store(out, t, c);
+        for (size_t k = 0; k < Ifma::LANES; ++k)
+            check &= out[k] == x[k] * x[k] * x[k];
+
+        t = a;
+        Ifma::add(t, Ifma::to_limbs(y, 1)[0], c);
+        Ifma::store(out, t, c);
+        for (size_t k = 0; k < Ifma::LANES; ++k)
+            check &= out[k] == x[k] + y[0];
+    }
+
+    return check;
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    if (!CpuFeatures::get().avx512ifma)
+    {
+        std::cout << "No AVX-512 IFMA, skipped\n";
+        return true;
+    }
+
+    std::cout << "Field arithmetic... ";
+    check = same_arithmetic();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing IFMA field arithmetic ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+    return 0;
+}
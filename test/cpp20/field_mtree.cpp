@@ -0,0 +1,80 @@
+#include "utils/field_mtree.hpp"
+#include "utils/fixed_mtree.hpp"
+#include "utils/mimc256.hpp"
+#include "utils/mimc512f.hpp"
+#include "utils/mimc512f2k.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+// Compare every node and the paths against the byte-based version
+template<size_t height, typename Hash>
+static bool same_tree()
+{
+    using Fixed = FixedMTree<height, Hash>;
+    using Tree = FieldMTree<height, Hash>;
+
+    std::mt19937 rng{height};
+    std::vector<uint8_t> data(Tree::INPUT_SIZE);
+
+    std::generate(data.begin(), data.end(), std::ref(rng));
+
+    Fixed fixed{data};
+    Tree tree{data};
+    uint8_t bytes[Hash::DIGEST_SIZE];
+
+    for (size_t i = 0; i < Tree::NODES_N; ++i)
+    {
+        Tree::Field::to_bytes(bytes, tree.get_node(i));
+        if (memcmp(bytes, fixed.get_node(i)->get_digest(), Hash::DIGEST_SIZE) != 0)
+            return false;
+    }
+
+    typename Tree::Digest other[height - 1];
+    size_t idx = Tree::LEAVES_N / 3;
+    typename Tree::Digest cur = tree.get_node(idx);
+
+    tree.get_path(idx, other);
+    for (size_t i = 0; i < height - 1; ++i, idx >>= 1)
+        cur = idx & 1 ? Tree::Field::hash(other[i], cur) : Tree::Field::hash(cur, other[i]);
+
+    return cur == tree.root() && memcmp(tree.digest(), fixed.digest(), Hash::DIGEST_SIZE) == 0;
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Field tree MIMC256... ";
+    check = same_tree<2, Mimc256>() && same_tree<5, Mimc256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Field tree MIMC512F... ";
+    check = same_tree<2, Mimc512F>() && same_tree<4, Mimc512F>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Field tree MIMC512F2K... ";
+    check = same_tree<3, Mimc512F2K>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing field-native Merkle tree ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+    return 0;
+}
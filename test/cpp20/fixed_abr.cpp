@@ -1,12 +1,76 @@
 #include "utils/fixed_abr.hpp"
 #include "utils/mimc256.hpp"
 #include "utils/mimc512f.hpp"
+#include "utils/poseidon256.hpp"
 #include "utils/sha256.hpp"
 #include "utils/sha512.hpp"
 #include "utils/string_utils.hpp"
 #include <cstring>
 #include <iostream>
 
+// Rebuild the root from the path of every leaf and middle node
+template<size_t height, typename Hash>
+static bool check_paths()
+{
+    using Abr = FixedAbr<height, Hash>;
+
+    std::vector<uint8_t> data(Abr::INPUT_SIZE);
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = i * 13 + 1;
+
+    Abr tree{data.data(), data.size()};
+    uint8_t other[Hash::DIGEST_SIZE];
+    uint8_t middle[Abr::PATH_SIZE];
+    uint8_t otherx[Abr::PATH_SIZE];
+
+    for (size_t idx = 0; idx < Abr::INPUT_N; ++idx)
+    {
+        tree.get_path(idx, other, middle, otherx);
+
+        FixedAbrPath<height, Hash> path{tree.get_node(idx)->get_digest(), other, middle, otherx,
+                                        idx};
+
+        if (memcmp(path.digest(), tree.digest(), Hash::DIGEST_SIZE) != 0)
+            return false;
+    }
+
+    return true;
+}
+
+// Update some leaves and middle nodes, then compare against a tree rebuilt from scratch
+template<size_t height, typename Hash>
+static bool check_updates()
+{
+    using Abr = FixedAbr<height, Hash>;
+
+    std::vector<uint8_t> data(Abr::INPUT_SIZE);
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = i * 3 + 7;
+
+    Abr tree{data.data(), data.size()};
+    std::vector<size_t> indices{0, Abr::LEAVES_N - 1, Abr::LEAVES_N, Abr::INPUT_N - 1, 5, 5};
+    std::vector<uint8_t> blocks(indices.size() * Hash::BLOCK_SIZE);
+
+    for (size_t i = 0; i < blocks.size(); ++i)
+        blocks[i] = i * 5 + 11;
+
+    tree.update_many(indices.data(), indices.size(), blocks.data(), blocks.size());
+    for (size_t i = 0; i < indices.size(); ++i)
+        memcpy(&data[indices[i] * Hash::BLOCK_SIZE], &blocks[i * Hash::BLOCK_SIZE],
+               Hash::BLOCK_SIZE);
+
+    std::vector<uint8_t> block(Hash::BLOCK_SIZE, 0x42);
+
+    tree.update(Abr::LEAVES_N + 1, block.data());
+    memcpy(&data[(Abr::LEAVES_N + 1) * Hash::BLOCK_SIZE], block.data(), Hash::BLOCK_SIZE);
+
+    Abr rebuilt{data.data(), data.size()};
+
+    return memcmp(tree.digest(), rebuilt.digest(), Hash::DIGEST_SIZE) == 0;
+}
+
 static bool run_tests()
 {
     bool check = true;
@@ -44,6 +108,31 @@ static bool run_tests()
     std::cout << check << '\n';
     all_check &= check;
 
+    std::cout << "Paths SHA256... ";
+    check = check_paths<3, Sha256>() && check_paths<4, Sha256>() && check_paths<7, Sha256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Paths SHA512... ";
+    check = check_paths<5, Sha512>() && check_paths<6, Sha512>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Paths POSEIDON256... ";
+    check = check_paths<4, Poseidon256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Updates SHA256... ";
+    check = check_updates<4, Sha256>() && check_updates<8, Sha256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Updates SHA512... ";
+    check = check_updates<6, Sha512>();
+    std::cout << check << '\n';
+    all_check &= check;
+
 /* There are no test vectors for MiMC, so we assume our implementation to be correct
     std::cout << "Hashing MiMC256... ";
     check = true;
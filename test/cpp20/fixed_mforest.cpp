@@ -0,0 +1,88 @@
+#include "utils/fixed_mforest.hpp"
+#include "utils/fixed_mtree.hpp"
+#include "utils/sha256.hpp"
+#include "utils/sha512.hpp"
+#include "utils/string_utils.hpp"
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+
+template<size_t height, typename Hash>
+static bool check_forest(size_t trees_n)
+{
+    using Forest = FixedMForest<height, Hash>;
+    using Tree = FixedMTree<height, Hash>;
+
+    std::vector<uint8_t> data(trees_n * Forest::INPUT_SIZE);
+    Forest forest;
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = i * 17 + 5;
+
+    // build twice, the second time with fewer trees in the same arena
+    for (size_t n : {trees_n, trees_n / 2})
+    {
+        forest.build(data.data(), n * Forest::INPUT_SIZE);
+
+        if (forest.size() != n)
+            return false;
+
+        for (size_t t = 0; t < n; ++t)
+        {
+            Tree tree(data.data() + t * Forest::INPUT_SIZE, Forest::INPUT_SIZE);
+            auto view = forest[t];
+
+            if (memcmp(view.digest(), tree.digest(), Hash::DIGEST_SIZE) != 0 ||
+                memcmp(forest.digest(t), tree.digest(), Hash::DIGEST_SIZE) != 0)
+                return false;
+
+            for (size_t i = 0; i < Forest::NODES_N; ++i)
+                if (memcmp(view.get_node(i)->get_digest(), tree.get_node(i)->get_digest(),
+                           Hash::DIGEST_SIZE) != 0)
+                    return false;
+        }
+    }
+
+    // a moved forest keeps its arena, and the nodes linked into it
+    static_assert(!std::is_copy_constructible_v<Forest> && std::is_move_constructible_v<Forest>);
+
+    Forest moved{std::move(forest)};
+    Tree first(data.data(), Forest::INPUT_SIZE);
+
+    return memcmp(moved.digest(0), first.digest(), Hash::DIGEST_SIZE) == 0;
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Forest SHA256... ";
+    check = check_forest<4, Sha256>(64) && check_forest<7, Sha256>(33);
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Forest SHA512... ";
+    check = check_forest<5, Sha512>(40);
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing Merkle Forest ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+#ifdef MEASURE_PERFORMANCE
+#endif
+
+    return 0;
+}
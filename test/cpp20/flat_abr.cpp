@@ -0,0 +1,60 @@
+#include "utils/fixed_abr.hpp"
+#include "utils/flat_abr.hpp"
+#include "utils/sha256.hpp"
+#include "utils/sha512.hpp"
+#include <cstring>
+#include <iostream>
+
+// Compare every node against the pointer-based version
+template<size_t height, typename Hash>
+static bool same_tree()
+{
+    using Fixed = FixedAbr<height, Hash>;
+    using Flat = FlatAbr<height, Hash>;
+
+    std::vector<uint8_t> data(Fixed::INPUT_SIZE);
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = i * 7 + 5;
+
+    Fixed fixed{data.data(), data.size()};
+    Flat flat{data.data(), data.size()};
+
+    for (size_t i = 0; i < Flat::NODES_N; ++i)
+        if (memcmp(flat.get_digest(i), fixed.get_node(i)->get_digest(), Hash::DIGEST_SIZE) != 0)
+            return false;
+
+    return memcmp(flat.digest(), fixed.digest(), Hash::DIGEST_SIZE) == 0;
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Flat ABR SHA256... ";
+    check = same_tree<3, Sha256>() && same_tree<4, Sha256>() && same_tree<11, Sha256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Flat ABR SHA512... ";
+    check = same_tree<3, Sha512>() && same_tree<5, Sha512>() && same_tree<10, Sha512>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing flat ABR ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+    return 0;
+}
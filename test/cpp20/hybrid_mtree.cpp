@@ -0,0 +1,123 @@
+#include "utils/fixed_mtree.hpp"
+#include "utils/hybrid_mtree.hpp"
+#include "utils/mimc256.hpp"
+#include "utils/poseidon256.hpp"
+#include "utils/sha256.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+// A tree with a single hash is the FixedMTree of that hash, node for node
+template<size_t height, typename Levels, typename Hash>
+static bool same_tree()
+{
+    using Fixed = FixedMTree<height, Hash>;
+    using Tree = HybridMTree<height, Levels>;
+
+    std::mt19937 rng{height};
+    std::vector<uint8_t> data(Tree::INPUT_SIZE);
+
+    std::generate(data.begin(), data.end(), std::ref(rng));
+
+    Fixed fixed{data};
+    Tree tree{data};
+
+    for (size_t i = 0; i < Tree::NODES_N; ++i)
+        if (memcmp(tree.get_node(i), fixed.get_node(i)->get_digest(), Tree::DIGEST_SIZE) != 0)
+            return false;
+
+    return memcmp(tree.digest(), fixed.digest(), Tree::DIGEST_SIZE) == 0;
+}
+
+// Lower below split, Upper above: every node against one hash_oneblock, and a path to the root
+template<size_t height, size_t split, typename Lower, typename Upper>
+static bool split_tree()
+{
+    using Tree = HybridMTree<height, SplitLevels<split, Lower, Upper>>;
+
+    static constexpr size_t D = Tree::DIGEST_SIZE;
+
+    std::mt19937 rng{split};
+    std::vector<uint8_t> data(Tree::INPUT_SIZE);
+
+    std::generate(data.begin(), data.end(), std::ref(rng));
+
+    Tree tree{data};
+    uint8_t block[2 * D], cur[D];
+    bool check = true;
+
+    auto hash = [](size_t level, uint8_t *out, const uint8_t *in)
+    {
+        if (level < split)
+            Lower::hash_oneblock(out, in);
+        else
+            Upper::hash_oneblock(out, in);
+    };
+
+    for (size_t i = 0; i < Tree::LEAVES_N; ++i)
+    {
+        hash(0, cur, &data[i * 2 * D]);
+        check &= memcmp(cur, tree.get_node(i), D) == 0;
+    }
+
+    for (size_t level = 1; level < height; ++level)
+        for (size_t i = 0; i < Tree::LEAVES_N >> level; ++i)
+        {
+            memcpy(block, tree.get_node(Tree::level_offset(level - 1) + 2 * i), 2 * D);
+            hash(level, cur, block);
+            check &= memcmp(cur, tree.get_node(Tree::level_offset(level) + i), D) == 0;
+        }
+
+    uint8_t other[(height - 1) * D];
+    size_t idx = Tree::LEAVES_N / 3;
+
+    memcpy(cur, tree.get_node(idx), D);
+    tree.get_path(idx, other);
+    for (size_t level = 1; level < height; ++level, idx >>= 1)
+    {
+        memcpy(block + (idx & 1 ? D : 0), cur, D);
+        memcpy(block + (idx & 1 ? 0 : D), other + (level - 1) * D, D);
+        hash(level, cur, block);
+    }
+
+    return check && memcmp(cur, tree.digest(), D) == 0;
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Single hash... ";
+    check = same_tree<5, SplitLevels<5, Sha256, Mimc256>, Sha256>() &&
+            same_tree<5, SplitLevels<0, Sha256, Mimc256>, Mimc256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "SHA256 / MIMC256... ";
+    check = split_tree<6, 1, Sha256, Mimc256>() && split_tree<6, 4, Sha256, Mimc256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "SHA256 / POSEIDON256... ";
+    check = split_tree<7, 3, Sha256, Poseidon256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing hybrid Merkle tree ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+    return 0;
+}
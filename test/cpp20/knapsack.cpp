@@ -0,0 +1,66 @@
+#include "multi_buffer.hpp"
+#include "utils/knapsack.hpp"
+#include "utils/string_utils.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+static bool run_tests()
+{
+    uint8_t msg[Knapsack::BLOCK_SIZE]{};
+    uint8_t dig[Knapsack::DIGEST_SIZE]{};
+    auto kat_dig = "109a777c55fa57abb4bf716902e88a38f816b1f1dfc80d75833ec7b243fbe8ac"_x;
+    auto ones_dig = "11dd03808e2f6b0c7a2ca48798c404cdfa4bf31026e2946272f7a54f8e8d48f3"_x;
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    // Known answers of utils/knapsack_constants.py: 64 zero bytes, 00 01 .. 3f, 64 ff bytes
+    std::cout << "Hashing... ";
+    check = true;
+
+    Knapsack::hash_oneblock(dig, msg);
+    check = std::all_of(dig, dig + sizeof(dig), [](uint8_t b) { return b == 0; });
+
+    for (size_t i = 0; i < sizeof(msg); ++i)
+        msg[i] = i;
+    Knapsack::hash_oneblock(dig, msg);
+    check &= memcmp(dig, kat_dig.data(), sizeof(dig)) == 0;
+
+    memset(msg, 0xff, sizeof(msg));
+    Knapsack::hash_oneblock(dig, msg);
+    check &= memcmp(dig, ones_dig.data(), sizeof(dig)) == 0;
+
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Multi-buffer against scalar... ";
+    {
+        auto blocks = multi_buffer_blocks<Knapsack>();
+
+        // all bits set, for the largest sums
+        memset(&blocks[Knapsack::BLOCK_SIZE], 0xff, Knapsack::BLOCK_SIZE);
+        check = check_multi_buffer<Knapsack>(blocks, Knapsack::hash_oneblock,
+                                             Knapsack::hash_oneblock_x4);
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing KNAPSACK ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+#ifdef MEASURE_PERFORMANCE
+#endif
+
+    return 0;
+}
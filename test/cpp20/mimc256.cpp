@@ -28,7 +28,102 @@ static bool run_tests()
     return all_check;
     */
 
-   return true;
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Byte conversions... ";
+    {
+        // small values must stay right aligned, values >= p are reduced
+        auto small = "00000000000000000000000000000000000000000000000000000000000001ff"_x;
+        auto big = "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"_x;
+        uint8_t out[Mimc256::DIGEST_SIZE];
+        Mimc256::FieldT x = Mimc256::Bytes::to_field(small.data());
+        Mimc256::FieldT y = Mimc256::Bytes::to_field(big.data());
+
+        Mimc256::Bytes::from_field(out, x);
+        check = memcmp(out, small.data(), sizeof(out)) == 0 && x == Mimc256::FieldT{0x1ff};
+
+        memcpy(out, small.data(), sizeof(out));
+        Mimc256::hash_add(out, big.data());
+        check &= Mimc256::Bytes::to_field(out) == x + y;
+
+        Mimc256::Bytes::from_field(out, y);
+        check &= Mimc256::Bytes::to_field(out) == y && memcmp(out, big.data(), sizeof(out)) < 0;
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Encoding below 2^248... ";
+    {
+        // Before FieldBytes, mpz_export wrote only the significant bytes and left aligned them:
+        // such digests changed with FieldBytes, the old ones do not read back as the same value
+        auto old_enc = "01ff000000000000000000000000000000000000000000000000000000000000"_x;
+        auto new_enc = "00000000000000000000000000000000000000000000000000000000000001ff"_x;
+        Mimc256::FieldT x{0x1ff};
+        uint8_t out[Mimc256::DIGEST_SIZE]{};
+        mpz_t tmp;
+
+        mpz_init(tmp);
+        x.as_bigint().to_mpz(tmp);
+        mpz_export(out, NULL, 1, 1, 0, 0, tmp);
+        mpz_clear(tmp);
+        check = memcmp(out, old_enc.data(), sizeof(out)) == 0 &&
+                Mimc256::Bytes::to_field(out) != x;
+
+        Mimc256::Bytes::from_field(out, x);
+        check &= memcmp(out, new_enc.data(), sizeof(out)) == 0 &&
+                 Mimc256::Bytes::to_field(out) == x;
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Round constants... ";
+    {
+        // generated tables (utils/mimc_constants.py) against the first and last constants
+        auto first = "2181479744A6ECD18806C888A86D7284500034C9FDD801E6A14DDBEB47947142"_x;
+        auto last = "14123B3718243DBB298BD66F5531F2402999855214C0D6DB90E057E532AB4232"_x;
+
+        check = Mimc256::round_cf[0] == Mimc256::Bytes::to_field(first.data()) &&
+                Mimc256::round_cf[Mimc256::ROUNDS_N - 2] == Mimc256::Bytes::to_field(last.data());
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Interleaved hashing... ";
+    {
+        // 7 blocks: one full batch of LANES and a partial one
+        constexpr size_t B = Mimc256::BLOCK_SIZE, D = Mimc256::DIGEST_SIZE;
+        uint8_t msg[7 * B];
+        uint8_t dig[7 * D];
+        uint8_t pairs[3 * D];
+        uint8_t block[B];
+        uint8_t ref[D];
+
+        for (size_t i = 0; i < sizeof(msg); ++i)
+            msg[i] = (uint8_t)(i * 37 + 11);
+
+        Mimc256::hash_many(dig, msg, 7);
+        Mimc256::hash_pairs(pairs, msg, msg + D, 3);
+        check = true;
+        for (size_t i = 0; i < 7; ++i)
+        {
+            Mimc256::hash_oneblock(ref, msg + i * B);
+            check &= memcmp(dig + i * D, ref, D) == 0;
+        }
+        for (size_t i = 0; i < 3; ++i)
+        {
+            memcpy(block, msg + i * D, D);
+            memcpy(block + D, msg + (i + 1) * D, D);
+            Mimc256::hash_oneblock(ref, block);
+            check &= memcmp(pairs + i * D, ref, D) == 0;
+        }
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
 }
 
 int main()
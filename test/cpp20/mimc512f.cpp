@@ -1,7 +1,9 @@
 #include "utils/mimc512f.hpp"
 #include "utils/string_utils.hpp"
+#include <algorithm>
 #include <cstring>
 #include <iostream>
+#include <random>
 
 static bool run_tests()
 {
@@ -28,7 +30,139 @@ static bool run_tests()
     return all_check;
     */
 
-   return true;
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    // Digests of the implementation before MimcFeistel: blocks 00 01 .. 7f, and all zeros
+    std::cout << "Known answers... ";
+    {
+        uint8_t msg[Mimc512F::BLOCK_SIZE]{};
+        uint8_t dig[Mimc512F::DIGEST_SIZE];
+        auto seq_dig =
+            "1377c34162a2e56c43409964018694375cfdb67b701d909a6d66295282b06c7d"
+            "0e8903a0fa688d840dd1458f21fce6b4c16f30041d874200ff9c2f470ca9de9f"_x;
+        auto zero_dig =
+            "0dd86c5a64a28127d248a1bb324baa0aeb682ed509d58a0bc7f636aa515a45b1"
+            "149883c6c92e4fe4c09cc3e69c895d6bf368a7e54019c602e979d9b3ddbed9bf"_x;
+
+        Mimc512F::hash_oneblock(dig, msg);
+        check = memcmp(dig, zero_dig.data(), sizeof(dig)) == 0;
+
+        for (size_t i = 0; i < sizeof(msg); ++i)
+            msg[i] = i;
+        Mimc512F::hash_oneblock(dig, msg);
+        check &= memcmp(dig, seq_dig.data(), sizeof(dig)) == 0;
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Interleaved hashing... ";
+    {
+        // 7 blocks: one full batch of LANES and a partial one
+        constexpr size_t B = Mimc512F::BLOCK_SIZE, D = Mimc512F::DIGEST_SIZE;
+        uint8_t msg[7 * B];
+        uint8_t dig[7 * D];
+        uint8_t pairs[3 * D];
+        uint8_t block[B];
+        uint8_t ref[D];
+
+        for (size_t i = 0; i < sizeof(msg); ++i)
+            msg[i] = (uint8_t)(i * 37 + 11);
+
+        Mimc512F::hash_many(dig, msg, 7);
+        Mimc512F::hash_pairs(pairs, msg, msg + D, 3);
+        check = true;
+        for (size_t i = 0; i < 7; ++i)
+        {
+            Mimc512F::hash_oneblock(ref, msg + i * B);
+            check &= memcmp(dig + i * D, ref, D) == 0;
+        }
+        for (size_t i = 0; i < 3; ++i)
+        {
+            memcpy(block, msg + i * D, D);
+            memcpy(block + D, msg + (i + 1) * D, D);
+            Mimc512F::hash_oneblock(ref, block);
+            check &= memcmp(pairs + i * D, ref, D) == 0;
+        }
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Interleaved kernels... ";
+    {
+        // random messages, and the edge cases 0 and p - 1 as inputs of the first lanes
+        using FieldT = Mimc512F::FieldT;
+        std::mt19937 rng{512};
+        Mimc512F::Block x[Mimc512F::LANES];
+        Mimc512F::State scalar[Mimc512F::LANES];
+        Mimc512F::State ifma[Mimc512F::LANES];
+        uint8_t bytes[Mimc512F::FIELD_SIZE];
+
+        for (size_t l = 0; l < Mimc512F::LANES; ++l)
+            for (size_t i = 0; i < Mimc512F::BLOCK_N; ++i)
+            {
+                std::generate(bytes, bytes + sizeof(bytes), std::ref(rng));
+                x[l][i] = Mimc512F::Bytes::to_field(bytes);
+            }
+        x[0].fill(FieldT::zero());
+        x[1][2] = FieldT::zero() - FieldT::one();
+
+        Mimc512F::hash_field_xN_scalar(scalar, x);
+        check = true;
+        for (size_t l = 0; l < Mimc512F::LANES; ++l)
+            check &= scalar[l] == Mimc512F::hash_field(x[l]);
+
+        if (CpuFeatures::get().avx512ifma)
+        {
+            Mimc512F::hash_field_xN_ifma(ifma, x);
+            for (size_t l = 0; l < Mimc512F::LANES; ++l)
+                check &= ifma[l] == Mimc512F::hash_field(x[l]);
+        }
+        else
+            std::cout << "(no AVX-512 IFMA) ";
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    // 3 branches, 2 keys per pass: the kernels and the byte interface against hash_field
+    std::cout << "Other variants... ";
+    {
+        using Mimc768F = MimcFeistel<3, 64, 2>;
+        using FieldT = Mimc768F::FieldT;
+        Mimc768F::Block x[Mimc768F::LANES];
+        Mimc768F::State scalar[Mimc768F::LANES];
+        Mimc768F::State ifma[Mimc768F::LANES];
+        uint8_t bytes[Mimc768F::BLOCK_SIZE];
+        uint8_t digest[Mimc768F::DIGEST_SIZE];
+
+        for (size_t l = 0; l < Mimc768F::LANES; ++l)
+            for (size_t i = 0; i < Mimc768F::BLOCK_N; ++i)
+                x[l][i] = FieldT(l * Mimc768F::BLOCK_N + i + 1);
+
+        Mimc768F::hash_field_xN_scalar(scalar, x);
+        check = true;
+        for (size_t l = 0; l < Mimc768F::LANES; ++l)
+            check &= scalar[l] == Mimc768F::hash_field(x[l]);
+
+        if (CpuFeatures::get().avx512ifma)
+        {
+            Mimc768F::hash_field_xN_ifma(ifma, x);
+            for (size_t l = 0; l < Mimc768F::LANES; ++l)
+                check &= ifma[l] == scalar[l];
+        }
+
+        for (size_t i = 0; i < Mimc768F::BLOCK_N; ++i)
+            Mimc768F::Bytes::from_field(bytes + i * Mimc768F::FIELD_SIZE, x[1][i]);
+        Mimc768F::hash_oneblock(digest, bytes);
+        for (size_t j = 0; j < Mimc768F::BRANCHES_N; ++j)
+            check &= Mimc768F::Bytes::to_field(digest + j * Mimc768F::FIELD_SIZE) == scalar[1][j];
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
 }
 
 int main()
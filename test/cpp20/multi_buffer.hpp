@@ -0,0 +1,68 @@
+#pragma once
+
+#include "utils/cpu_features.hpp"
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <vector>
+
+/*
+Multi-buffer checks shared by the tests of the hash policies. The test blocks are
+3 * Hash::LANES + 5 blocks (full kernel calls, then a partial one) of a byte pattern that differs
+from block to block.
+*/
+template<typename Hash>
+std::vector<uint8_t> multi_buffer_blocks()
+{
+    std::vector<uint8_t> blocks((3 * Hash::LANES + 5) * Hash::BLOCK_SIZE);
+
+    for (size_t i = 0; i < blocks.size(); ++i)
+        blocks[i] = i * 29 + i / Hash::BLOCK_SIZE;
+
+    return blocks;
+}
+
+/*
+Check Hash::hash_oneblock_xN on the blocks, by chunks of Hash::LANES, then the AVX2 kernel
+avx2(digests, blocks) on the first Hash::LANES_AVX2 blocks if the CPU has it, against the scalar
+reference ref(digest, block). The digests are cleared before each pass, so that a kernel which
+writes nothing cannot pass on the digests of the previous one.
+*/
+template<typename Hash, typename Ref, typename Kernel>
+bool check_multi_buffer(const std::vector<uint8_t> &blocks, Ref ref, Kernel avx2)
+{
+    const size_t n = blocks.size() / Hash::BLOCK_SIZE;
+    std::vector<uint8_t> digests(n * Hash::DIGEST_SIZE);
+    std::vector<uint8_t *> digest_ptrs(n);
+    std::vector<const void *> block_ptrs(n);
+    uint8_t dig[Hash::DIGEST_SIZE];
+    bool check = true;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        digest_ptrs[i] = &digests[i * Hash::DIGEST_SIZE];
+        block_ptrs[i] = &blocks[i * Hash::BLOCK_SIZE];
+    }
+
+    auto check_first = [&](size_t count) {
+        for (size_t i = 0; i < count; ++i)
+        {
+            ref(dig, block_ptrs[i]);
+            check &= memcmp(dig, digest_ptrs[i], sizeof(dig)) == 0;
+        }
+    };
+
+    // full chunks, then a partial one
+    for (size_t i = 0; i < n; i += Hash::LANES)
+        Hash::hash_oneblock_xN(&digest_ptrs[i], &block_ptrs[i], std::min(Hash::LANES, n - i));
+    check_first(n);
+
+    if (CpuFeatures::get().avx2)
+    {
+        std::fill(digests.begin(), digests.end(), 0);
+        avx2(digest_ptrs.data(), block_ptrs.data());
+        check_first(Hash::LANES_AVX2);
+    }
+
+    return check;
+}
@@ -0,0 +1,148 @@
+#include "utils/field_mtree.hpp"
+#include "utils/fixed_mtree.hpp"
+#include "utils/poseidon256.hpp"
+#include "utils/string_utils.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+using FieldT = Poseidon256::FieldT;
+
+CPU_TARGET(IFMA_TARGET)
+static void hash_ifma(FieldT h[Poseidon256::LANES], const FieldT x[Poseidon256::LANES],
+                      const FieldT y[Poseidon256::LANES])
+{
+    Poseidon256::hash_field_xN_ifma(h, x, y);
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Hashing... ";
+    {
+        // test vector of the reference implementation, Poseidon([1, 2]) of circomlib
+        auto msg = "0000000000000000000000000000000000000000000000000000000000000001"
+                   "0000000000000000000000000000000000000000000000000000000000000002"_x;
+        auto real_dig = "115cc0f5e7d690413df64c6b9662e9cf2a3617f2743245519e19607a4417189a"_x;
+        uint8_t dig[Poseidon256::DIGEST_SIZE];
+
+        Poseidon256::hash_oneblock(dig, msg.data());
+        check = memcmp(dig, real_dig.data(), sizeof(dig)) == 0 &&
+                Poseidon256::hash_field(FieldT{1}, FieldT{2}) ==
+                    Poseidon256::Bytes::to_field(real_dig.data());
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Interleaved kernels... ";
+    {
+        std::mt19937 rng{1};
+        uint8_t bytes[Poseidon256::DIGEST_SIZE];
+        FieldT x[Poseidon256::LANES], y[Poseidon256::LANES], h[Poseidon256::LANES];
+
+        for (size_t l = 0; l < Poseidon256::LANES; ++l)
+        {
+            std::generate(bytes, bytes + sizeof(bytes), std::ref(rng));
+            x[l] = Poseidon256::Bytes::to_field(bytes);
+            std::generate(bytes, bytes + sizeof(bytes), std::ref(rng));
+            y[l] = Poseidon256::Bytes::to_field(bytes);
+        }
+
+        Poseidon256::hash_field_xN_scalar(h, x, y);
+        check = true;
+        for (size_t l = 0; l < Poseidon256::LANES; ++l)
+            check &= h[l] == Poseidon256::hash_field(x[l], y[l]);
+
+        if (CpuFeatures::get().avx512ifma)
+        {
+            hash_ifma(h, x, y);
+            for (size_t l = 0; l < Poseidon256::LANES; ++l)
+                check &= h[l] == Poseidon256::hash_field(x[l], y[l]);
+        }
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Interleaved hashing... ";
+    {
+        // 11 blocks: one full batch of LANES and a partial one
+        constexpr size_t B = Poseidon256::BLOCK_SIZE, D = Poseidon256::DIGEST_SIZE;
+        uint8_t msg[11 * B];
+        uint8_t dig[11 * D];
+        uint8_t pairs[3 * D];
+        uint8_t block[B];
+        uint8_t ref[D];
+
+        for (size_t i = 0; i < sizeof(msg); ++i)
+            msg[i] = (uint8_t)(i * 37 + 11);
+
+        Poseidon256::hash_many(dig, msg, 11);
+        Poseidon256::hash_pairs(pairs, msg, msg + D, 3);
+        check = true;
+        for (size_t i = 0; i < 11; ++i)
+        {
+            Poseidon256::hash_oneblock(ref, msg + i * B);
+            check &= memcmp(dig + i * D, ref, D) == 0;
+        }
+        for (size_t i = 0; i < 3; ++i)
+        {
+            memcpy(block, msg + i * D, D);
+            memcpy(block + D, msg + (i + 1) * D, D);
+            Poseidon256::hash_oneblock(ref, block);
+            check &= memcmp(pairs + i * D, ref, D) == 0;
+        }
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Trees... ";
+    {
+        // the policy drops into the byte trees, and they agree with the field-native one
+        constexpr size_t HEIGHT = 5;
+        using Tree = FieldMTree<HEIGHT, Poseidon256>;
+
+        std::mt19937 rng{HEIGHT};
+        std::vector<uint8_t> data(Tree::INPUT_SIZE);
+
+        std::generate(data.begin(), data.end(), std::ref(rng));
+
+        FixedMTree<HEIGHT, Poseidon256> fixed{data};
+        Tree tree{data};
+        Tree::Digest other[HEIGHT - 1];
+
+        check = memcmp(fixed.digest(), tree.digest(), Poseidon256::DIGEST_SIZE) == 0;
+
+        // the path of leaf 0 has the current node on the left at every level
+        std::vector<uint8_t> path(FixedMTreePath<HEIGHT, Poseidon256>::INPUT_SIZE);
+
+        tree.get_path(0, other);
+        Tree::Field::to_bytes(path.data(), tree.get_node(0));
+        for (size_t i = 0; i < HEIGHT - 1; ++i)
+            Tree::Field::to_bytes(path.data() + (i + 1) * Poseidon256::DIGEST_SIZE, other[i]);
+
+        FixedMTreePath<HEIGHT, Poseidon256> fixed_path{path};
+
+        check &= memcmp(fixed_path.digest(), tree.digest(), Poseidon256::DIGEST_SIZE) == 0;
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing POSEIDON256 ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+    return 0;
+}
@@ -1,3 +1,5 @@
+#include "multi_buffer.hpp"
+#include "utils/cpu_features.hpp"
 #include "utils/sha256.hpp"
 #include "utils/string_utils.hpp"
 #include <cstring>
@@ -22,6 +24,34 @@ static bool run_tests()
     std::cout << check << '\n';
     all_check &= check;
 
+    std::cout << "SHA-NI against scalar... ";
+    check = true;
+    if (CpuFeatures::get().sha && CpuFeatures::get().sse41)
+    {
+        uint8_t dig_ni[Sha256::DIGEST_SIZE]{};
+
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            for (size_t j = 0; j < sizeof(msg); ++j)
+                msg[j] = i * 31 + j * 7 + (i >> 3);
+
+            Sha256::hash_oneblock_scalar(dig, msg);
+            Sha256::hash_oneblock_shani(dig_ni, msg);
+            check &= memcmp(dig, dig_ni, sizeof(dig)) == 0;
+        }
+    }
+    else
+        std::cout << "(not supported) ";
+
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Multi-buffer against scalar... ";
+    check = check_multi_buffer<Sha256>(multi_buffer_blocks<Sha256>(),
+                                       Sha256::hash_oneblock_scalar, Sha256::hash_oneblock_x8);
+    std::cout << check << '\n';
+    all_check &= check;
+
     return all_check;
 }
 
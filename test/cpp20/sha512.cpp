@@ -1,3 +1,4 @@
+#include "multi_buffer.hpp"
 #include "utils/sha512.hpp"
 #include "utils/string_utils.hpp"
 #include <cstring>
@@ -22,6 +23,12 @@ static bool run_tests()
     std::cout << check << '\n';
     all_check &= check;
 
+    std::cout << "Multi-buffer against scalar... ";
+    check = check_multi_buffer<Sha512>(multi_buffer_blocks<Sha512>(),
+                                       Sha512::hash_oneblock, Sha512::hash_oneblock_x4);
+    std::cout << check << '\n';
+    all_check &= check;
+
     return all_check;
 }
 
@@ -0,0 +1,91 @@
+#include "utils/fixed_mtree.hpp"
+#include "utils/sha256.hpp"
+#include "utils/sha512.hpp"
+#include "utils/sharded_mtree.hpp"
+#include "utils/string_utils.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+template<size_t height, size_t shard_height, typename Hash>
+static bool check_shards()
+{
+    using Sharded = ShardedMTree<height, shard_height, Hash>;
+
+    std::vector<uint8_t> data(Sharded::INPUT_SIZE);
+    std::vector<uint8_t> roots(Sharded::ROOTS_SIZE);
+    std::vector<uint8_t> levels(Sharded::SHARD_NODES_N * Hash::DIGEST_SIZE);
+    uint8_t digest[Hash::DIGEST_SIZE]{};
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = i * 31 + 7;
+
+    FixedMTree<height, Hash> tree(data.data(), data.size());
+
+    // shards built one by one and merged
+    for (size_t i = 0; i < Sharded::SHARDS_N; ++i)
+    {
+        auto shard = Sharded::build_shard(data.data(), i);
+
+        Sharded::export_levels(levels.data(), shard);
+        if (memcmp(levels.data() + (Sharded::SHARD_NODES_N - 1) * Hash::DIGEST_SIZE,
+                   shard.digest(), Hash::DIGEST_SIZE) != 0)
+            return false;
+
+        memcpy(roots.data() + i * Hash::DIGEST_SIZE, shard.digest(), Hash::DIGEST_SIZE);
+    }
+    Sharded::merge(digest, roots.data(), roots.size());
+
+    if (memcmp(digest, tree.digest(), Hash::DIGEST_SIZE) != 0)
+        return false;
+
+    // shards built by forked workers, after the parallel regions of FixedMTree
+#ifndef _WIN32
+    memset(digest, 0, sizeof(digest));
+    if (!Sharded::build_forked(digest, data.data(), data.size(), 3))
+        return false;
+
+    if (memcmp(digest, tree.digest(), Hash::DIGEST_SIZE) != 0)
+        return false;
+#endif
+
+    return true;
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Sharded Tree SHA256... ";
+    check = check_shards<10, 6, Sha256>() && check_shards<6, 6, Sha256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Sharded Tree SHA512... ";
+    check = check_shards<9, 3, Sha512>() && check_shards<5, 1, Sha512>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing Sharded Merkle Tree ====\n";
+
+    // real parallel regions even on a single CPU
+    omp_set_num_threads(std::max(omp_get_max_threads(), 4));
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+#ifdef MEASURE_PERFORMANCE
+#endif
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "utils/fixed_abr.hpp"
+#include "utils/fixed_mtree.hpp"
+#include "utils/sha256.hpp"
+#include "utils/sha512.hpp"
+#include "utils/static_mtree.hpp"
+#include "utils/string_utils.hpp"
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable_v<StaticMTree<8, Sha256>>);
+static_assert(std::is_trivially_copyable_v<StaticMTreePath<16, Sha512>>);
+static_assert(std::is_trivially_copyable_v<StaticAbr<8, Sha256>>);
+
+// Compare every node and the printed tree against the heap-allocated version
+template<typename Static, typename Fixed>
+static bool same_tree(const std::vector<uint8_t> &data, size_t digest_size)
+{
+    Fixed fixed{data.data(), data.size()};
+    Static tmp{data.data(), data.size()};
+    Static tree = tmp; // copies are plain memory copies
+    std::ostringstream fixed_os, static_os;
+
+    for (size_t i = 0; i < Static::NODES_N; ++i)
+        if (memcmp(tree.get_node(i)->get_digest(), fixed.get_node(i)->get_digest(),
+                   digest_size) != 0)
+            return false;
+
+    fixed_os << fixed;
+    static_os << tree;
+
+    return memcmp(tree.digest(), fixed.digest(), digest_size) == 0 &&
+           fixed_os.str() == static_os.str();
+}
+
+template<size_t height, typename Hash>
+static bool check_static()
+{
+    std::vector<uint8_t> data(StaticAbr<height, Hash>::INPUT_SIZE);
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = i * 11 + 2;
+
+    return same_tree<StaticMTree<height, Hash>, FixedMTree<height, Hash>>(
+               {data.begin(), data.begin() + StaticMTree<height, Hash>::INPUT_SIZE},
+               Hash::DIGEST_SIZE) &&
+           same_tree<StaticMTreePath<height, Hash>, FixedMTreePath<height, Hash>>(
+               {data.begin(), data.begin() + StaticMTreePath<height, Hash>::INPUT_SIZE},
+               Hash::DIGEST_SIZE) &&
+           same_tree<StaticAbr<height, Hash>, FixedAbr<height, Hash>>(data, Hash::DIGEST_SIZE);
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Static Trees SHA256... ";
+    check = check_static<3, Sha256>() && check_static<4, Sha256>() && check_static<8, Sha256>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Static Trees SHA512... ";
+    check = check_static<4, Sha512>() && check_static<6, Sha512>();
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing Static Trees ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+#ifdef MEASURE_PERFORMANCE
+#endif
+
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include "utils/fixed_mtree.hpp"
+#include "utils/sha256.hpp"
+#include "utils/sha512.hpp"
+#include "utils/string_utils.hpp"
+#include "utils/window_mtree.hpp"
+#include <cstring>
+#include <iostream>
+
+template<size_t height, typename Hash>
+static bool check_window(size_t batches)
+{
+    using Window = WindowMTree<height, Hash>;
+
+    std::vector<uint8_t> events((Window::LEAVES_N * 3 + 5) * Hash::BLOCK_SIZE);
+    std::vector<uint8_t> slots(Window::INPUT_SIZE);
+    uint8_t path[Window::PATH_SIZE];
+    Window window;
+    size_t pushed = 0;
+
+    for (size_t i = 0; i < events.size(); ++i)
+        events[i] = i * 13 + 1;
+
+    for (size_t b = 0; b < batches; ++b)
+    {
+        // batches of varying size, some of them wrapping around the ring
+        size_t n = (b * 5 + 3) % (Window::LEAVES_N + 2);
+
+        if ((pushed + n) * Hash::BLOCK_SIZE > events.size())
+            break;
+
+        window.push(events.data() + pushed * Hash::BLOCK_SIZE, n * Hash::BLOCK_SIZE);
+
+        // replay the same events on the slots of a plain tree
+        for (size_t i = 0; i < n; ++i)
+            memcpy(slots.data() + ((pushed + i) % Window::LEAVES_N) * Hash::BLOCK_SIZE,
+                   events.data() + (pushed + i) * Hash::BLOCK_SIZE, Hash::BLOCK_SIZE);
+        pushed += n;
+
+        FixedMTree<height, Hash> tree(slots);
+
+        if (memcmp(window.digest(), tree.digest(), Hash::DIGEST_SIZE) != 0)
+            return false;
+
+        for (size_t pos = 0; pos < window.size(); ++pos)
+        {
+            size_t idx = window.path(pos, path);
+
+            if (!Window::verify_path(window.digest(), path, idx))
+                return false;
+
+            path[0] ^= 1;
+            if (Window::verify_path(window.digest(), path, idx))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+static bool run_tests()
+{
+    bool check = true;
+    bool all_check = true;
+
+    std::cout << std::boolalpha;
+
+    std::cout << "Sliding Window SHA256... ";
+    check = check_window<5, Sha256>(12);
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Sliding Window SHA512... ";
+    check = check_window<4, Sha512>(12);
+    std::cout << check << '\n';
+    all_check &= check;
+
+    return all_check;
+}
+
+int main()
+{
+    std::cout << "\n==== Testing Sliding Window Merkle Tree ====\n";
+
+    bool all_check = run_tests();
+
+    std::cout << "\n==== " << (all_check ? "ALL TESTS SUCCEEDED" : "SOME TESTS FAILED")
+              << " ====\n\n";
+
+#ifdef MEASURE_PERFORMANCE
+#endif
+
+    return 0;
+}
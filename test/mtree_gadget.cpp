@@ -1,12 +1,18 @@
 #define CURVE_ALT_BN128
 
 #include "gadget/mtree_gadget.hpp"
+#include "gadget/hybrid_mtree_gadget.hpp"
+#include "gadget/blake2s/blake2s_gadget.hpp"
+#include "gadget/knapsack/knapsack_gadget.hpp"
 #include "gadget/mimc256/mimc256_gadget.hpp"
 #include "gadget/mimc512f/mimc512f_gadget.hpp"
 #include "gadget/mimc512f2k/mimc512f2k_gadget.hpp"
+#include "gadget/poseidon256/poseidon256_gadget.hpp"
 #include "gadget/sha256/sha256_gadget.hpp"
 #include "gadget/sha512/sha512_gadget.hpp"
+#include "utils/field_mtree.hpp"
 #include "utils/fixed_mtree.hpp"
+#include "utils/hybrid_mtree.hpp"
 #include "utils/measure.hpp"
 #include "utils/mimc256.hpp"
 #include "utils/mimc512f.hpp"
@@ -30,10 +36,13 @@ using FieldT = libff::Fr<ppT>;
 
 using GadSha256 = libsnark::sha256_two_to_one_hash_gadget<FieldT>;
 using GadSha512 = libsnark::sha512::sha512_two_to_one_hash_gadget<FieldT>;
+using GadBlake2s = blake2s_two_to_one_hash_gadget<FieldT>;
+using GadKnapsack = knapsack_two_to_one_hash_gadget<FieldT>;
 
 using GadMimc256 = mimc256_two_to_one_hash_gadget<FieldT>;
 using GadMimc512F = mimc512f_two_to_one_hash_gadget<FieldT>;
 using GadMimc512F2K = mimc512f2k_two_to_one_hash_gadget<FieldT>;
+using GadPoseidon256 = poseidon256_two_to_one_hash_gadget<FieldT>;
 
 template<size_t tree_height, typename Hash, typename GadHash>
 bool test_mtree()
@@ -263,6 +272,72 @@ bool test_pmtree()
     return result;
 }
 
+template<size_t tree_height, typename Hash, typename GadHash>
+bool test_field_mtree()
+{
+    using Mtree = FieldMTree<tree_height, Hash>;
+    using DigVar = field_variable<FieldT>;
+
+    static constexpr size_t DIGEST_VARS = GadHash::DIGEST_VARS;
+
+    static std::mt19937 rng{std::random_device{}()};
+
+    // Build tree
+    std::vector<uint8_t> data(Mtree::INPUT_SIZE);
+    std::generate(data.begin(), data.end(), std::ref(rng));
+    Mtree tree{data.begin(), data.end()};
+
+    // Witnesses straight from the field elements of the tree, without any byte encoding
+    typename Mtree::Digest path[tree_height - 1];
+    tree.get_path(TRANS_IDX, path);
+
+    // Test Gadget
+    libsnark::protoboard<FieldT> pb;
+    DigVar out{pb, DIGEST_VARS, FMT("out")};
+    DigVar trans{pb, DIGEST_VARS, FMT("trans")};
+    std::vector<DigVar> other;
+
+    for (size_t i = 0; i < tree_height - 1; ++i)
+        other.emplace_back(pb, DIGEST_VARS, FMT("other_%llu", i));
+
+    pb.set_input_sizes(DIGEST_VARS);
+    MTree_Gadget<FieldT, GadHash> gadget{pb, out, trans, other, TRANS_IDX, FMT("merkle_tree")};
+
+    out.generate_r1cs_constraints();
+    trans.generate_r1cs_constraints();
+    for (size_t i = 0; i < other.size(); ++i)
+        other[i].generate_r1cs_constraints();
+    gadget.generate_r1cs_constraints();
+
+    trans.generate_r1cs_witness(tree.get_node(TRANS_IDX));
+    for (size_t i = 0; i < other.size(); ++i)
+        other[i].generate_r1cs_witness(path[i]);
+    gadget.generate_r1cs_witness();
+
+    bool result;
+    {
+        std::string vanilla = hexdump(tree.digest(), Hash::DIGEST_SIZE);
+        std::cout << "\nVanilla output:\t" << vanilla << '\n';
+
+        std::string zkp;
+
+        for (auto &&x : out)
+            zkp += hexdump(pb.val(x).as_bigint());
+        std::cout << "ZKP output:\t" << zkp << '\n';
+
+        result = vanilla == zkp;
+    }
+
+    auto keypair = libsnark::r1cs_ppzksnark_generator<ppT>(pb.get_constraint_system());
+    auto proof = libsnark::r1cs_ppzksnark_prover<ppT>(keypair.pk, pb.primary_input(),
+                                                      pb.auxiliary_input());
+
+    result &= libsnark::r1cs_ppzksnark_verifier_strong_IC<ppT>(keypair.vk, pb.primary_input(),
+                                                               proof);
+
+    return result;
+}
+
 template<size_t tree_height, typename Hash, typename GadHash>
 bool test_pmtree_path()
 {
@@ -327,6 +402,61 @@ bool test_pmtree_path()
     return result;
 }
 
+template<size_t tree_height, size_t split, typename Lower, typename Upper, typename GadHash>
+bool test_hybrid_mtree()
+{
+    using Mtree = HybridMTree<tree_height, SplitLevels<split, Lower, Upper>>;
+    using GadTree = HybridMTree_Gadget<FieldT, GadHash, Mtree>;
+    using DigVar = typename GadTree::DigVar;
+
+    static constexpr size_t DIGEST_VARS = GadHash::DIGEST_VARS;
+
+    static std::mt19937 rng{std::random_device{}()};
+
+    // Build tree
+    std::vector<uint8_t> data(Mtree::INPUT_SIZE);
+    std::generate(data.begin(), data.end(), std::ref(rng));
+    Mtree tree{data.begin(), data.end()};
+
+    // Test Gadget, only on the levels above split
+    libsnark::protoboard<FieldT> pb;
+    DigVar out{pb, DIGEST_VARS, FMT("out")};
+    DigVar trans{pb, DIGEST_VARS, FMT("trans")};
+    std::vector<DigVar> other;
+
+    for (size_t i = 0; i < GadTree::PATH_N; ++i)
+        other.emplace_back(pb, DIGEST_VARS, FMT("other_%llu", i));
+
+    pb.set_input_sizes(DIGEST_VARS);
+    GadTree gadget{pb, out, trans, other, TRANS_IDX, FMT("hybrid_tree")};
+
+    gadget.generate_r1cs_constraints();
+    gadget.generate_r1cs_witness(tree);
+
+    bool result;
+    {
+        std::string vanilla = hexdump(tree.digest(), Mtree::DIGEST_SIZE);
+        std::cout << "\nVanilla output:\t" << vanilla << '\n';
+
+        std::string zkp;
+
+        for (auto &&x : out)
+            zkp += hexdump(pb.val(x).as_bigint());
+        std::cout << "ZKP output:\t" << zkp << '\n';
+
+        result = vanilla == zkp;
+    }
+
+    auto keypair = libsnark::r1cs_ppzksnark_generator<ppT>(pb.get_constraint_system());
+    auto proof = libsnark::r1cs_ppzksnark_prover<ppT>(keypair.pk, pb.primary_input(),
+                                                      pb.auxiliary_input());
+
+    result &= libsnark::r1cs_ppzksnark_verifier_strong_IC<ppT>(keypair.vk, pb.primary_input(),
+                                                               proof);
+
+    return result;
+}
+
 static bool run_tests()
 {
     bool check = true;
@@ -361,6 +491,22 @@ static bool run_tests()
     std::cout << check << '\n';
     all_check &= check;*/
 
+    std::cout << "BLAKE2s... ";
+    std::cout.flush();
+    {
+        check = test_mtree<TREE_HEIGHT, Blake2s, GadBlake2s>();
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Knapsack... ";
+    std::cout.flush();
+    {
+        check = test_mtree<TREE_HEIGHT, Knapsack, GadKnapsack>();
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
     std::cout << "MiMC256... ";
     std::cout.flush();
     {
@@ -377,6 +523,46 @@ static bool run_tests()
     std::cout << check << '\n';
     all_check &= check;
 
+    std::cout << "Poseidon256... ";
+    std::cout.flush();
+    {
+        check = test_pmtree<TREE_HEIGHT, Poseidon256, GadPoseidon256>();
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Field MiMC256... ";
+    std::cout.flush();
+    {
+        check = test_field_mtree<TREE_HEIGHT, Mimc256, GadMimc256>();
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Field MiMC512F... ";
+    std::cout.flush();
+    {
+        check = test_field_mtree<TREE_HEIGHT, Mimc512F, GadMimc512F>();
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Field Poseidon256... ";
+    std::cout.flush();
+    {
+        check = test_field_mtree<TREE_HEIGHT, Poseidon256, GadPoseidon256>();
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
+    std::cout << "Hybrid SHA256 / MiMC256... ";
+    std::cout.flush();
+    {
+        check = test_hybrid_mtree<TREE_HEIGHT, 2, Sha256, Mimc256, GadMimc256>();
+    }
+    std::cout << check << '\n';
+    all_check &= check;
+
 
 /*
     std::cout << "MiMC512F2K... ";
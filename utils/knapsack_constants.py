@@ -0,0 +1,72 @@
+import hashlib
+import sys
+
+"""
+Generate include/utils/knapsack_constants.hpp: the coefficients of the knapsack (subset sum) CRH
+of libsnark over the scalar field r of BN254, coefficient k being libff::SHA512_rng<Fr>(k) (the
+ones sampled by knapsack_CRH_with_field_out_gadget, of dimension 1), as plain integers in 4 limbs
+of 64 bits and in 5 limbs of 52 bits.
+Usage: knapsack_constants.py > include/utils/knapsack_constants.hpp
+"""
+
+R = 21888242871839275222246405745257275088548364400416034343698204186575808495617
+N = 512
+
+
+# SHA512 of idx || iter (little-endian 64-bit words), low 256 bits cut to the size of r, until < r
+def sha512_rng(idx):
+    it = 0
+    while True:
+        h = hashlib.sha512(idx.to_bytes(8, "little") + it.to_bytes(8, "little")).digest()
+        x = int.from_bytes(h[:32], "little") & ((1 << R.bit_length()) - 1)
+        it += 1
+        if x < R:
+            return x
+
+
+C = [sha512_rng(k) for k in range(N)]
+
+
+def limbs(x, bits, n):
+    return [(x >> (bits * i)) & ((1 << bits) - 1) for i in range(n)]
+
+
+def table(declarator, values, bits, n):
+    print(f"alignas(64) inline constexpr {declarator} = {{")
+    for v in values:
+        hexs = ", ".join(f"0x{l:0{(bits + 3) // 4}x}" for l in limbs(v, bits, n))
+        print(f"    {{{hexs}}},")
+    print("};")
+
+
+# Knapsack hash of a block of N bits, bit k being bit 7 - k % 8 of byte k / 8
+def knapsack(block):
+    return sum(C[k] for k in range(N) if block[k // 8] >> (7 - k % 8) & 1) % R
+
+
+if __name__ == "__main__":
+    if len(sys.argv) > 1:
+        print("Usage: knapsack_constants.py > include/utils/knapsack_constants.hpp",
+              file=sys.stderr)
+        exit(1)
+
+    print("""// Generated by utils/knapsack_constants.py, do not edit
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+
+/*
+Knapsack CRH of libsnark over the BN254 scalar field r:
+- KNAPSACK_P: r, 4 little-endian limbs of 64 bits
+- KNAPSACK_C[k]: coefficient of input bit k, libff::SHA512_rng<Fr>(k), 4 limbs of 64 bits
+- KNAPSACK_C_52[k]: the same, 5 little-endian limbs of 52 bits
+*/
+static constexpr size_t KNAPSACK_N = %d;
+""" % N)
+    hexs = ", ".join(f"0x{l:016x}" for l in limbs(R, 64, 4))
+    print(f"inline constexpr uint64_t KNAPSACK_P[4] = {{\n    {hexs}}};")
+    print()
+    table("uint64_t KNAPSACK_C[KNAPSACK_N][4]", C, 64, 4)
+    print()
+    table("uint64_t KNAPSACK_C_52[KNAPSACK_N][5]", C, 52, 5)
@@ -0,0 +1,450 @@
+import sys
+
+"""
+Generate include/utils/mimc_constants.hpp: the MiMC round constants, reduced modulo the scalar
+field r of BN254, in Montgomery form, for libff (R = 2^256, 4 limbs of 64 bits) and for
+FieldIfma (R = 2^260, 5 limbs of 52 bits).
+Usage: mimc_constants.py > include/utils/mimc_constants.hpp
+"""
+
+R = 21888242871839275222246405745257275088548364400416034343698204186575808495617
+
+# Round constants of Mimc512F2K; Mimc256 and Mimc512F use the first 159 and 319 ones
+ROUND_C = [
+    0x2181479744A6ECD18806C888A86D7284500034C9FDD801E6A14DDBEB47947142,
+    0x2942450724CD913A16F054EED01A046A55AE02102826F9210783C1DF21660242,
+    0x13B777715CB08C969977E05EBD7490C219B6DE8C3B59AF865137FCC3EF684772,
+    0x16F62F27966A5AB5FFD4217D78456816E00497ED35368414E8F3BE00D1821622,
+    0x6AEF7CB4B40421250DFD755CF6AC8608F7A52A12256719F20F44259C1BF92F72,
+    0xDA759D592E0503649C27ABC40A61A6A14B989D34B0916B91FF20936487CF4592,
+    0x380C125497A93410A42CFCF4D017BBC9291B04E948A48E983478C1C9A5288C12,
+    0xCE10E4422304F21E5465E9903A713E292D2765C0CE8B26B197509E02CF9730E2,
+    0xF709FFA7FF1AFD02D3B9230C79C8C32EEDF5DE1C4E261FD61271FDACCDCE19F2,
+    0x539932F39F7E8898F6726A23BF2F2E7906EDF6756AC8EA7F001DF288AB1F0932,
+    0xD3AB093570F4EF6787F0E83EABD6CC204E742522E5C09D1256847350E90ABB02,
+    0x7F8E68D64110B10FA0A281961C9A30846ACF3820C732461201D3437F13AF4E62,
+    0x5E24940864991D42433E40AEFD7CE2137FA6EF1F3AE46F4CFE529C604763F492,
+    0x360796D500F4F50D7BF250B8F80AB9FB4B2ECB27A1E164A0D3535D2EB0E04792,
+    0x07E9410096A7137A68F37820C6112768047009277C3924C7BAF7675B0AE84942,
+    0x443634554F1C5A0BEC3C89762C85A05DDB6C22901A020ACD236AE0B4460EB632,
+    0x5E3F5FA77B2EE9020E4DF92C2C89E78159812D8BDAE60329046AAB94787A1F52,
+    0x035CAF938F8A23C86D439D1970F0A6CFF51977E6666D010A936FC2CA82DFCCA2,
+    0x446E4F5660669DAA070E908D0F5B4E4DBD4B8B46ACE78047C10C2F1D6DE50E42,
+    0x99F98B07C3B11328816C6071790DF3F386EBEB5FCB379C82C8107409C500F982,
+    0x46DD5C087920B56CC62B7D6BC52F330D87ADB7F25908AB6C3DD03C41DD852D52,
+    0xCD4FCFF54A4993D7E341DCB6C5A604B18D1EED05B20F26E48CAFC876F1900FC2,
+    0x4CC7FBF4BF3E59FECA1424536F7D20EBB5D4995367893955D10CC57E6A5CC7F2,
+    0x1346A717B8A237945B7636D86F0F365A6216EE843800FF5DE2ED8BCA836356A2,
+    0x2B93D4464077C5FD6F66E228243178C7E8E15498F2A37E97BFBEBC593B5F73D2,
+    0x14B4653E326D6C6A4F4FE6E818E92C49E57E1F9E1AF0128E2BC7C2CD9300C462,
+    0xD398B167EA956A4924DE2C004627D0E40C0172B5D0607C3C4DCA5C62570298B2,
+    0xDE5CB16B2F59BD67AB4E24503FE01B244E951C19FB4F45EC2FC21F7D94B30CB2,
+    0x0015555D99EBCB94C80D0632CD009EB59CFF5F360383192E6D1BB8D09C943552,
+    0x5FF09E636F61B6C3DCB3A4053037CA51BA6FA5E63EFA2D208D5A70EB157BC092,
+    0xD0344122883AAF7BD1528AA797761806DF65B9A5D64A0D7D0A72DCD30B7D3442,
+    0x63DCEC8BF2614CA89EBD45FF8E0A72113EFB8E19C7A7AA038C77FD74989F6CE2,
+    0xE5BDD835926031284E98A7DE33EC7DB2318E3692D4E9C3F8B492C34E1899DDD2,
+    0xC0C3E41B02B573D456139E53AD308D9B6D4C852E27EF1D691358B01FC15003E2,
+    0x6BC194552C797DCCB4C57E3C1EFBB0DCCDAB5C4C2C775EB2D320FD17DC559192,
+    0xED516E915C97ECA4AAC27DDB7D5B1FCE10662DE6BFB555063242F979B6F6B162,
+    0x8C24F6169155D340F144EC0DE03BA9CEC349DF265A67397669944836579544F2,
+    0xA5A78D95262CB88DB2424AFE4D64ABD5671BF56203021AAFACB06F79837D6782,
+    0x6DDC12844C43FF79483CC60C290F83CA1D025B478D2C49F00361E2EC3575FC12,
+    0x39663FC110A3FBCD73C911ABB1F9A44865E0748A097C80FE2D6C6BFE4537E632,
+    0x8FC70E28C2CB6158399CF2E834F1043E5D72042456DCF6ABBA6519BFBD7D4702,
+    0x12F566B724FA75C3BBE378A301C66E4193E5DB4B0741409C0AAD7FA7793B6562,
+    0x3D3ABA28AF6F3C6089FC39D77F6F1564018E980A1627233C7B32D4A973B3BAB2,
+    0x84543A18A7965374C109DC3F9FFA15A50A8E594AD93123FE7908203474467432,
+    0x63B502C12E86242BFF472BF79AB1C9F1DF1E9CA8794F865D4530523AB4238502,
+    0xEDCB084C4CA39E226A469CF9AB2850262BCF40522A0D54336163238DEFF02B02,
+    0xF03DA79F8EBE72F9C649D9F1ACC9EED7155651FD2E50C51A1A8555FFD7E6FDA2,
+    0xF1D74C26784A21BCA9A1AAB700908C596293DE73B5F0A3E172F49374DAB6D742,
+    0xFA7DF09606D0D41D2238DB88FA8D47C0D379ABEF8330FADC8CBDE1E292468DF2,
+    0x8B419201BAB2940BF79E5E86394566198413BA3407894E52FA60A644A4073192,
+    0x4FFB9ED5516249C93022803D274A35665FE55EBE052936B51FF59EBE99D86B92,
+    0x8F99D5A30355D6BA116722418A88B2D5F5B5C952125186934B27FF3009CDE9D2,
+    0x8C3D5574AF45F067B7A4F65CC1CAC9C54DA5A047585C1230C9007CA415D98D52,
+    0xDFD4F48D89B2AC14F7C8442C5B41B86BBAAD7FCA9494EAECDBF59A695DAB34F2,
+    0x7A81703A2B880FFD1842167D45F05B26993DEAD570691FB2D2E4B35420CEC172,
+    0x771C5EDADF7C41D7506996ADE6B40724180C182DCDED41413269644E5DF29C52,
+    0x2875EA28F4CD6995842E69F157668AD5C97A8D9273642E129DA497DD861645E2,
+    0x3B223A0619B4F9BE06708C798104D1340A417844468F78A90A810CE72FF33232,
+    0x624876113EE4CE2E8532A94137295E71EFF0FEAFA5086C5F0552EAACC392A872,
+    0xCE36C4F3EC31CF9D41F23CFDFEA87600ADFB7C8D6531D5ED6F831DB2C62126C2,
+    0xAE871C4B40EE460CE3344AEAEC128B1638E3522CD2082BA575641F2B51367712,
+    0x31033BA09FA4E2F4D0D924C59BCD076049D572ED7207E9F536AF6BC66550B332,
+    0x0E3844CE69DAC18E07530A03F6F4A3FA36F51CAA35F179E30B5DCB4ECFD0E842,
+    0xD3F78AB9C7406893414B3B219FD98531EE7A30A1DC918CE5D4039F65BCC56782,
+    0x1AEB5E8E30224C44EC5B2F0219D470F2BFF91E51073B54F63F0996E471EF0B52,
+    0xA6D2F744D32390C0EA85941E1B6DC163BA1948E36FBCBF457A7F2283D981F2F2,
+    0x5DCC4F2F95DC56752EDD7CD63F0CD3528C9449130C3E662BD37C978E5F668C42,
+    0x1E3B4F8B909B33A8B8703D712EF7087491EB0BC30EB0E14F9903C7323254EB42,
+    0x56D9FBEA11CC5D373F2E3933850ED812A47B1C4F9C6C69AA6CB8D2A2E07089F2,
+    0x8C1C6AEEFA00C7B84A700EA38BB85973751923595D0B2998D7A67D88D3463C62,
+    0xF1A9E3C2BA0083A50FBA2828AEF1B4EA8455C8D66BCC677515F67947EFADF9E2,
+    0x1398C2826F5A321A1BD35684598FCF421A46B1ED6F968D99BF1EA3A1695138C2,
+    0xFF825787B7EF55F519CF1D7D9C686738146AF7D9296E0B9F76E11B861A019252,
+    0xC80AF8D565A355DD1695D26F845BEBE2315A09060245B72DB8628FE5580E4AF2,
+    0x3B703BC16A1ECE05A9D769EB0CA51AFD22B4C2E4C7C6AB92AB1AC49508075032,
+    0xD92BBE471FCEE2C6F1CD0C426E9B8417616E550109FC5EA2F90053050E1D5BB2,
+    0xD03947114E6621C17B93A82BDA603AF35982AF3E6B19AC04190F199C62384942,
+    0x763EFED7ED5B0E536F06B219C30719AFC9A2E4EDA944B3D640E5757395AD2EF2,
+    0x223EE454730E57F405275C5EFF75F5314A92729AF89B44272C4C0ACC287C9EE2,
+    0xDA33E8AC331A1692BAFA384553DA442B82F0E1AA5C75F16A0E3D74AFDF22B3E2,
+    0xE3121F34C0099E3767D3061D02FDBB2FD2B3B36A9969F8F4C283E03067F3B212,
+    0xB004B895F9B766B3464C628E18D500DF02753477F092FCBB761253DDBEC5E4B2,
+    0x5C3DCEBB73A0997403FC82EA9264419A7B9FD963EDE31AA0E27EA4DC695AADC2,
+    0xA60303E7A8D0B7F5DC3263C3030E2743E723E1373D0CB5BF4C174B23A4808302,
+    0x8759D49A23655D755509914F65D0900FF6387CE4C1902BCB63A50CF4C2A8B9D2,
+    0xF23D092DBA688600FE1A1129C5BD09C2A966446AB0ABEB679D7A19DAC3D63D02,
+    0xD6BE9CFB9B507BE72D951B0A8CB71D3C0E580BF44D121DD40B7D2FD141AFFE92,
+    0xD155C1E45A39FCCEA25FA8C5A126868DF278CAF8C0E7973BE63B2F5037E515C2,
+    0x5008F52D341A6E1FC186E65931F80C3A8CB47025A94C2762ED2E9096C10C88F2,
+    0x4F2252BAC1606376A6431C1DCB127ABDA6AB2EFEF0A59E8EFAE1886443B9E252,
+    0x9DFFBCFFE23B77B30C6DA295A9CA230D0FF6240A956644A296918BEDEDF7CFB2,
+    0x35C02F2CB3BA6A769139CA3668817467ADB29B7292A0D66897D6A76D99930022,
+    0xF296222B2A84D954A003AE70092807E80E31012EAC4EBFB1ACA835FD733FB622,
+    0x0204ABC0C0A9C3295BE2F1CA9C1D20FF96DA1D4C6338B6F099793D268E86D4A2,
+    0x95E8C3B97A39636848C8A20DCE61D985CA329D3A97D6DB57D2F202CB98FFF8C2,
+    0x0EB35D933B568529CA171A22F9CFEADE1260055AA9F7FFC1075DF10FA65BE352,
+    0x0168B5EA08C47D602A75777C1DFBE379CF9E1B32ABE5922A75926A06CBF298B2,
+    0xC01BFB92B586EF4C255E4944DA9EF902B55779BF69F1DF4897C312344EDFBBF2,
+    0x0FB17A55AC865DEC76A693ECABB015BBCE45C6586242E79D19EC4250F7AE6172,
+    0x4954772C504A0D8FC8C9A86104F4B2810B8CCEC94B024656B0352F351AC8C472,
+    0x6CF87D65F59E2F035CF465F90261916354F6C82467A9558BFB18152EEC8F7872,
+    0x9391856652B5BA0613BE05401DCF1137BE29F9E2540372521F79B16EB01F7182,
+    0x366494FF6CCFB9434B943C943F87736EF75ACC07A18D086E2685CBDCA1899492,
+    0x639C4A680FE71FF75FDF3F2195CC093567BC007A9AB996E4B047E00B8EAC2C42,
+    0xEC602CAB508F6A4258077B5D3C7D68041B9B58AC1C268B35CDDBD429CA401022,
+    0xAEA1AF1C6270B5D9A0394552127653345A76422E56720DC6674DC5F57FBAD1A2,
+    0x6917EC84FF627047BB878FF1047EA260C4115F303432D0748C2302508E66A7E2,
+    0xC4F58FEDB91DEBB61485091233404D37F183CD32C6845A21BBF08B08B0E04582,
+    0x542FB4B67CFF86751975264B98E863C2D82A2473D3FDED2D3A069B0F872D8FB2,
+    0xC6DCE542CF15CC414B646D637AB4B97F260C18BA61B25C3AE636E5CBE2D00CE2,
+    0x811AE8EB26B79B1F62C7583F1118FC25C2DB7C149B40D461C2893043BEA48AE2,
+    0x41B28840447888853B08BA292A7FA320F11C3FFF3CFA62CEFE1244BBD58C5282,
+    0xB7507C4A7E1A3B5C3CF9BED2548B56E9CB14A35D12884F74AEAA0B3F3C9FF072,
+    0x52F996271CAEA1733136B8689B2D3D2DC01B690454503D13CC0D821C2ABBD992,
+    0xAAEB79E5B50F8F854441F904FCCD8E277537BEE21898FC9BBC4393C6F87BDB72,
+    0x254F4C3148BC5B52BEC5B1B3F71A8F8CDB5511F838AE3075EA1956C59B68BF42,
+    0x844925E96D46C5FE447B6192148F25EC050786F4EE3B2F7400E80784C85CA922,
+    0x333A68E588BF6C98246ECDB0E0DF2A114E9046F1889C70B4B753B3EF9D985A62,
+    0x366081DDF74E864579D1FB0E326750A80A5044E959AF168BD89D8A86D8906082,
+    0xE7FE11D6081E85E844AAA8C60BD0FB92CC2DF5337EA789ABB6409A0334C07E12,
+    0x9258D0D12FC24F4588C9265B107E7DD6307048653F9F7428D32709CA936E58D2,
+    0x4FF3331E55496A51C23F3704A01632C734660330BA8EF8A0935E1134FCE35332,
+    0xC0414AC05DA74958C21548493287892CAE12179812BF2363CB6DD0423A662142,
+    0x28638146179153B9D600AF386DFEB36E53041FCA417D59137BFD7610E921C382,
+    0xAB0CB813CB1C11225ACA8C02B86D3FAC91CE2FD952C017560FE87599FE050CB2,
+    0xB1496F2C97141A877276CE07367C3AC57C82F8129C63009D95EA270598203962,
+    0x7C5F0ED8DCD97AB6BE509716575B69A91A15145695408AB563DA6AAF64C2BF02,
+    0x0A0469BD7DC1F687E70C36CAB706F0FBFA0B98D7077F0E66B225F03A7A38C462,
+    0x52BCF32CFEE859461952A94357A6DA34C470D006CF43099CED83F0EEEAE37CF2,
+    0xF5496DA52E4B4AC44D2100AD322660686AA40B03685D58683D90606A50D23962,
+    0xA42797D28D5CED24F8AF902530167214769EE706C8D05F9B1A578B202B37E792,
+    0x8FE46EC1843E04E6CD81695224FB16F10D39B0A1EFF6FF3F30A0C61C00FA6462,
+    0x08D94983D2F807BBE7AF622B8740D42D33678522036D77FB5A4A4DD42AAB8942,
+    0xF5AAA303000412506EC8DD7AC26656F908DC62816DF969B7C36EEB5E7A9DEAA2,
+    0xF72F8CC4434DD1279E0B37678D8BCB478794DE26E6E1A49222F219C0E5B2DF82,
+    0x40B6B708F2F240A4A20362CD1EB882EE252FFBB6D5A31712C33C6BBE14EB36B2,
+    0xB5FC13FAE6C38D151DD15A9BFB949778D0782B1CC9EDE6D1CBC19B9C8FDB3C12,
+    0xA552548CBCDABDDC56FB258AD8EEF0C0A6BB01B5A4061F8647CF91A7A7BC1252,
+    0x96980CFC8DCACE7CA5ABD31CC0A3C6BD44895BE03936A248C3DFD3F7FF1C3802,
+    0xCD5215F99C132E1062AC4DCCE62DE2F23B36D7005AE0C22C58D167E201EFA212,
+    0x9B092F14FD98446D1077BB759841B51FFFF8751262E9671E99BFD3AE90968922,
+    0x50A89FB558E4EB00F1B351996F8D9E086B126C4CE1A342CC42376B77FAB20892,
+    0x969BAD16322FEEFBBEFE54F3B392BB5E3F837691F8BC0D2A4328EE020B1D8BA2,
+    0x01C5FE5E3BD006046618DCDAF7E3F73694A268063D3D3AEF22149CD28CE0D5F2,
+    0x525061EA14A12EFBD7B45305FD5248D1F310951BCECD10894987970E86C38062,
+    0xC64FA4937E4F2C6139A0032D37672EB902AD06948A0A94A04E60387BA340BFA2,
+    0x7AFD8A2393A0B8E05905031FA228DB58C47F09E7BB47EE7C8575543E10236D82,
+    0x0A886C5B13091D58756A098FE6CCE38453E7984C6A9FF9AAB5475D0E308F0862,
+    0xBB257BFAE1F40A470C301F66B6F146C43691A1589C458435B9EF2E2B539AB572,
+    0x81B687CB5DA1EB423F117F58D50100098C86FC8B49BDBB7593DD025C0F14D682,
+    0xF96ECB5CE6056C91359F432DD092AEFCDDAB5A1561B2FE6009C57A6F2B77FEC2,
+    0xD9A15DEEE145EAEBE98FF0DECEFB31CBDFBD3B65B5F372FA054609E04D8F1152,
+    0x5D9F959E8DE1F6E378821FDCD3545EDAB3BD10D376432129323191B40371CF92,
+    0xC02A4AC5A417E9C1CD53DC0CBFB5A1029DBE598B6D557873BA3AFF56A0396A42,
+    0xED6C775496B9D4AEC345A11823A3450EFB2766FAD324E054D5D72167F27BEC72,
+    0x5BE01270EF0AEE9653A9F3E891389BA00249E4149C4E1A75790FCB0B9E17F012,
+    0xB4322C759E1028C05D3C127CF5F75D1709119A83441EFAFFBB9E218E4B89F222,
+    0x9E7BEF31DD71DB8081F305D53E0599AD68C4551BCA0829DDEBA13055C2036BE2,
+    0x14123B3718243DBB298BD66F5531F2402999855214C0D6DB90E057E532AB4232,
+    0xE34DB107A068933F4687F307E28C8B0ECC05ABF53851E3E718A3A5E5C98D4B13,
+    0xF6F9A9083401E92CC3900DC50EDD3213D30F81EDBFAD0ABBA6C55DF7DEACC0AD,
+    0x1089AF119EF4A7D3C0DE7823B047D528F7A6093288A6F2EB5736C34FC79EE7B6,
+    0x55F34CBB363020E9EFB3CD62604772248A4764BF8FBDA764EB42454F6F3E5ED3,
+    0xD46D73208FE99AEB284D6F0A3C149881176CD715D2CAB21288CA10A65173CD6D,
+    0x93AFB26F8D73607C83FD161DA86811CB90CD737DB9F2119C6D40E33016893CEB,
+    0x998E4E70A7E3CA5F37DE523946D2A9926F9373EBF2E04C771B153994FD19E56F,
+    0x3979E4CE07E707574120392622DC7C30C406F20FA0A7274DCD2CC6A33F09891,
+    0xBAB5E22E428EF772B0AD4CC1159539F858ADFEDFFD002A02F97B9B5B66632982,
+    0xC9B6F9DCED365E7C4E0F0C983D00928AFB4D1419DA0AB38A76253B54B173C636,
+    0x3B1C242734995140648AFBB15D79A9EAB4979ACF048D78C185A3F2428E8E9EB1,
+    0xD2B99ECBC2A0AF76AEE264B9CD37EA18150CFB57166111D794F5EB277DB59D3D,
+    0xA7AD85989384AF1D2D70BC0C83F295F5DECDE882354E920B0744CCCF8B7B55DC,
+    0x4BEF237D7D670731D2C3CF9431DF00E6140EA47CEED40DE0730ADDD49FEB95C6,
+    0x7178BA5D927F8D904EEB2C55FA2B8C11343E6AAE6DD0564DA175F0064D98A30C,
+    0x871B945512C3F883FDD93D14AEC5F12E6C2543371A18990830052C4172322AC1,
+    0xCB8888920187D20545D7414EB10C8B84ABB876CB1A03A9CBDB7FD1725914C449,
+    0x4D97A35121CDB9ACC0EB247D1D2F69872102FA0B440616C23CB5895A33325690,
+    0xFF0153E92A6C4A99E89E86969221B2C232C8DEE6C25D24B5BB3ED4FF1E370B5D,
+    0xB661F1ED3549F7C22423B19FB1DF7CF9EEB2E93FAB8091490ED7100532611A49,
+    0x1F6C7EDF6430DA1159146D453E34AB88C995FDC1A535E8E1BE78C5362B03B568,
+    0x1117B0D047B609E120E15D063BCCBA3E553A63A71F9AC731C462CA37ACF7788A,
+    0xB1A165C3E7CBE5CC43929CB62DD45D132B7066E060492348DD4112216AA09227,
+    0xE359A190C8EF76986269861095FAAFF553ABACF4CE2339C491095ADF7D6E9609,
+    0x2FCB62B01E9F9C9D468B55B01B3ABA96C8AE7EFDBD771F736A7068952C6D6953,
+    0xBD48648BABBE1B705479973368559F256023E7EEFCB896B440D32811CD64E412,
+    0xE0EB1A136DFCADE279EF9B316A93A130AC2872203B5D256A11638B4444D0FF43,
+    0xC783AAFD6894B577690DAFEF8DBBA4978F9248949C24D5500DD7809DFA0BDA18,
+    0xE81DADE6E4213DD74D7B36B4D6E1DCD92919A4F9D51AB3432D6F3349D5F707E5,
+    0x59ABB90793924CA1EDD0AE76E296DA96073E7C036409755CD3DE2FC0B3DFB819,
+    0x716328282937EFE35DF581348B2F298AE148290D95C558C4760F44CA3315680C,
+    0x879B1E6AE760B4DF0B5589252FF4AF11D2C485131E99C4365799817EC777F1A6,
+    0x1E375B1389832ADE156D053FC2BB7A835B62FD040FBCAC8A0421E71C690375D7,
+    0x8664185E977202D99EB9A34B027C516C175780ADCF664E09C6D81575492D1E1B,
+    0x1B1177D9222BF83A4E1B3C65EB6454CB3108611BB93D99DF4C10809ECB5BDA3F,
+    0xCE14818F942329445D5E9558105924D0DEA6E2A65BB313083F11D83BF11F1EE8,
+    0x78C40115DA248278ACEA198C9F42B21C81CDF3C403E4503173B02E2A0512EE6F,
+    0x8EC850EAB66FD334BAF52961F4958B899DE103B9D150AB0EE33DDC9D0077FDF8,
+    0x4A59205437654053CFC0EC3183ADD66D04DC0DD4FA4266DB4C9C2A4DF6809768,
+    0x3481AE07214FC8F6CF14C28EC9B4165F1217A2288B987F8CCC0A9110D4EABBA3,
+    0x55546B7EFC4486E03894564025A2326A1D331D55636257C81C7BA186E53A53BD,
+    0xCFFC199B10D2A046D47CE47EC08474A160315A1192FD71A9062F573FC6F12822,
+    0x8AFEB4BF9963524895B567231427A98BAAF8B8355D7441195F5700417E091C01,
+    0xA5D769F01CABF3E0B2BF65173C3819EB3CDF6A34429D21FFCEC23F2767389253,
+    0x959C7716A2B684A014880AF6CAB87329778B93875511BE0E7EAF2A43DD118CE9,
+    0xA6027A5BFF6498D84A1380410950A79A6D13FFCF21B1766328C993A14FB09283,
+    0xBA9B040974083DC29454F4D13956BACB0AB7CC96EDCA279395651B7B811EDC38,
+    0x6971B49D5DD34E1051090DD0991C5832BC59F9B2EA3B244DDB3F10E634E943F9,
+    0x74C1CB3FFF738299BB9BA784C4D0A7B8FA1A0CA148A580ADC7C5F896B0CD8AA8,
+    0xAA231C51D0779F062E077647A66508A71EB13D4A7D62BC11E180BFB2A50F4FD5,
+    0xBDE6A1E3F1000D142AF9E28B13CB76037C0EAF4FDE73E500E35AF65EDE8B90A0,
+    0x7E117060F3327F78FC41EC8E9F0D3D1D00262955A43F2D254137B1F6C76F1E8,
+    0x1C0CD6BC15E9E5F30A38A5901B046FD14E3E2C478B0DE49D0EDDB3542D3DAECD,
+    0x242359A37CE375153A8ED7BF5CE87C922BD003166ADED26C0234C3D0812536F7,
+    0xB86AE5000ACCB7A580A0E42BFF3EA8FE3AB24B769DE512BCC18DA4ACD22542D8,
+    0x5A890C4A27C7D80CEB33BFDB614FAAA3DA8A5063CBD6C22BA1CEA8B3A64D7446,
+    0x6C724E69A18BD749ED4086F57C66741014414253492677A995FF8AFBB9A73F,
+    0xD31F1F6D33F5120BE7C0C9CCAE916D6228D78B28C310901554953F396236C63D,
+    0x5B46BBDAE0DD6A9C0BB3FC3D395614209C3B1C775C75398612C612BC65215096,
+    0xBC4EC3E479E3A7728B56C0FA8515403F9103A7D3C9F559D978EEF5DB4E0AE7CF,
+    0xCCE714B0B309F6C78565F2A8AB5E941DD2A8E73A77F217B5F22CEEBBDD52B03C,
+    0x48478F8886B18DA37FE329336BAA61BB1F25D15D06EEE70A3D3BADA7BE6EF256,
+    0x226558CF992A34B22501DE54473B3DFE782488A403A4022DA356867536BDB9C2,
+    0xE13F1DFB104BCC24529E8E51D76652467723EF95CA971D0AA4AFDAA14487124,
+    0xA2CBF5D31A7D068D5FD736CD87955BFAFB9BB72F770B45E1F8FFFA5F01EF022,
+    0x385B771B11E216ED4C7653F4E7C6798FE8C48C0E680551AA003BBCF157170A07,
+    0x10B4C6952E25775B0484D29D2F433841025659AB5D65ACE5A889F9569D367060,
+    0x90BD515FCCF51593D948CF0A33850F34548FC884DF6D6603B77048675E9DB5D3,
+    0x74A8BFB6826F2816F672C4B77D4CB2B36DFE3644987B53CBCAB905EA8DC6CA8E,
+    0xEA0BB20C7B1337EE048728345E294D625EC441D59FE32E2E30650E34A640C99,
+    0xD0ED48D3FC1B543AE3ACADEA1BBA0FE80698D3EA544AB8CD3BC90E258B62C33D,
+    0x9176C2D7F62F377E7A496BC9EB7E3AC0C828DB52A76E4D30D17A1EE42C99D0BF,
+    0x83096BBBD60185AB8C989E04964D0428973D959ED26E5104D83C8E7B335B1504,
+    0x2D62190C2722580E9DE7E4AD192666933ADD23A4D1417DD4B5F012A629735E94,
+    0x1E0CE0E44F7B1BA949723A3086B782753DBF21B1A55D612F33114E74B6F28998,
+    0x604062CE94A68A3F602771E74BB345D86EE35DDF35EC983D30B72DF78E5AEE03,
+    0x311FED3993604594A383584D6B57DFBE14CE160F5307BA226B8EFAF669D77A75,
+    0xA55673345A17442278660278494A0C8D1F2B3CFBF3F41EFBA063406C38A0986D,
+    0xAFCA013F143F45ED06197F20C48E795F78EE6B9C370769C556424F56795DAAED,
+    0xE8A7E56ECA72C96B5445C1157981A68573EAD30FC6A613168F8F26FEF0A472D7,
+    0x9BE0EE4BFE7A7220E3E8E73E14B8B5ECC74CABD54BEFD4001F89618D9D99C8F1,
+    0xA8A670C134375EF42BC699866A1B9F99A5E7BAF5E25918365C1A2B1C163522DA,
+    0x4628E5D0B33C67329E767256DFB26F782F22FB865DE60C6F071D011B60CC3999,
+    0x9A3FC782E4FAD6161D7A95913ED294263B0594B57CCEB38CCDDD8A4689A55171,
+    0xCB11BD3D085C9C59950B2596F21B431603D6D188D456F90BB1B74C228AD88666,
+    0xACD0ABEE6A517D5B65B59B6D328E0A381F8850864F8CF0C10ED67A7696817438,
+    0x6ECDEEF10EB5CEC89A981E716D97492C3428BE1B3C5D7C2AA8C86EB7E6E3E3B4,
+    0x669CF21EACC8F1DB5C461229372F4D560F43382D7D2E4376CC3C5613F8A3CEB5,
+    0x7FCA4FCC6FB801453FEFE866186601E6D4F9F2CB8AF6C83CACC2D52AE9343991,
+    0x5C78BDA741504A6589819073AEA1DE53339D00D92E9C7AAEF10CEE7CC01FE934,
+    0xD89A52EC7F8964B4D6B39FF2E87B50C0C2868191676CEAE6471F57B0E4E4A0FB,
+    0x20A4D805D20233AD14F5328CD57BB47137E4FD265AAD942ED51E8554A4FBF9D3,
+    0x248909E06423FC1BEE49916724878CB4CF601B0F86EFAB2B82C9EA5E093A4061,
+    0x13B47C1B75E63753DFF293C07688032A5ACB5FB93426C4DEA1B21415667ACF77,
+    0x4B71FFC4C053EB258C9D1AB5C296F67011D3F022553F19B3F204C8E16CA9F8F2,
+    0xF49AEFB3E06FADD5C758028D4CAE7C74EF6B723D76A7B9E235CC7096937221DB,
+    0xE8469014F2469C7A93727F2AA239246E8DD4FC992911FC6A5F8DF38875BCC7CF,
+    0xA305BADCB57A2145CAC7E4E099B403FC159C488EE324D0B7DAFD01E26DBAE006,
+    0xD3155234EDED7D13DD3FF3850755AC0913AD42E5464EFBBBC2A7FAB1B1CF8E44,
+    0xB4B1D0CFFFA4D440EDD3F66701346E4A53AFBB8B3C3BCA621CD827583A090D81,
+    0x231051580905665F74355109B9E754394A89966E13390931167DCD8E881D8318,
+    0x2531CB5C943C7A40A14069AF369468DEB43DB8921D40D8A32630C273DBD5449F,
+    0xA67D42DBC1C35B3C62490CA417EB28D5293D6B010BDC5E4F0D2C25F46D66285,
+    0xB4294992C5E5912365DDC445FB3F4BA3DA1D10FF83F71E179574B1D9AAC74EEA,
+    0x8C4B4476295D1D8B2CFE7B15DF735C4DB31C84CDEEBEC0662B89DFD170F24F3B,
+    0x64334E3591CC82C166DB82DBC322F10CDAEB4FD3ADF22889FBE709A0566B617B,
+    0xFE864E183F56C68DEDF83692A450E1A92DDB2E92019553004C14CBEC336C9358,
+    0x5A243E075DF56E77C8AEA59C6E2DE6990AD2D3C0D9D0EA481BE588B6DD798037,
+    0xBB01C3B16469C38B55E4536CD2B3B0B45EEE3B59D7EB2F21786033619E2D022C,
+    0xBAE7509A49B5643BF24A63C97436B6097DC97C4E5B70DFFDC9D981D1BE338042,
+    0x2E17E87B8371576C3C2DE1286B8057DDA1473AF25FF2B0E33AA24D21E442D7D9,
+    0xF282D6DC13C9321AFB191EEEEECB95514A21867B34FF3C33CA0006F0FC6704BE,
+    0xAFD08C03C9A9B6BF3FF972E251B72E3A5EF4EE58103F6BDE10AC26972B260002,
+    0x42E339B8835B250F7EC50713E69175812B78B0E04F2C72EB865FCA8659E2F271,
+    0x3E5FFCCF12607AE455CD80A9C78DE810C51D23AE0B341B311C677C9504D01D06,
+    0xB45CA11CBA158C8C0FACC0615F2C5EAE2C5D4E1842342E70DC53442BACE4016C,
+    0x283A9F36EF19EB1222F1626EA9A153F36A862B0E100644138677CA03790A8FA8,
+    0xF60AE0FC8D6A61F71302DC6234355CB2CF5F1F22155F0414FC607FA8D396F725,
+    0x26C04E59D887F46BD038C271E4D76E1AA7DA79587CF846221F454D27BC2326C1,
+    0x6FD19A7A1D860B510E7C496BDB2E7D83DCC7221D7862F691A1CCD4FB291A19F0,
+    0x7409366D9FA4CA67CB839E1D7F1807476F7FC57A1215241A8911E04C48EB675,
+    0x6001EF94F88618FBE59CFDED300CB3B0ED60E1B99809F703C29A931AB5533F87,
+    0x22168F901F188453EB33649C095D219D49F95326CED60F97EFC198B1FD3D5934,
+    0x1A6394A1B4786A26B90CE33BDDE5B192582F189BDE62124280435638E63DA013,
+    0x55311886CE3E22424121345E7CDB4C815948B9893324A68F2AA0BE45099EB632,
+    0xB18DFDCCE9F4D08FE57928007326B55567E020C16A37E64F7E8747C7AC7BADA4,
+    0x1272C012EB1C34CDDCC794B3F468F765D7DAF1DFCBFF603F2392588B5379B0D5,
+    0x42E6F8588FAE054F9D95A48CA683C5EBC193D11B8BE0C3BC507AEE9EAC6CD4B,
+    0x210C1230BDD5CA079A48244A717BBD7CDDB375FDEA99FAD0B543ECB95F064579,
+    0x97F8F7ABC4DA2B6D0E3900345A6F59F59C42BDC683BDFF31790FF478CF4B5CD,
+    0xD5A65E520B3E4460CFB64027266BD1C4E0A2DBDFC8019B87795A5E48B6DB9154,
+    0xA8F1535E91F21BD2FB3F0E57F2AEED718B5C0EDB804013D369C199957B9A8690,
+    0x9CF95473A8F9C36162A48BB83509A6C99A7C73D5C4F77DA489F62B4F5F7AA492,
+    0x85AB8CABCA184B21FE64BBFDEBC779E9863B5D95C9363ED8196446D1F4CFDBD1,
+    0xE84584444923E78BE74C1FC4035FBC51156362032BCA1760054AE92F5B50C7D5,
+    0x410E980AE3D33CE7379E55A443AF65F572E36DD0714845EAE944138C459EFC30,
+    0xA1323D2B07E136CFCA8B1F42E99A31070266A4EBDDAB198FA40FFDB9760E2D39,
+    0xF7081FFA227B6A3CD9A840BB948FB415171E2F2271D14D75FC1F04586B4F150C,
+    0xAE0397702B3094ACF1C89CCD1AE7C47164078A0B69FFC9C3D165CA8F41B30D9A,
+    0x99B4AC6EFFE46D479DF8D4B8DBA727CEF72ADD47BC2D08B16CFC21D1D0630F37,
+    0xA6B5DE5DD410F1CF6247BE0AC8974276735F4F82AD66D930F0CEE986260C0D0E,
+    0xD8614450F47CAB2235310D69AFF66E722432E2252828A6ED0A179C69115CB689,
+    0xC876633AC12125397E34223C048BBB12A0A644207880F12FF2DF563377CBD178,
+    0xE367276BB7F380ED656D89CC11F1CEF072FD670DD935E33195B2A00D53FB7F09,
+    0xCED9D199F1E874ED33CBE437CF32A35D95149D26C22E010D8FE6E0AF3E50DB6E,
+    0x2D1445288725FB3BC0955F6561FED94915E447A23000F2630AE10F85954763A1,
+    0x949E01D72687C9005FB4DD34B7761ABCCA033AC0E2BF382443121D5FA82BC41C,
+    0x74614309966C5E664087E20F2F6DBD04140221076B471CC3DC06D0A26E20D159,
+    0xDFC97FD0CF16B4FA67682448DBB6C4C61C4FA32B46B93420096F97A0BF90255C,
+    0x100C755879FD0688E4898185CD85F73F299F84AEAF59DE2A3BA8C2046D2C4929,
+    0x3FCC927F363298601C349A36E66F778C9EC670D720D0378DF02A954FAFBFF2F3,
+    0x9C2F204230C412555ECD6DC9EF5712446909659C4E164E1ECD36BC8735EB666D,
+    0x4F41E5532E1DF755D813E46695A097642189030E99D36E980B370C05AFF3DD44,
+    0x1ACEF4884EA64EBEBEFD2DFD76B1CB4CF2A5AC1A1FC6E64010DEA8FEE4F50ECB,
+    0x98D69F6B6DE24D7774A5E2F7E458078C0D7D38238D663BD9959C82829304D5AD,
+    0xE68F791D926FE5A362D42E8CF478A284E2F360D525B1FE65A49E37E7CE3F64A2,
+    0xB6D7BE267D54988DE436D3F3B04BE97BE34DEB8D4978A16D900A77D5446EBB96,
+    0x82E37D1CF9635439128069CD7996BF1DE2C936DEC91CE8A24CB50300958E7FC5,
+    0xF1AF8A946B96AB18A2BC8303BAE101B3D68D461B8F23AC3E902F42D8A13D95A1,
+    0x9A36CF734F811E77733B3A1D5603C7D0ABD15EDAD99CF27227863D79DF0A9C87,
+    0x0D66EA0C486CDA4FBD4BB674F117B91CED1BF61D4773850B1907A882AF4DCA93,
+    0x2C4D07FB0D4843E8D4504DEF4B77F1732161F473BB33E19C3B7E0DF781F2E832,
+    0x82B57D5F81FC96CD101835D1944A8DF50DA2CE23DCF67545D8E200B7FE99843B,
+    0xDD3928BEE138347C9CDA780E1BA56F618DBE7D7E8A7CBB434274CF855A8C3EA7,
+    0x3B3FAD3B2466C2714D4DB4D6E9906CC39E47442EDBDF5571B1CF3EBEA89741D9,
+    0x450CB46BDBFFAEB98B4A202B9A44EFE3369E1BBC710148B261C52DBD93030D20,
+    0x7A12FE13927CC5DF103403B4292AAF88242D94D87AEC0A89DEBBA86B773B55E1,
+    0xDD4B24BDAEF505D72086A5A824B0D37ADD67F5545FF5DBB16A13BDD6BDEB33F1,
+    0x55ED8144678066757A1626EC987854116FC68B2416FF9AF004F02BE48790CC4C,
+    0x3D690C8D54CDEDC8B9C850496C282CCC58131C4B759B3691A9CE01F416ACA311,
+    0xE81FFC2D4FD83C085D15E44204EED114ED4E323C180CA7114D525443E2DB2DA6,
+    0x0128BE698E72172EDC01EFCF2034337AD1E9E6E7AA39157B2D9A2BCB0DEA20E2,
+    0xC2D4FBFE4202FD93C9F5A3BAB3E94FF398010976B829AD3D238335DFCBD3375C,
+    0xB2242AF5878AB8395CE4D931D087066911A3A143A7E68FA657B1F37E8E4E2B93,
+    0x83C632D1F73ED4CDB1F564B76826A5480F8354D252CEFB1FC4B76F3FE07F69D7,
+    0x585AB84C087FEA60E10613B4A616933B074859566A441C18C955B68AC981E93B,
+    0xE4665195F453C2D606970DFEF44DD94304A170661E371EB9AB1ADAF07111ADF1,
+    0x29B8C3294A47C30CCF437EFD58DF7C068701EC45ECFCD29E5B9CF6E699E9E411,
+    0xDD1DD1C1A35EEA36D87FE67BF9A2E4642293F496F2A91F2081A33D13FA27ECED,
+    0xA85D328056F3623C001F5FEB3F347DD206634A951D260738F1EC7169D586D6B9,
+    0x5963996B94695BBD48AC20950B8A563D0F251CB523DF95A9DF1B5A679F7A471E,
+    0x0C2A0293FDBD1A4E5D30A41D7A86C692330EBC1E2D30103338990DB49AFDD93A,
+    0x87A9FB5776D68C9C9696E587568250166C85C4C1BAC1C11EC8180903FCED5A12,
+    0xD2C9FA8036B7F71322D69965BDE4C7992530BBE527B1DEEE7B30151F9A4DA967,
+    0x182C4B07CF7663E6D45CC8EDBBC49BCB7587E3C39D9BF5B2F7041FDCF8DEFB7B,
+    0x47C0FD16DE1FA0BEFB4B6D71F408183E10C44F57EBB7065DD410DFCB2852A9B1,
+    0x0AE0C2C9E00C5DF7C62E412393311FD9A0598E5691E8F1E2D7950306160E823E,
+    0x61DEAD123F361BC3803049DA2E19607FF20E213C2F68B7ADA4CE221B314A1F91,
+    0xA8E61C4928C94AC226628B7A820C97E17D281E116D6F606F4082A9AD5DCCB547,
+    0xC4ACAD3B43BF31D2B63809DD9344F6666885FB2919A7EB2F16DAD7FCCBBB57FF,
+    0x01B04ACB8F6DA83F6A6E372434D56512C0C0F6A4523D877EA3198CD4A6DA76E4,
+    0x4E740C6F4F00D2E9B9408FEFC693318AC1BF7C9C33DAA1BA81033674BC5D8ECA,
+    0xD3DA35A085ECB81DE7D3B188DA7EA86D7E2491B163DB39C25A101C7DEB40F257,
+    0x2D45762C80617948BD183F94B106BA677EB15DF9086BF0ADAB6F6FEBDF138E46,
+    0xB5AFCECB691DEEA257B9A2FDD8766205BA3A90FE326E1515BF8BA9E200469AF5,
+    0x9C0C785713444131875E266BCE4A6740072839F0DDAD45506084C9C81A29D76E,
+    0xD854D802118E6A330480B120676A15120E5765FD3DD30087D681F416B66A6381,
+    0x79CBBF695E74B316FD71457E83D70478CB88998C7605A92A7261BD198D27AF1D,
+    0x03478776D256F3606F3CFB30A21448886A1CBA4130F9B76C6ADBBAC65FD2D51E,
+    0x374EB2217AF798C4922B42C71CA1E57CFDFCC872C0F8738502F45762DF58919F,
+    0x886B7615ED01A30DC4218735D618AA9D19B7302290D2C3DC33D54ADEE1274278,
+    0x40619FBD097FE47845D822838FA1F22B350B572040000BF6D22914BDA4D08ECC,
+    0x589FCA62FD911A213D5E7550E4203A64F313C3A708138573AC2D25E4B06AE41B,
+    0xE88B4D90EB3751E9AC127CE221740C7CC455C7E383CA7F10C8BC420029862069,
+    0x6A8402A8DC24901D0DBEF5808B7B6E5975A857EC2901219C5111DE678E6E401E,
+    0xF96638DF742B0B29955E1C3D7D4FC55C0D820475DD62869C600507A104F94752,
+    0x659C740A5FDA6476FEA24C1AA109FF4AF02B7213A3DE823C759F2B0BBDDCB1BC,
+    0x75487D24280574E0D2B6928BD7F4395B310BA100DD6D28DE40AF8704E56F18C0,
+    0x573021B7978C6AA316375AC09132849079B08636F9FBA8D041A6581ED7811B9B,
+    0xB0A6570C2A8C73849D6F49CFB90BA59E11C0FCE44E116380436A11E2CE6CEB1F,
+    0x06F4EB8E1950DDE057C4790CC4FBC5AD1E9BE22CDD7A814DED022F980EF48CFB,
+    0x769AB27B1573433E788FCFBC3189AC8E909200D1C2DFC64D83630DE11E5B89BE,
+    0x588C1582908BED6CDF4821EF70F3009CBD4DF90F37F26AACFE405F1B624820C6,
+    0x70F89200D66629DC5776CAE94563B47DF3A52AD5D6CF8CD30CD41901D1934417,
+    0xECB2121B74E2353760F32A19AA4FDF96DBF9CF58C91572BFE5EA1F09DBCF64F5,
+    0xF54087EB0F905A2513A60F11B8F3CD78F1AE7024DBBF5FAF272C4082A4B4CEDF,
+    0x8BAC82B2A68D1922977A4F1F8307094CE7657C64F542BBA97F0C3B0199BB1EBE,
+    0x43899B61A3756FBA9332DBCF05F1A56795CAD38761F4E98658840874CC175174,
+    0x4E4A5F256BBA8431D0CD4D978395F0B304CDD9C9799EA0F76C0C578E3527180C,
+    0xEEB4C3A5D17F606D7C37A11CED165D6E4CB64EBF2471933586226C5314374BCE,
+    0x45BC5D0071A534D6702638E449C6C34B2BC41123D591E1545AC3818D2B350AA4,
+    0x65F05B7F90E79D79976CEFE4C9A640D01AB5B2FC88A8398B1A5F8C028E77BCDB,
+    0xFFAC23DABECCE69E22F1648A9488AB76E29394933E0BC56C6E0EC6981C0B1331,
+    0x2CC31386F61B896BC7E9149628576DA7A0A60B98E61AFE968DFA50357084B979,
+    0xA33B4F16378747463B386555A3709E4E18C648CAEEF4051374FC290650D3AC2E,
+    0x5C42C7A4E056FB8029A51378D98016808871A6C95CB02EF2C7928246E5F0AD02,
+    0x0F70D3A06D917ACCBBD88EEB40955297C0FD7B1B0001DDE55A7279CEEEF1DD1C,
+    0x2578C87E8A1FA9E0E723C42F8A0C532B60B96F782CBC7DA996314A9A3DACDCF3,
+    0x9FA819B690AE0627A773D2CD3D5A1AAFC91AB553F57CDE8AF5236D702678E37B,
+    0x1F2AB8284197DF6D7D9C447007A0C6B40029CBAADF322B7E9DDA68C85D69CA7C,
+    0x96B2BDE75B2AFD04E6FE336DF35D5298B6F8681B22A6D0C7BE13794DBD131A95,
+    0x9B4562C954D732A86925756A72FA16F4E0595D5548A3563A16A445A50F86BACF,
+    0xA5407CDD00AE2FC94B8941358A49D806072EE62282E47E54A830C955300FAA22,
+    0x606C6D339CB5E851AE24C50D23414BF7D37FCD6E06466A8353C314D245262B2B,
+    0xE4BCF9AA77D34ECEE2CD563AD300126FE7AC321E25F25D5D093326B5D78A7D06,
+    0x28ADC98BA9F631E834E268DDE5B297B3A531A111E5A3D95744002E32688029A4,
+    0xB67C36BA4EB3AC0573E4704876A55E955DC03164B31C5668958D94D5C4451198,
+    0xB70AD3F7D5C958F3C15232B316748A311E9907D009968E6A432B12D700C632F3,
+    0x88F9A30A8410102D317BCB67804CB1D8A25CC474FECDD6FBBF675C1C7BB96292,
+    0xCE55DEBEF511728C931FDEE0FF353249C121263760B1F18341E8AD2F8464D139,
+]
+
+
+def limbs(x, bits, n):
+    return [(x >> (bits * i)) & ((1 << bits) - 1) for i in range(n)]
+
+
+def table(declarator, bits, n, shift):
+    print(f"alignas(64) inline constexpr {declarator} = {{")
+    for c in ROUND_C:
+        x = (c % R) * (1 << shift) % R
+        hexs = ", ".join(f"0x{l:0{(bits + 3) // 4}x}" for l in limbs(x, bits, n))
+        print(f"    {{{hexs}}},")
+    print("};")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) > 1:
+        print("Usage: mimc_constants.py > include/utils/mimc_constants.hpp", file=sys.stderr)
+        exit(1)
+
+    print("""// Generated by utils/mimc_constants.py, do not edit
+#pragma once
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+
+/*
+MiMC round constants c_i mod r (BN254 scalar field) in Montgomery form:
+- MIMC_ROUND_MONT[i] = c_i * 2^256 mod r, 4 little-endian limbs of 64 bits (libff::alt_bn128_Fr)
+- MIMC_ROUND_IFMA[i] = c_i * 2^260 mod r, 5 little-endian limbs of 52 bits (FieldIfma)
+*/
+static constexpr size_t MIMC_CONSTANTS_N = %d;
+""" % len(ROUND_C))
+    table("uint64_t MIMC_ROUND_MONT[MIMC_CONSTANTS_N][4]", 64, 4, 256)
+    print()
+    table("std::array<uint64_t, 5> MIMC_ROUND_IFMA[MIMC_CONSTANTS_N]", 52, 5, 260)
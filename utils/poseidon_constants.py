@@ -0,0 +1,129 @@
+import sys
+
+"""
+Generate include/utils/poseidon_constants.hpp: the parameters of Poseidon over the scalar field
+r of BN254 (t = 3, x^5, 8 full and 57 partial rounds), from the Grain LFSR of the reference
+implementation (same constants as circomlib), in Montgomery form for libff (R = 2^256, 4 limbs
+of 64 bits) and for FieldIfma (R = 2^260, 5 limbs of 52 bits).
+Usage: poseidon_constants.py > include/utils/poseidon_constants.hpp
+"""
+
+R = 21888242871839275222246405745257275088548364400416034343698204186575808495617
+T, RF, RP, ALPHA = 3, 8, 57, 5
+N = 254
+
+
+def grain(field, sbox, n, t, rf, rp):
+    bits = []
+    for v, w in [(field, 2), (sbox, 4), (n, 12), (t, 12), (rf, 10), (rp, 10)]:
+        bits += [int(b) for b in bin(v)[2:].zfill(w)]
+    bits += [1] * 30
+
+    def step():
+        b = bits[62] ^ bits[51] ^ bits[38] ^ bits[23] ^ bits[13] ^ bits[0]
+        bits.pop(0)
+        bits.append(b)
+        return b
+
+    for _ in range(160):
+        step()
+    while True:
+        a = step()
+        while a == 0:
+            step()
+            a = step()
+        yield step()
+
+
+# field GF(p), S-box x^alpha
+g = grain(1, 0, N, T, RF, RP)
+
+
+def rand_bits(n):
+    x = 0
+    for _ in range(n):
+        x = x << 1 | next(g)
+    return x
+
+
+# round constants, then the MDS matrix (Cauchy matrix on random distinct points)
+C = []
+for _ in range((RF + RP) * T):
+    while True:
+        x = rand_bits(N)
+        if x < R:
+            break
+    C.append(x)
+
+while True:
+    vals = [rand_bits(N) % R for _ in range(2 * T)]
+    if len(set(vals)) != 2 * T:
+        continue
+    xs, ys = vals[:T], vals[T:]
+    if any((x + y) % R == 0 for x in xs for y in ys):
+        continue
+    M = [[pow(x + y, R - 2, R) for y in ys] for x in xs]
+    break
+
+
+def perm(s):
+    for r in range(RF + RP):
+        s = [(s[i] + C[r * T + i]) % R for i in range(T)]
+        if r < RF // 2 or r >= RF // 2 + RP:
+            s = [pow(v, ALPHA, R) for v in s]
+        else:
+            s[0] = pow(s[0], ALPHA, R)
+        s = [sum(M[i][j] * s[j] for j in range(T)) % R for i in range(T)]
+    return s
+
+
+def limbs(x, bits, n):
+    return [(x >> (bits * i)) & ((1 << bits) - 1) for i in range(n)]
+
+
+def table(declarator, values, bits, n, shift):
+    print(f"alignas(64) inline constexpr {declarator} = {{")
+    for v in values:
+        x = v * (1 << shift) % R
+        hexs = ", ".join(f"0x{l:0{(bits + 3) // 4}x}" for l in limbs(x, bits, n))
+        print(f"    {{{hexs}}},")
+    print("};")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) > 1:
+        print("Usage: poseidon_constants.py > include/utils/poseidon_constants.hpp",
+              file=sys.stderr)
+        exit(1)
+
+    # test vector of the reference implementation (and circomlib's Poseidon([1, 2]))
+    assert perm([0, 1, 2])[0] == 0x115CC0F5E7D690413DF64C6B9662E9CF2A3617F2743245519E19607A4417189A
+
+    mds = [M[i][j] for i in range(T) for j in range(T)]
+
+    print("""// Generated by utils/poseidon_constants.py, do not edit
+#pragma once
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+
+/*
+Poseidon parameters for the BN254 scalar field r, in Montgomery form:
+- POSEIDON_C_*[r * POSEIDON_T + i]: round constant of round r, state element i
+- POSEIDON_M_*[i * POSEIDON_T + j]: MDS matrix, row major
+*_MONT: x * 2^256 mod r, 4 little-endian limbs of 64 bits (libff::alt_bn128_Fr)
+*_IFMA: x * 2^260 mod r, 5 little-endian limbs of 52 bits (FieldIfma)
+*/
+static constexpr size_t POSEIDON_T = %d;
+static constexpr size_t POSEIDON_RF = %d;
+static constexpr size_t POSEIDON_RP = %d;
+static constexpr size_t POSEIDON_C_N = (POSEIDON_RF + POSEIDON_RP) * POSEIDON_T;
+""" % (T, RF, RP))
+    table("uint64_t POSEIDON_C_MONT[POSEIDON_C_N][4]", C, 64, 4, 256)
+    print()
+    table("uint64_t POSEIDON_M_MONT[POSEIDON_T * POSEIDON_T][4]", mds, 64, 4, 256)
+    print()
+    table("std::array<uint64_t, 5> POSEIDON_C_IFMA[POSEIDON_C_N]", C, 52, 5, 260)
+    print()
+    table("std::array<uint64_t, 5> POSEIDON_M_IFMA[POSEIDON_T * POSEIDON_T]", mds, 52, 5, 260)